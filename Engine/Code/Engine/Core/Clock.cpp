@@ -1,6 +1,7 @@
 #include "Clock.hpp"
 
 #include "Engine/Core/Time.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Math/MathUtils.hpp"
 
 static Clock* s_theSystemClock = new Clock();
@@ -36,6 +37,12 @@ void Clock::Reset()
 	m_stepSingleFrame = false;
 
 	m_maxDeltaSeconds = 0.1f;
+
+	// The fixed step and catch-up limit are configuration and survive a reset
+	m_accumulatedSeconds = 0.0f;
+	m_numOfStepsThisFrame = 0;
+	m_droppedSecondsThisFrame = 0.0f;
+	m_totalDroppedSeconds = 0.0f;
 }
 
 bool Clock::IsPaused() const
@@ -88,6 +95,50 @@ size_t Clock::GetFrameCount() const
 	return m_frameCount;
 }
 
+void Clock::SetFixedTimeStep(float fixedStepSeconds, int maxStepsPerFrame)
+{
+	GUARANTEE_OR_DIE(fixedStepSeconds >= 0.0f && maxStepsPerFrame > 0, "Clock needs a non-negative fixed step and at least one step per frame!");
+
+	m_fixedStepSeconds = fixedStepSeconds;
+	m_maxStepsPerFrame = maxStepsPerFrame;
+	m_accumulatedSeconds = 0.0f;
+	m_numOfStepsThisFrame = 0;
+}
+
+bool Clock::IsFixedTimeStep() const
+{
+	return m_fixedStepSeconds > 0.0f;
+}
+
+float Clock::GetFixedStepSeconds() const
+{
+	return m_fixedStepSeconds;
+}
+
+int Clock::GetNumOfFixedSteps() const
+{
+	return m_numOfStepsThisFrame;
+}
+
+// How far the leftover time sits between the last simulated step and the next one
+float Clock::GetInterpolationAlpha() const
+{
+	if (!IsFixedTimeStep())
+		return 1.0f;
+
+	return m_accumulatedSeconds / m_fixedStepSeconds;
+}
+
+float Clock::GetDroppedSeconds() const
+{
+	return m_droppedSecondsThisFrame;
+}
+
+float Clock::GetTotalDroppedSeconds() const
+{
+	return m_totalDroppedSeconds;
+}
+
 Clock& Clock::GetSystemClock()
 {
 	return *s_theSystemClock;
@@ -131,6 +182,8 @@ void Clock::Advance(float deltaTimeSeconds)
 
 	m_frameCount++;
 
+	AccumulateFixedSteps(deltaTimeSeconds);
+
 	for (size_t index = 0; index < m_children.size(); index++)
 	{
 		m_children[index]->Advance(m_deltaSeconds);
@@ -143,6 +196,32 @@ void Clock::Advance(float deltaTimeSeconds)
 	}
 }
 
+void Clock::AccumulateFixedSteps(float deltaTimeSeconds)
+{
+	m_numOfStepsThisFrame = 0;
+	m_droppedSecondsThisFrame = 0.0f;
+
+	if (!IsFixedTimeStep())
+		return;
+
+	m_accumulatedSeconds += deltaTimeSeconds;
+
+	int numOfSteps = static_cast<int>(m_accumulatedSeconds / m_fixedStepSeconds);
+	m_accumulatedSeconds -= static_cast<float>(numOfSteps) * m_fixedStepSeconds;
+
+	if (numOfSteps > m_maxStepsPerFrame)
+	{
+		m_droppedSecondsThisFrame = static_cast<float>(numOfSteps - m_maxStepsPerFrame) * m_fixedStepSeconds;
+		m_totalDroppedSeconds += m_droppedSecondsThisFrame;
+		numOfSteps = m_maxStepsPerFrame;
+	}
+
+	// Float error can leave the remainder a hair outside [0, step)
+	m_accumulatedSeconds = GetClamped(m_accumulatedSeconds, 0.0f, m_fixedStepSeconds);
+
+	m_numOfStepsThisFrame = numOfSteps;
+}
+
 void Clock::AddChild(Clock* childClock)
 {
 	m_children.push_back(childClock);
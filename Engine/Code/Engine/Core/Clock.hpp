@@ -19,6 +19,14 @@ class Clock
 	bool m_stepSingleFrame = false;
 
 	float m_maxDeltaSeconds = 0.1f;
+
+	// Fixed-step accumulator; a step of zero leaves the clock in variable-step mode
+	float m_fixedStepSeconds = 0.0f;
+	int m_maxStepsPerFrame = 5;
+	float m_accumulatedSeconds = 0.0f;
+	int m_numOfStepsThisFrame = 0;
+	float m_droppedSecondsThisFrame = 0.0f;
+	float m_totalDroppedSeconds = 0.0f;
 public:
 	Clock();
 	explicit Clock(Clock& parent);
@@ -39,12 +47,23 @@ public:
 	float GetDeltaSeconds() const;
 	float GetTotalSeconds() const;
 	size_t GetFrameCount() const;
+
+	// Each Advance banks the scaled delta and turns it into whole steps of fixedStepSeconds. Anything past
+	// maxStepsPerFrame steps is dropped rather than carried over, so a long hitch cannot snowball.
+	void SetFixedTimeStep(float fixedStepSeconds, int maxStepsPerFrame = 5);
+	bool IsFixedTimeStep() const;
+	float GetFixedStepSeconds() const;
+	int GetNumOfFixedSteps() const;
+	float GetInterpolationAlpha() const;
+	float GetDroppedSeconds() const;
+	float GetTotalDroppedSeconds() const;
 public:
 	static Clock& GetSystemClock();
 	static void TickSystemClock();
 protected:
 	void Tick();
 	void Advance(float deltaTimeSeconds);
+	void AccumulateFixedSteps(float deltaTimeSeconds);
 	void AddChild(Clock* childClock);
 	void RemoveChild(Clock* childClock);
 };
\ No newline at end of file
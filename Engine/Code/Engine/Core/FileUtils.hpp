@@ -2,8 +2,20 @@
 
 #include <vector>
 #include <string>
+#include <cstdint>
+
+// Read-only view of a whole file mapped into memory; m_data stays valid until FileUnmap
+struct MappedFile
+{
+	void*			m_fileHandle		= nullptr;
+	void*			m_mappingHandle		= nullptr;
+	uint8_t const*	m_data				= nullptr;
+	size_t			m_size				= 0;
+};
 
 int FileReadToBuffer(std::vector<uint8_t>& outBuffer, std::string& fileName);
 int FileReadToString(std::string& outString, std::string& fileName);
-void WriteBufferToFile(std::vector<unsigned char>& inBuffer, std::string& fileName);
+bool WriteBufferToFile(std::vector<unsigned char>& inBuffer, std::string& fileName);
 bool CreateFolder(std::string const& folderPathName);
+bool FileMapReadOnly(MappedFile& outMappedFile, std::string const& fileName);
+void FileUnmap(MappedFile& mappedFile);
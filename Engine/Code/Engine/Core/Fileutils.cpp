@@ -48,20 +48,84 @@ int FileReadToString(std::string& outString, std::string& fileName)
 	return result;
 }
 
-void WriteBufferToFile(std::vector<unsigned char>& outBuffer, std::string& fileName)
+// Returns false when the file can't be opened or not every byte reaches the disk
+bool WriteBufferToFile(std::vector<unsigned char>& outBuffer, std::string& fileName)
 {
 	FILE* fileptr = nullptr;
 
 	int error = fopen_s(&fileptr, fileName.c_str(), "wb");
 
-	if (error == 0)
-	{
-		fwrite(outBuffer.data(), sizeof(unsigned char), outBuffer.size(), fileptr);
-		fclose(fileptr);
-	}
+	if (error != 0 || !fileptr)
+		return false;
+
+	size_t numOfWrittenBytes = fwrite(outBuffer.data(), sizeof(unsigned char), outBuffer.size(), fileptr);
+	int closeError = fclose(fileptr);
+
+	return numOfWrittenBytes == outBuffer.size() && closeError == 0;
 }
 
 bool CreateFolder(std::string const& folderPathName)
 {
 	return CreateDirectoryA(folderPathName.c_str(), nullptr);
 }
+
+// Empty files cannot be mapped and report failure like missing ones
+bool FileMapReadOnly(MappedFile& outMappedFile, std::string const& fileName)
+{
+	HANDLE fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+	if (fileHandle == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER fileSize;
+
+	if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+	{
+		CloseHandle(fileHandle);
+		return false;
+	}
+
+	HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (mappingHandle == nullptr)
+	{
+		CloseHandle(fileHandle);
+		return false;
+	}
+
+	void* view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+	if (view == nullptr)
+	{
+		CloseHandle(mappingHandle);
+		CloseHandle(fileHandle);
+		return false;
+	}
+
+	outMappedFile.m_fileHandle = fileHandle;
+	outMappedFile.m_mappingHandle = mappingHandle;
+	outMappedFile.m_data = static_cast<uint8_t const*>(view);
+	outMappedFile.m_size = static_cast<size_t>(fileSize.QuadPart);
+
+	return true;
+}
+
+void FileUnmap(MappedFile& mappedFile)
+{
+	if (mappedFile.m_data)
+	{
+		UnmapViewOfFile(mappedFile.m_data);
+	}
+
+	if (mappedFile.m_mappingHandle)
+	{
+		CloseHandle(mappedFile.m_mappingHandle);
+	}
+
+	if (mappedFile.m_fileHandle)
+	{
+		CloseHandle(mappedFile.m_fileHandle);
+	}
+
+	mappedFile = MappedFile();
+}
\ No newline at end of file
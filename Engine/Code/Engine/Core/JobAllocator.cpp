@@ -0,0 +1,165 @@
+#include "Engine/Core/JobAllocator.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+class JobBlockPool;
+
+struct JobBlockHeader
+{
+	JobBlockPool* m_owner = nullptr;
+	JobBlockHeader* m_nextFreeBlock = nullptr;
+};
+
+static_assert(sizeof(JobBlockHeader) <= JOB_BLOCK_HEADER_SIZE, "JobBlockHeader no longer fits in JOB_BLOCK_HEADER_SIZE!");
+
+// Only the owning thread takes blocks. Blocks freed by other threads go on a lock-free list the owner reclaims all at once,
+// so there is no ABA problem and every block eventually returns to the pool that allocated it.
+class JobBlockPool
+{
+	JobBlockHeader* m_freeBlocks = nullptr;
+	std::atomic<JobBlockHeader*> m_remoteFreeBlocks = nullptr;
+public:
+	JobBlockHeader* AllocateBlock();
+	void FreeLocalBlock(JobBlockHeader* block);
+	void FreeRemoteBlock(JobBlockHeader* block);
+private:
+	void AllocateChunk();
+};
+
+// Pools outlive their threads since their blocks may still be in flight. A finished thread's pool is handed to the next thread that needs one.
+static std::mutex s_orphanedPoolsMutex;
+static std::vector<JobBlockPool*> s_orphanedPools;
+
+struct JobBlockPoolHandle
+{
+	JobBlockPool* m_pool = nullptr;
+
+	~JobBlockPoolHandle();
+};
+
+static thread_local JobBlockPool* s_threadPool = nullptr;
+static thread_local JobBlockPoolHandle s_threadPoolHandle;
+
+JobBlockPoolHandle::~JobBlockPoolHandle()
+{
+	if (m_pool)
+	{
+		s_threadPool = nullptr;
+
+		std::lock_guard<std::mutex> lock(s_orphanedPoolsMutex);
+		s_orphanedPools.push_back(m_pool);
+	}
+}
+
+static JobBlockPool* GetThreadJobBlockPool()
+{
+	if (!s_threadPool)
+	{
+		s_orphanedPoolsMutex.lock();
+		if (!s_orphanedPools.empty())
+		{
+			s_threadPool = s_orphanedPools.back();
+			s_orphanedPools.pop_back();
+		}
+		s_orphanedPoolsMutex.unlock();
+
+		if (!s_threadPool)
+		{
+			s_threadPool = new JobBlockPool();
+		}
+
+		s_threadPoolHandle.m_pool = s_threadPool;
+	}
+
+	return s_threadPool;
+}
+
+JobBlockHeader* JobBlockPool::AllocateBlock()
+{
+	if (!m_freeBlocks)
+	{
+		m_freeBlocks = m_remoteFreeBlocks.exchange(nullptr, std::memory_order_acquire);
+	}
+
+	if (!m_freeBlocks)
+	{
+		AllocateChunk();
+	}
+
+	JobBlockHeader* block = m_freeBlocks;
+	m_freeBlocks = block->m_nextFreeBlock;
+	block->m_nextFreeBlock = nullptr;
+
+	return block;
+}
+
+void JobBlockPool::FreeLocalBlock(JobBlockHeader* block)
+{
+	block->m_nextFreeBlock = m_freeBlocks;
+	m_freeBlocks = block;
+}
+
+void JobBlockPool::FreeRemoteBlock(JobBlockHeader* block)
+{
+	JobBlockHeader* head = m_remoteFreeBlocks.load(std::memory_order_relaxed);
+
+	do
+	{
+		block->m_nextFreeBlock = head;
+	} while (!m_remoteFreeBlocks.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void JobBlockPool::AllocateChunk()
+{
+	// Chunks are never returned to the heap; the pool keeps its high-water mark
+	unsigned char* chunk = static_cast<unsigned char*>(::operator new(JOB_BLOCK_SIZE * NUM_OF_JOB_BLOCKS_PER_CHUNK));
+
+	for (int blockIndex = NUM_OF_JOB_BLOCKS_PER_CHUNK - 1; blockIndex >= 0; blockIndex--)
+	{
+		JobBlockHeader* block = new (chunk + JOB_BLOCK_SIZE * blockIndex) JobBlockHeader();
+		block->m_owner = this;
+		FreeLocalBlock(block);
+	}
+}
+
+void* AllocateJobMemory(size_t size)
+{
+	JobBlockHeader* block = nullptr;
+
+	if (size <= JOB_BLOCK_PAYLOAD_SIZE)
+	{
+		block = GetThreadJobBlockPool()->AllocateBlock();
+	}
+	else
+	{
+		block = new (::operator new(JOB_BLOCK_HEADER_SIZE + size)) JobBlockHeader();
+	}
+
+	return reinterpret_cast<unsigned char*>(block) + JOB_BLOCK_HEADER_SIZE;
+}
+
+void FreeJobMemory(void* memory)
+{
+	if (!memory)
+		return;
+
+	JobBlockHeader* block = reinterpret_cast<JobBlockHeader*>(static_cast<unsigned char*>(memory) - JOB_BLOCK_HEADER_SIZE);
+	JobBlockPool* owner = block->m_owner;
+
+	if (!owner)
+	{
+		block->~JobBlockHeader();
+		::operator delete(block);
+	}
+	else if (owner == s_threadPool)
+	{
+		owner->FreeLocalBlock(block);
+	}
+	else
+	{
+		owner->FreeRemoteBlock(block);
+	}
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+
+// Memory for jobs created by JobSystem::Submit. Requests up to JOB_BLOCK_PAYLOAD_SIZE come from fixed-size blocks in a pool owned by the
+// allocating thread, so steady-state submission never reaches the heap. Larger requests fall back to operator new.
+constexpr size_t JOB_BLOCK_SIZE = 512;
+constexpr size_t JOB_BLOCK_HEADER_SIZE = 16;
+constexpr size_t JOB_BLOCK_PAYLOAD_SIZE = JOB_BLOCK_SIZE - JOB_BLOCK_HEADER_SIZE;
+constexpr int NUM_OF_JOB_BLOCKS_PER_CHUNK = 64;
+
+void* AllocateJobMemory(size_t size);
+void FreeJobMemory(void* memory);
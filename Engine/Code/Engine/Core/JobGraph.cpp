@@ -0,0 +1,100 @@
+#include "Engine/Core/JobGraph.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+
+JobGraphNode::JobGraphNode(JobGraph* graph, std::function<void()> const& work)
+	: m_graph(graph), m_work(work)
+{
+	m_isRetrievable = false;
+}
+
+void JobGraphNode::Execute()
+{
+	m_work();
+}
+
+void JobGraphNode::OnCompleted()
+{
+	m_graph->CompleteNode();
+}
+
+JobGraph::~JobGraph()
+{
+	Wait();
+
+	for (size_t index = 0; index < m_nodes.size(); index++)
+	{
+		DELETE_PTR(m_nodes[index]);
+	}
+
+	m_nodes.clear();
+}
+
+JobGraphNodeID JobGraph::AddNode(std::function<void()> const& work, JobPriority priority)
+{
+	GUARANTEE_OR_DIE(IsComplete(), "Cannot add nodes to a JobGraph while it is running!");
+
+	m_nodes.push_back(new JobGraphNode(this, work));
+	m_nodes.back()->SetPriority(priority);
+
+	return static_cast<JobGraphNodeID>(m_nodes.size()) - 1;
+}
+
+void JobGraph::AddEdge(JobGraphNodeID predecessor, JobGraphNodeID successor)
+{
+	GUARANTEE_OR_DIE(predecessor >= 0 && predecessor < static_cast<int>(m_nodes.size()), "Invalid JobGraph predecessor node!");
+	GUARANTEE_OR_DIE(successor >= 0 && successor < static_cast<int>(m_nodes.size()), "Invalid JobGraph successor node!");
+	GUARANTEE_OR_DIE(predecessor != successor, "A JobGraph node cannot depend on itself!");
+
+	m_edges.push_back(std::make_pair(predecessor, successor));
+}
+
+void JobGraph::Submit(JobSystem* jobSystem)
+{
+	GUARANTEE_OR_DIE(IsComplete(), "JobGraph was submitted again before the previous submission completed!");
+
+	m_completionMutex.lock();
+	m_numOfRemainingNodes = static_cast<int>(m_nodes.size());
+	m_completionMutex.unlock();
+
+	for (size_t index = 0; index < m_nodes.size(); index++)
+	{
+		m_nodes[index]->ResetDependencies();
+	}
+
+	for (size_t index = 0; index < m_edges.size(); index++)
+	{
+		m_nodes[m_edges[index].second]->AddDependency(m_nodes[m_edges[index].first]);
+	}
+
+	for (size_t index = 0; index < m_nodes.size(); index++)
+	{
+		jobSystem->AddJob(m_nodes[index]);
+	}
+}
+
+void JobGraph::Wait()
+{
+	std::unique_lock<std::mutex> lock(m_completionMutex);
+
+	m_completionCondition.wait(lock, [this]() { return m_numOfRemainingNodes == 0; });
+}
+
+bool JobGraph::IsComplete()
+{
+	std::lock_guard<std::mutex> lock(m_completionMutex);
+
+	return m_numOfRemainingNodes == 0;
+}
+
+void JobGraph::CompleteNode()
+{
+	std::lock_guard<std::mutex> lock(m_completionMutex);
+
+	m_numOfRemainingNodes--;
+
+	if (m_numOfRemainingNodes == 0)
+	{
+		m_completionCondition.notify_all();
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Engine/Core/JobSystem.hpp"
+
+#include <functional>
+#include <utility>
+
+class JobGraph;
+
+typedef int JobGraphNodeID;
+
+class JobGraphNode : public Job
+{
+	JobGraph* m_graph = nullptr;
+	std::function<void()> m_work;
+public:
+	JobGraphNode(JobGraph* graph, std::function<void()> const& work);
+
+	virtual void Execute() override;
+protected:
+	virtual void OnCompleted() override;
+};
+
+// A fixed set of jobs and the ordering between them, built once and re-submitted every frame
+class JobGraph
+{
+	std::vector<JobGraphNode*> m_nodes;
+	std::vector<std::pair<JobGraphNodeID, JobGraphNodeID>> m_edges;
+
+	std::mutex m_completionMutex;
+	std::condition_variable m_completionCondition;
+	int m_numOfRemainingNodes = 0;
+public:
+	JobGraph() = default;
+	JobGraph(JobGraph const& copy) = delete;
+	~JobGraph();
+
+	JobGraphNodeID AddNode(std::function<void()> const& work, JobPriority priority = JobPriority::NORMAL);
+	void AddEdge(JobGraphNodeID predecessor, JobGraphNodeID successor);
+
+	void Submit(JobSystem* jobSystem);
+	void Wait();
+	bool IsComplete();
+private:
+	void CompleteNode();
+private:
+	friend class JobGraphNode;
+};
@@ -1,35 +1,280 @@
 #include "JobSystem.hpp"
 
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/Time.hpp"
 
-JobWorkerThread::JobWorkerThread(JobSystem* owner, unsigned int id)
+JobSystem* g_theJobSystem = nullptr;
+
+static thread_local JobWorkerThread* s_currentWorkerThread = nullptr;
+static thread_local Job* s_currentJob = nullptr;
+
+// Jobs can run nested while a thread helps out during a wait, so the outer job is restored afterwards
+static void ExecuteJobOnThisThread(Job* job)
+{
+	Job* outerJob = s_currentJob;
+
+	s_currentJob = job;
+	job->Execute();
+	s_currentJob = outerJob;
+}
+
+template <typename T>
+static void UpdateAtomicMaximum(std::atomic<T>& maximum, T value)
+{
+	T currentMaximum = maximum;
+
+	while (value > currentMaximum && !maximum.compare_exchange_weak(currentMaximum, value))
+	{
+	}
+}
+
+void Job::AddDependency(Job* predecessor)
+{
+	predecessor->AddContinuation(this);
+}
+
+void Job::AddContinuation(Job* continuation)
+{
+	std::lock_guard<std::mutex> lock(m_continuationsMutex);
+
+	if (m_hasFinished)
+		return;
+
+	continuation->m_numOfPendingDependencies++;
+	m_continuations.push_back(continuation);
+}
+
+void Job::ResetDependencies()
+{
+	std::lock_guard<std::mutex> lock(m_continuationsMutex);
+
+	m_hasFinished = false;
+	m_continuations.clear();
+}
+
+void Job::SetPriority(JobPriority priority)
+{
+	m_priority = priority;
+}
+
+JobPriority Job::GetPriority() const
+{
+	return m_priority;
+}
+
+bool JobList::IsEmpty() const
+{
+	return m_head == nullptr;
+}
+
+void JobList::PushBack(Job* job)
+{
+	job->m_nextListedJob = nullptr;
+
+	if (m_tail)
+	{
+		m_tail->m_nextListedJob = job;
+	}
+	else
+	{
+		m_head = job;
+	}
+
+	m_tail = job;
+}
+
+Job* JobList::PopFront()
+{
+	Job* job = m_head;
+
+	if (job)
+	{
+		m_head = job->m_nextListedJob;
+		job->m_nextListedJob = nullptr;
+
+		if (!m_head)
+		{
+			m_tail = nullptr;
+		}
+	}
+
+	return job;
+}
+
+bool JobList::Remove(Job* job)
+{
+	Job* previousJob = nullptr;
+
+	for (Job* listedJob = m_head; listedJob; listedJob = listedJob->m_nextListedJob)
+	{
+		if (listedJob == job)
+		{
+			if (previousJob)
+			{
+				previousJob->m_nextListedJob = job->m_nextListedJob;
+			}
+			else
+			{
+				m_head = job->m_nextListedJob;
+			}
+
+			if (m_tail == job)
+			{
+				m_tail = previousJob;
+			}
+
+			job->m_nextListedJob = nullptr;
+
+			return true;
+		}
+
+		previousJob = listedJob;
+	}
+
+	return false;
+}
+
+JobDeque::JobDeque(int capacity)
+{
+	int64_t roundedCapacity = 2;
+
+	while (roundedCapacity < capacity)
+	{
+		roundedCapacity <<= 1;
+	}
+
+	m_buffer = std::vector<std::atomic<Job*>>(static_cast<size_t>(roundedCapacity));
+	m_mask = roundedCapacity - 1;
+}
+
+bool JobDeque::Push(Job* job)
+{
+	int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+	int64_t top = m_top.load(std::memory_order_acquire);
+
+	if (bottom - top > m_mask)
+		return false;
+
+	m_buffer[bottom & m_mask].store(job, std::memory_order_relaxed);
+	m_bottom.store(bottom + 1, std::memory_order_release);
+
+	return true;
+}
+
+Job* JobDeque::Pop()
+{
+	int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+	m_bottom.store(bottom, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t top = m_top.load(std::memory_order_relaxed);
+
+	if (top > bottom)
+	{
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	Job* job = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+
+	if (top == bottom)
+	{
+		// Last job left, race any thieves for it
+		if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			job = nullptr;
+		}
+
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+	}
+
+	return job;
+}
+
+Job* JobDeque::Steal()
+{
+	int64_t top = m_top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+	if (top >= bottom)
+		return nullptr;
+
+	Job* job = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+
+	if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		return nullptr;
+
+	return job;
+}
+
+size_t JobDeque::GetSize() const
+{
+	int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+	int64_t top = m_top.load(std::memory_order_relaxed);
+
+	return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+JobWorkerLane::JobWorkerLane(int localQueueCapacity)
+	: m_localJobs(localQueueCapacity)
+{
+}
+
+JobWorkerThread::JobWorkerThread(JobSystem* owner, unsigned int id, int localQueueCapacity)
 {
 	m_owner = owner;
 	m_ID = id;
 
-	m_workerThread = new std::thread(&JobWorkerThread::ThreadMain, this);
+	for (int lane = 0; lane < NUM_JOB_PRIORITIES; lane++)
+	{
+		m_lanes[lane] = new JobWorkerLane(localQueueCapacity);
+	}
 }
 
 JobWorkerThread::~JobWorkerThread()
 {
+	ShutDown();
+
+	for (int lane = 0; lane < NUM_JOB_PRIORITIES; lane++)
+	{
+		DELETE_PTR(m_lanes[lane]);
+	}
+}
+
+void JobWorkerThread::StartUp()
+{
+	m_workerThread = new std::thread(&JobWorkerThread::ThreadMain, this);
+}
+
+void JobWorkerThread::ShutDown()
+{
+	if (m_workerThread)
+	{
+		m_workerThread->join();
+		DELETE_PTR(m_workerThread);
+	}
 }
 
 void JobWorkerThread::ThreadMain()
 {
+	s_currentWorkerThread = this;
+
 	while (!m_owner->m_isQuitting)
 	{
-		Job* claimedJob = m_owner->WorkerClaimAQueuedJob(this);
+		Job* claimedJob = m_owner->WorkerClaimAQueuedJob(this, m_owner->IsPastFrameDeadline() ? JobPriority::NORMAL : JobPriority::BACKGROUND);
 
 		if (claimedJob)
 		{
-			claimedJob->Execute();
+			ExecuteJobOnThisThread(claimedJob);
 			m_owner->WorkerCompleteAJob(this, claimedJob);
 		}
 		else
 		{
-			std::this_thread::sleep_for(std::chrono::microseconds(1));
+			m_owner->WorkerWaitForJobs(this);
 		}
 	}
+
+	s_currentWorkerThread = nullptr;
 }
 
 JobSystem::JobSystem(JobSystemConfig const& config)
@@ -38,15 +283,17 @@ JobSystem::JobSystem(JobSystemConfig const& config)
 
 	for (int workerIndex = 0; workerIndex < m_config.m_numOfWorkerThreads; workerIndex++)
 	{
-		JobWorkerThread* workerThread = new JobWorkerThread(this, workerIndex + 1);
-		
+		JobWorkerThread* workerThread = new JobWorkerThread(this, workerIndex + 1, m_config.m_localQueueCapacity);
+
 		m_workerThreads.push_back(workerThread);
 	}
 }
 
 JobSystem::~JobSystem()
 {
-	for (int workerIndex = 0; m_config.m_numOfWorkerThreads; workerIndex++)
+	ShutDown();
+
+	for (int workerIndex = 0; workerIndex < static_cast<int>(m_workerThreads.size()); workerIndex++)
 	{
 		DELETE_PTR(m_workerThreads[workerIndex]);
 	}
@@ -56,111 +303,376 @@ JobSystem::~JobSystem()
 
 void JobSystem::StartUp()
 {
+	m_isQuitting = false;
+
+	for (int workerIndex = 0; workerIndex < static_cast<int>(m_workerThreads.size()); workerIndex++)
+	{
+		m_workerThreads[workerIndex]->StartUp();
+	}
 }
 
 void JobSystem::ShutDown()
 {
 	m_isQuitting = true;
+
+	m_idleMutex.lock();
+	m_idleCondition.notify_all();
+	m_idleMutex.unlock();
+
+	for (int workerIndex = 0; workerIndex < static_cast<int>(m_workerThreads.size()); workerIndex++)
+	{
+		m_workerThreads[workerIndex]->ShutDown();
+	}
 }
 
 void JobSystem::AddJob(Job* jobToAdd)
 {
-	jobToAdd->m_status = JobStatus::QUEUED;
-	m_queuedJobsMutex.lock();
-	m_queuedJobs.push_back(jobToAdd);
-	m_queuedJobsMutex.unlock();
+	GUARANTEE_OR_DIE(!m_workerThreads.empty(), "JobSystem has no worker threads to run jobs on!");
+
+	jobToAdd->m_status = JobStatus::WAITING;
+
+	// Drop the submission reference; the last predecessor to finish queues the job otherwise
+	if (--jobToAdd->m_numOfPendingDependencies == 0)
+	{
+		EnqueueJob(jobToAdd);
+	}
+}
+
+void JobSystem::EnqueueJob(Job* job)
+{
+	int lane = static_cast<int>(job->m_priority);
+	JobLaneCounters& laneCounters = m_laneCounters[lane];
+
+	job->m_status = JobStatus::QUEUED;
+	job->m_queuedTime = GetCurrentTimeSeconds();
+	m_numOfQueuedJobs++;
+	UpdateAtomicMaximum(laneCounters.m_peakNumOfQueuedJobs, ++laneCounters.m_numOfQueuedJobs);
+
+	JobWorkerThread* currentWorker = s_currentWorkerThread;
+
+	if (!currentWorker || currentWorker->m_owner != this || !currentWorker->m_lanes[lane]->m_localJobs.Push(job))
+	{
+		// Jobs from outside the pool (or an overflowing local deque) are sharded across the worker inboxes
+		JobWorkerThread* inboxWorker = currentWorker && currentWorker->m_owner == this ? currentWorker : m_workerThreads[m_nextInboxIndex++ % m_workerThreads.size()];
+		JobWorkerLane* inboxLane = inboxWorker->m_lanes[lane];
+
+		inboxLane->m_inboxMutex.lock();
+		inboxLane->m_inboxJobs.PushBack(job);
+		inboxLane->m_inboxMutex.unlock();
+	}
+
+	WakeIdleWorker();
 }
 
 size_t JobSystem::GetNumOfQueuedJobs()
 {
-	return m_queuedJobs.size();
+	return m_numOfQueuedJobs;
 }
 
-Job* JobSystem::WorkerClaimAQueuedJob(JobWorkerThread* workerThread)
+size_t JobSystem::GetNumOfQueuedJobs(JobPriority priority) const
 {
-	UNUSED(workerThread);
+	return m_laneCounters[static_cast<int>(priority)].m_numOfQueuedJobs;
+}
+
+int JobSystem::GetNumOfWorkerThreads() const
+{
+	return static_cast<int>(m_workerThreads.size());
+}
+
+JobLaneStats JobSystem::GetLaneStats(JobPriority priority) const
+{
+	JobLaneCounters const& laneCounters = m_laneCounters[static_cast<int>(priority)];
+	JobLaneStats stats;
+
+	stats.m_numOfQueuedJobs = laneCounters.m_numOfQueuedJobs;
+	stats.m_peakNumOfQueuedJobs = laneCounters.m_peakNumOfQueuedJobs;
+	stats.m_numOfStartedJobs = laneCounters.m_numOfStartedJobs;
+	stats.m_totalWaitSeconds = static_cast<double>(laneCounters.m_totalWaitMicroseconds) * 0.000001;
+	stats.m_maxWaitSeconds = static_cast<double>(laneCounters.m_maxWaitMicroseconds) * 0.000001;
+
+	return stats;
+}
+
+void JobSystem::SetFrameDeadline(double deadlineSeconds)
+{
+	m_frameDeadline = deadlineSeconds;
+
+	// Workers parked while background jobs were held back need to re-check
+	m_idleMutex.lock();
+	m_idleCondition.notify_all();
+	m_idleMutex.unlock();
+}
+
+void JobSystem::ClearFrameDeadline()
+{
+	SetFrameDeadline(0.0);
+}
 
-	m_queuedJobsMutex.lock();
-	if (!m_queuedJobs.empty())
+bool JobSystem::IsPastFrameDeadline() const
+{
+	double frameDeadline = m_frameDeadline;
+
+	return frameDeadline > 0.0 && GetCurrentTimeSeconds() >= frameDeadline;
+}
+
+bool JobSystem::ExecuteAQueuedJob(JobPriority lowestPriority)
+{
+	JobWorkerThread* executingWorker = s_currentWorkerThread;
+	Job* job = nullptr;
+
+	// Only a thread waiting on a background job asks for that lane, and it must be able to run it even past the frame deadline
+	if (executingWorker && executingWorker->m_owner == this)
+	{
+		job = WorkerClaimAQueuedJob(executingWorker, lowestPriority);
+	}
+	else if (m_numOfQueuedJobs > 0)
 	{
-		Job* claimedJob = m_queuedJobs.front();
-		m_queuedJobs.pop_front();
-		m_claimedJobsMutex.lock();
-		claimedJob->m_status = JobStatus::EXECUTING;
-		m_claimedJobs.push_back(claimedJob);
-		m_claimedJobsMutex.unlock();
-		m_queuedJobsMutex.unlock();
+		for (int lane = 0; lane <= static_cast<int>(lowestPriority) && !job; lane++)
+		{
+			if (m_laneCounters[lane].m_numOfQueuedJobs > 0)
+			{
+				// Outside threads borrow the victim's completion shard
+				job = StealJob(nullptr, lane, executingWorker);
+			}
+		}
 
-		return claimedJob;
+		if (job)
+		{
+			ClaimJob(job, executingWorker);
+		}
 	}
 
-	m_queuedJobsMutex.unlock();
-	return nullptr;
+	if (!job)
+		return false;
+
+	ExecuteJobOnThisThread(job);
+	WorkerCompleteAJob(executingWorker, job);
+
+	return true;
 }
 
-void JobSystem::WorkerCompleteAJob(JobWorkerThread* workerThread, Job* job)
+JobPriority JobSystem::GetCurrentJobPriority()
 {
-	UNUSED(workerThread);
+	return s_currentJob ? s_currentJob->GetPriority() : JobPriority::NORMAL;
+}
 
-	m_claimedJobsMutex.lock();
+void JobSystem::ExecuteJobsUntil(std::atomic<bool> const& isDone, JobPriority waitedPriority)
+{
+	while (!isDone)
+	{
+		if (!ExecuteAQueuedJob(waitedPriority))
+		{
+			std::this_thread::yield();
+		}
+	}
+}
 
-	for (auto jobIter = m_claimedJobs.begin(); jobIter != m_claimedJobs.end(); jobIter++)
+Job* JobSystem::WorkerClaimAQueuedJob(JobWorkerThread* workerThread, JobPriority lowestPriority)
+{
+	for (int lane = 0; lane <= static_cast<int>(lowestPriority); lane++)
 	{
-		if (*jobIter == job)
+		// The lane count is raised before a job is pushed, so an empty lane can be skipped without touching any queue
+		if (m_laneCounters[lane].m_numOfQueuedJobs == 0)
+			continue;
+
+		JobWorkerLane* workerLane = workerThread->m_lanes[lane];
+		Job* claimedJob = workerLane->m_localJobs.Pop();
+
+		if (!claimedJob)
+		{
+			workerLane->m_inboxMutex.lock();
+			claimedJob = workerLane->m_inboxJobs.PopFront();
+			workerLane->m_inboxMutex.unlock();
+		}
+
+		if (!claimedJob)
+		{
+			JobWorkerThread* victim = nullptr;
+			claimedJob = StealJob(workerThread, lane, victim);
+		}
+
+		if (claimedJob)
 		{
-			m_claimedJobs.erase(jobIter);
-			m_completedJobsMutex.lock();
-			job->m_status = JobStatus::COMPLETED;
-			m_completedJobs.push_back(job);
-			m_completedJobsMutex.unlock();
-			m_claimedJobsMutex.unlock();
-
-			return;
+			ClaimJob(claimedJob, workerThread);
+			return claimedJob;
 		}
 	}
 
-	m_claimedJobsMutex.unlock();
+	return nullptr;
 }
 
-bool JobSystem::RetrieveJob(Job* jobToRetrieve)
+void JobSystem::ClaimJob(Job* job, JobWorkerThread* workerThread)
+{
+	JobLaneCounters& laneCounters = m_laneCounters[static_cast<int>(job->m_priority)];
+	int64_t waitMicroseconds = static_cast<int64_t>((GetCurrentTimeSeconds() - job->m_queuedTime) * 1000000.0);
+
+	m_numOfQueuedJobs--;
+	laneCounters.m_numOfQueuedJobs--;
+	laneCounters.m_numOfStartedJobs++;
+	laneCounters.m_totalWaitMicroseconds += waitMicroseconds;
+	UpdateAtomicMaximum(laneCounters.m_maxWaitMicroseconds, waitMicroseconds);
+
+	job->m_workerID = workerThread->m_ID;
+	job->m_numOfPendingDependencies = 1;
+	job->m_status = JobStatus::EXECUTING;
+}
+
+Job* JobSystem::StealJob(JobWorkerThread* thief, int lane, JobWorkerThread*& out_victim)
 {
-	m_completedJobsMutex.lock();
+	size_t numOfWorkers = m_workerThreads.size();
+	size_t firstOffset = thief ? 1 : 0;
+	size_t startIndex = thief ? thief->m_ID - 1 : m_nextInboxIndex++;
 
-	for (auto jobIter = m_completedJobs.begin(); jobIter != m_completedJobs.end(); jobIter++)
+	for (size_t offset = firstOffset; offset < numOfWorkers; offset++)
 	{
-		if (*jobIter == jobToRetrieve)
+		JobWorkerThread* victim = m_workerThreads[(startIndex + offset) % numOfWorkers];
+		JobWorkerLane* victimLane = victim->m_lanes[lane];
+		out_victim = victim;
+
+		Job* stolenJob = victimLane->m_localJobs.Steal();
+
+		if (stolenJob)
+			return stolenJob;
+
+		if (victimLane->m_inboxMutex.try_lock())
 		{
-			m_completedJobs.erase(jobIter);
-			jobToRetrieve->m_status = JobStatus::RETIEVED;
-			m_completedJobsMutex.unlock();
+			stolenJob = victimLane->m_inboxJobs.PopFront();
+			victimLane->m_inboxMutex.unlock();
 
-			return true;
+			if (stolenJob)
+				return stolenJob;
 		}
 	}
 
-	m_completedJobsMutex.unlock();
+	return nullptr;
+}
 
-	return false;
+void JobSystem::WorkerCompleteAJob(JobWorkerThread* workerThread, Job* job)
+{
+	std::vector<Job*> continuations;
+
+	job->m_continuationsMutex.lock();
+	job->m_hasFinished = true;
+	continuations.swap(job->m_continuations);
+	job->m_continuationsMutex.unlock();
+
+	for (size_t index = 0; index < continuations.size(); index++)
+	{
+		if (--continuations[index]->m_numOfPendingDependencies == 0)
+		{
+			EnqueueJob(continuations[index]);
+		}
+	}
+
+	if (job->m_isRetrievable)
+	{
+		job->OnCompleted();
+
+		workerThread->m_completedJobsMutex.lock();
+		job->m_status = JobStatus::COMPLETED;
+		workerThread->m_completedJobs.PushBack(job);
+		workerThread->m_completedJobsMutex.unlock();
+	}
+	else
+	{
+		// Nobody retrieves this job, so OnCompleted is the last point the JobSystem touches it
+		job->m_status = JobStatus::RETIEVED;
+		job->OnCompleted();
+	}
+}
+
+void JobSystem::WorkerWaitForJobs(JobWorkerThread* workerThread)
+{
+	UNUSED(workerThread);
+
+	std::unique_lock<std::mutex> lock(m_idleMutex);
+
+	m_numOfIdleWorkers++;
+	m_idleCondition.wait(lock, [this]() { return m_isQuitting || HasClaimableJobs(); });
+	m_numOfIdleWorkers--;
+}
+
+bool JobSystem::HasClaimableJobs() const
+{
+	if (!IsPastFrameDeadline())
+		return m_numOfQueuedJobs > 0;
+
+	return m_laneCounters[static_cast<int>(JobPriority::HIGH)].m_numOfQueuedJobs > 0 || m_laneCounters[static_cast<int>(JobPriority::NORMAL)].m_numOfQueuedJobs > 0;
+}
+
+void JobSystem::WakeIdleWorker()
+{
+	if (m_numOfIdleWorkers > 0)
+	{
+		m_idleMutex.lock();
+		m_idleCondition.notify_one();
+		m_idleMutex.unlock();
+	}
+}
+
+bool JobSystem::RetrieveJob(Job* jobToRetrieve)
+{
+	if (jobToRetrieve->m_status != JobStatus::COMPLETED)
+		return false;
+
+	JobWorkerThread* workerThread = m_workerThreads[jobToRetrieve->m_workerID - 1];
+	std::lock_guard<std::mutex> lock(workerThread->m_completedJobsMutex);
+
+	if (!workerThread->m_completedJobs.Remove(jobToRetrieve))
+		return false;
+
+	jobToRetrieve->m_status = JobStatus::RETIEVED;
+	jobToRetrieve->ResetDependencies();
+
+	return true;
 }
 
 Job* JobSystem::RetrieveJob()
 {
-	std::lock_guard<std::mutex> lock(m_completedJobsMutex);
+	size_t numOfWorkers = m_workerThreads.size();
+	unsigned int startIndex = m_nextCompletedIndex++;
 
-	if(m_completedJobs.empty())
-		return nullptr;
+	for (size_t offset = 0; offset < numOfWorkers; offset++)
+	{
+		JobWorkerThread* workerThread = m_workerThreads[(startIndex + offset) % numOfWorkers];
+		std::lock_guard<std::mutex> lock(workerThread->m_completedJobsMutex);
 
-	Job* job = m_completedJobs.front();
-	m_completedJobs.pop_front();
-	job->m_status = JobStatus::RETIEVED;
+		Job* job = workerThread->m_completedJobs.PopFront();
 
-	return job;
+		if (job)
+		{
+			job->m_status = JobStatus::RETIEVED;
+			job->ResetDependencies();
+
+			return job;
+		}
+	}
+
+	return nullptr;
 }
 
 void JobSystem::BeginFrame()
 {
+	for (int lane = 0; lane < NUM_JOB_PRIORITIES; lane++)
+	{
+		JobLaneCounters& laneCounters = m_laneCounters[lane];
+
+		laneCounters.m_peakNumOfQueuedJobs = laneCounters.m_numOfQueuedJobs.load();
+		laneCounters.m_numOfStartedJobs = 0;
+		laneCounters.m_totalWaitMicroseconds = 0;
+		laneCounters.m_maxWaitMicroseconds = 0;
+	}
+
+	if (m_config.m_backgroundFrameBudgetSeconds > 0.0)
+	{
+		SetFrameDeadline(GetCurrentTimeSeconds() + m_config.m_backgroundFrameBudgetSeconds);
+	}
 }
 
 void JobSystem::EndFrame()
 {
-}
+	if (m_config.m_backgroundFrameBudgetSeconds > 0.0)
+	{
+		ClearFrameDeadline();
+	}
+}
\ No newline at end of file
@@ -1,8 +1,16 @@
 #pragma once
 
-#include <deque>
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/JobAllocator.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <mutex>
+#include <new>
 #include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 class JobSystem;
@@ -10,32 +18,219 @@ class JobSystem;
 enum class JobStatus
 {
 	NO_RECORD = -1,
+	WAITING,
 	QUEUED,
 	EXECUTING,
 	COMPLETED,
 	RETIEVED
 };
 
+// Workers always drain higher lanes first. BACKGROUND jobs are not started once the frame deadline has passed.
+enum class JobPriority
+{
+	HIGH,
+	NORMAL,
+	BACKGROUND,
+	NUM_JOB_PRIORITIES
+};
+
+constexpr int NUM_JOB_PRIORITIES = static_cast<int>(JobPriority::NUM_JOB_PRIORITIES);
+
 class Job
 {
 public:
 	std::atomic<JobStatus> m_status = JobStatus::NO_RECORD;
+protected:
+	unsigned int m_workerID = 0;
+	bool m_isRetrievable = true;
+	JobPriority m_priority = JobPriority::NORMAL;
+	double m_queuedTime = 0.0;
+	Job* m_nextListedJob = nullptr;
+
+	std::atomic<int> m_numOfPendingDependencies = 1;
+	std::atomic<bool> m_hasFinished = false;
+	std::mutex m_continuationsMutex;
+	std::vector<Job*> m_continuations;
 public:
 	Job() = default;
 	virtual ~Job() = default;
 
 	virtual void Execute() = 0;
+
+	// Dependencies must be declared before the dependent job is added to the JobSystem.
+	// A predecessor that has already run counts as satisfied until it is retrieved or reset.
+	// Avoid waiting on a job that depends on a lower lane: helping threads never start jobs below the lane they wait on.
+	void AddDependency(Job* predecessor);
+	void AddContinuation(Job* continuation);
+	void ResetDependencies();
+
+	void SetPriority(JobPriority priority);
+	JobPriority GetPriority() const;
+protected:
+	virtual void OnCompleted() {}
+private:
+	friend class JobSystem;
+	friend class JobList;
+};
+
+// Intrusive FIFO linked through the jobs themselves, so queuing never allocates. A job can be on one list at a time.
+class JobList
+{
+	Job* m_head = nullptr;
+	Job* m_tail = nullptr;
+public:
+	bool IsEmpty() const;
+
+	void PushBack(Job* job);
+	Job* PopFront();
+	bool Remove(Job* job);
+};
+
+template <typename ResultType>
+struct JobResultStorage
+{
+	ResultType m_value = ResultType();
+};
+
+template <>
+struct JobResultStorage<void>
+{
+};
+
+// Shared state behind a JobFuture. The job carries its own result and lives in pooled job memory.
+// It is reference counted by its futures plus the JobSystem while it is queued, and freed by the last release.
+template <typename ResultType>
+class FutureJob : public Job
+{
+protected:
+	std::atomic<bool> m_isReady = false;
+	std::atomic<int> m_numOfReferences = 0;
+	JobResultStorage<ResultType> m_result;
+public:
+	FutureJob()
+	{
+		m_isRetrievable = false;
+	}
+
+	void AddReference()
+	{
+		m_numOfReferences++;
+	}
+
+	void ReleaseReference()
+	{
+		if (--m_numOfReferences == 0)
+		{
+			void* memory = dynamic_cast<void*>(this);
+			this->~FutureJob();
+			FreeJobMemory(memory);
+		}
+	}
+protected:
+	virtual void OnCompleted() override
+	{
+		m_isReady = true;
+		ReleaseReference();
+	}
+private:
+	template <typename> friend class JobFuture;
+	friend class JobSystem;
+};
+
+template <typename Func, typename ResultType>
+class FunctionJob : public FutureJob<ResultType>
+{
+	Func m_func;
+public:
+	template <typename FuncArg>
+	explicit FunctionJob(FuncArg&& func)
+		: m_func(std::forward<FuncArg>(func))
+	{
+	}
+
+	virtual void Execute() override
+	{
+		if constexpr (std::is_void_v<ResultType>)
+		{
+			m_func();
+		}
+		else
+		{
+			this->m_result.m_value = m_func();
+		}
+	}
+};
+
+// Lightweight handle to a job started with JobSystem::Submit. Copies share the same result.
+template <typename ResultType>
+class JobFuture
+{
+	FutureJob<ResultType>* m_job = nullptr;
+	JobSystem* m_jobSystem = nullptr;
+public:
+	JobFuture() = default;
+	JobFuture(FutureJob<ResultType>* job, JobSystem* jobSystem);
+	JobFuture(JobFuture const& copy);
+	JobFuture(JobFuture&& other) noexcept;
+	~JobFuture();
+
+	JobFuture& operator=(JobFuture const& copy);
+	JobFuture& operator=(JobFuture&& other) noexcept;
+
+	bool IsValid() const;
+	bool IsReady() const;
+
+	// Runs other queued jobs on the calling thread until this one is done
+	void Wait() const;
+	ResultType Get() const;
+};
+
+// Chase-Lev work-stealing deque. Only the owning worker may Push/Pop (LIFO end), any thread may Steal (FIFO end).
+class JobDeque
+{
+	std::atomic<int64_t> m_top = 0;
+	std::atomic<int64_t> m_bottom = 0;
+	std::vector<std::atomic<Job*>> m_buffer;
+	int64_t m_mask = 0;
+public:
+	explicit JobDeque(int capacity);
+	JobDeque(JobDeque const& copy) = delete;
+
+	bool Push(Job* job);
+	Job* Pop();
+	Job* Steal();
+
+	size_t GetSize() const;
+};
+
+// One priority lane of a worker: a work-stealing deque for jobs it spawns and a locked inbox for jobs from outside the pool
+struct JobWorkerLane
+{
+	JobDeque m_localJobs;
+
+	std::mutex m_inboxMutex;
+	JobList m_inboxJobs;
+
+	explicit JobWorkerLane(int localQueueCapacity);
 };
 
 class JobWorkerThread
 {
 	unsigned int m_ID = 0;
 	JobSystem* m_owner = nullptr;
-	std::thread* m_workerThread;
+	std::thread* m_workerThread = nullptr;
+
+	JobWorkerLane* m_lanes[NUM_JOB_PRIORITIES] = {};
+
+	std::mutex m_completedJobsMutex;
+	JobList m_completedJobs;
 public:
-	JobWorkerThread(JobSystem* owner, unsigned int id);
+	JobWorkerThread(JobSystem* owner, unsigned int id, int localQueueCapacity);
 	~JobWorkerThread();
 
+	void StartUp();
+	void ShutDown();
+
 	void ThreadMain();
 private:
 	friend class JobSystem;
@@ -44,21 +239,47 @@ private:
 struct JobSystemConfig
 {
 	int m_numOfWorkerThreads = 0;
+	int m_localQueueCapacity = 4096;
+
+	// When positive, BeginFrame sets the frame deadline this many seconds ahead and EndFrame clears it
+	double m_backgroundFrameBudgetSeconds = 0.0;
+};
+
+// Queue depth is live. The remaining counters cover the current frame and are reset by BeginFrame.
+struct JobLaneStats
+{
+	size_t m_numOfQueuedJobs = 0;
+	size_t m_peakNumOfQueuedJobs = 0;
+	size_t m_numOfStartedJobs = 0;
+	double m_totalWaitSeconds = 0.0;
+	double m_maxWaitSeconds = 0.0;
+};
+
+struct JobLaneCounters
+{
+	std::atomic<size_t> m_numOfQueuedJobs = 0;
+	std::atomic<size_t> m_peakNumOfQueuedJobs = 0;
+	std::atomic<size_t> m_numOfStartedJobs = 0;
+	std::atomic<int64_t> m_totalWaitMicroseconds = 0;
+	std::atomic<int64_t> m_maxWaitMicroseconds = 0;
 };
 
 class JobSystem
 {
 	JobSystemConfig m_config;
 
-	std::mutex m_queuedJobsMutex;
-	std::mutex m_claimedJobsMutex;
-	std::mutex m_completedJobsMutex;
-
 	std::vector<JobWorkerThread*> m_workerThreads;
 
-	std::deque<Job*> m_queuedJobs;
-	std::deque<Job*> m_claimedJobs;
-	std::deque<Job*> m_completedJobs;
+	std::atomic<size_t> m_numOfQueuedJobs = 0;
+	std::atomic<unsigned int> m_nextInboxIndex = 0;
+	std::atomic<unsigned int> m_nextCompletedIndex = 0;
+
+	std::mutex m_idleMutex;
+	std::condition_variable m_idleCondition;
+	std::atomic<int> m_numOfIdleWorkers = 0;
+
+	JobLaneCounters m_laneCounters[NUM_JOB_PRIORITIES];
+	std::atomic<double> m_frameDeadline = 0.0;
 protected:
 	std::atomic<bool> m_isQuitting = false;
 public:
@@ -72,12 +293,165 @@ public:
 
 	void AddJob(Job* jobToAdd);
 
+	// Runs func() as a job and returns a future for its result. Runs it inline if there are no worker threads.
+	template <typename Func>
+	JobFuture<std::invoke_result_t<std::decay_t<Func>&>> Submit(Func&& func, JobPriority priority = JobPriority::NORMAL);
+
 	size_t GetNumOfQueuedJobs();
+	size_t GetNumOfQueuedJobs(JobPriority priority) const;
+	int GetNumOfWorkerThreads() const;
+	JobLaneStats GetLaneStats(JobPriority priority) const;
+
+	// Deadline is in GetCurrentTimeSeconds() time; 0 means no deadline. Long background jobs can poll IsPastFrameDeadline to yield early.
+	void SetFrameDeadline(double deadlineSeconds);
+	void ClearFrameDeadline();
+	bool IsPastFrameDeadline() const;
+
+	// Runs one queued job from the lanes at or above lowestPriority on the calling thread, which need not be a worker.
+	// Returns false if none was available.
+	bool ExecuteAQueuedJob(JobPriority lowestPriority = JobPriority::NORMAL);
+	// Priority of the job running on the calling thread, or NORMAL when it is not inside a job
+	static JobPriority GetCurrentJobPriority();
+	// Helps with jobs at or above waitedPriority, the lane of the job being waited on, so a waiting thread never picks up
+	// a long job from a lower lane
+	void ExecuteJobsUntil(std::atomic<bool> const& isDone, JobPriority waitedPriority);
 
-	Job* WorkerClaimAQueuedJob(JobWorkerThread* workerThread);
+	Job* WorkerClaimAQueuedJob(JobWorkerThread* workerThread, JobPriority lowestPriority);
 	void WorkerCompleteAJob(JobWorkerThread* workerThread, Job* job);
+	void WorkerWaitForJobs(JobWorkerThread* workerThread);
 	bool RetrieveJob(Job* jobToRetrieve);
 	Job* RetrieveJob();
+private:
+	void EnqueueJob(Job* job);
+	void WakeIdleWorker();
+	bool HasClaimableJobs() const;
+	Job* StealJob(JobWorkerThread* thief, int lane, JobWorkerThread*& out_victim);
+	void ClaimJob(Job* job, JobWorkerThread* workerThread);
 private:
 	friend class JobWorkerThread;
-};
\ No newline at end of file
+};
+
+template <typename Func>
+JobFuture<std::invoke_result_t<std::decay_t<Func>&>> JobSystem::Submit(Func&& func, JobPriority priority)
+{
+	using ResultType = std::invoke_result_t<std::decay_t<Func>&>;
+
+	using JobType = FunctionJob<std::decay_t<Func>, ResultType>;
+
+	static_assert(alignof(JobType) <= JOB_BLOCK_HEADER_SIZE, "Submitted callable is over-aligned for job memory!");
+
+	JobType* job = new (AllocateJobMemory(sizeof(JobType))) JobType(std::forward<Func>(func));
+	JobFuture<ResultType> future(job, this);
+
+	if (m_workerThreads.empty())
+	{
+		job->Execute();
+		job->m_status = JobStatus::RETIEVED;
+		job->m_isReady = true;
+	}
+	else
+	{
+		job->m_priority = priority;
+		job->AddReference();
+		AddJob(job);
+	}
+
+	return future;
+}
+
+template <typename ResultType>
+JobFuture<ResultType>::JobFuture(FutureJob<ResultType>* job, JobSystem* jobSystem)
+	: m_job(job), m_jobSystem(jobSystem)
+{
+	if (m_job)
+	{
+		m_job->AddReference();
+	}
+}
+
+template <typename ResultType>
+JobFuture<ResultType>::JobFuture(JobFuture const& copy)
+	: JobFuture(copy.m_job, copy.m_jobSystem)
+{
+}
+
+template <typename ResultType>
+JobFuture<ResultType>::JobFuture(JobFuture&& other) noexcept
+	: m_job(other.m_job), m_jobSystem(other.m_jobSystem)
+{
+	other.m_job = nullptr;
+}
+
+template <typename ResultType>
+JobFuture<ResultType>::~JobFuture()
+{
+	if (m_job)
+	{
+		m_job->ReleaseReference();
+	}
+}
+
+template <typename ResultType>
+JobFuture<ResultType>& JobFuture<ResultType>::operator=(JobFuture const& copy)
+{
+	JobFuture temp(copy);
+	return *this = std::move(temp);
+}
+
+template <typename ResultType>
+JobFuture<ResultType>& JobFuture<ResultType>::operator=(JobFuture&& other) noexcept
+{
+	if (this != &other)
+	{
+		if (m_job)
+		{
+			m_job->ReleaseReference();
+		}
+
+		m_job = other.m_job;
+		m_jobSystem = other.m_jobSystem;
+		other.m_job = nullptr;
+	}
+
+	return *this;
+}
+
+template <typename ResultType>
+bool JobFuture<ResultType>::IsValid() const
+{
+	return m_job != nullptr;
+}
+
+template <typename ResultType>
+bool JobFuture<ResultType>::IsReady() const
+{
+	return m_job && m_job->m_isReady;
+}
+
+template <typename ResultType>
+void JobFuture<ResultType>::Wait() const
+{
+	if (m_job)
+	{
+		m_jobSystem->ExecuteJobsUntil(m_job->m_isReady, m_job->m_priority);
+	}
+}
+
+template <typename ResultType>
+ResultType JobFuture<ResultType>::Get() const
+{
+	GUARANTEE_OR_DIE(m_job != nullptr, "Cannot get the result of an empty JobFuture!");
+
+	Wait();
+
+	if constexpr (std::is_void_v<ResultType>)
+	{
+		return;
+	}
+	else
+	{
+		return m_job->m_result.m_value;
+	}
+}
+
+extern JobSystem* g_theJobSystem;
\ No newline at end of file
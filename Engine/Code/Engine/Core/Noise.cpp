@@ -3,7 +3,12 @@
 #include "ThirdParty/Squirrel/SmoothNoise.hpp"
 
 #include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/FloatRange.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Core/ParallelFor.hpp"
+
+#include <algorithm>
+#include <cfloat>
 
 NoiseMap Noise::GenerateNoiseMap(int mapWidth, int mapHeight, int seed, float scale, int octaves, float persistance, float lacunarity, Vec2 offset)
 {
@@ -28,7 +33,7 @@ NoiseMap Noise::GenerateNoiseMap(int mapWidth, int mapHeight, int seed, float sc
 		noiseMap[height].resize(mapWidth);
 	}
 
-	RandomNumberGenerator rng = RandomNumberGenerator();
+	RandomNumberGenerator rng = RandomNumberGenerator(static_cast<unsigned int>(seed));
 
 	Vec2* octaveOffsets = new Vec2[octaves];
 
@@ -43,16 +48,13 @@ NoiseMap Noise::GenerateNoiseMap(int mapWidth, int mapHeight, int seed, float sc
 	if(scale <= 0)
 		scale = 0.0001f;
 
-	float maxNoiseHeight = FLT_MIN;
-	float minNoiseHeight = FLT_MAX;
-
 	float halfWidth = mapWidth * 0.5f;
 	float halfHeight = mapHeight * 0.5f;
 
 	float factor = 1.0f / scale;
 
-	// Generate the noise map values;
-	for (int y = 0; y < mapHeight; y++)
+	// Generate the noise map values, one row per task;
+	ParallelFor(0, mapHeight, 0, [&](int y)
 	{
 		for (int x = 0; x < mapWidth; x++)
 		{
@@ -72,26 +74,36 @@ NoiseMap Noise::GenerateNoiseMap(int mapWidth, int mapHeight, int seed, float sc
 				frequency *= lacunarity;
 			}
 
-			if (noiseHeight > maxNoiseHeight)
-			{
-				maxNoiseHeight = noiseHeight;
-			}
-			else if (noiseHeight < minNoiseHeight)
-			{
-				minNoiseHeight = noiseHeight;
-			}
-
 			noiseMap[y][x] = noiseHeight;
 		}
-	}
+	});
+
+	FloatRange noiseHeightRange = ParallelReduce(0, mapHeight, 0, FloatRange(FLT_MAX, -FLT_MAX), [&](int y)
+	{
+		FloatRange rowRange = FloatRange(FLT_MAX, -FLT_MAX);
+
+		for (int x = 0; x < mapWidth; x++)
+		{
+			rowRange.m_min = std::min(rowRange.m_min, noiseMap[y][x]);
+			rowRange.m_max = std::max(rowRange.m_max, noiseMap[y][x]);
+		}
 
-	for (int y = 0; y < mapHeight; y++)
+		return rowRange;
+	},
+	[](FloatRange const& a, FloatRange const& b)
+	{
+		return FloatRange(std::min(a.m_min, b.m_min), std::max(a.m_max, b.m_max));
+	});
+
+	ParallelFor(0, mapHeight, 0, [&](int y)
 	{
 		for (int x = 0; x < mapWidth; x++)
 		{
-			noiseMap[y][x] = RangeMapClamped(noiseMap[y][x], minNoiseHeight, maxNoiseHeight, 0.0f, 1.0f);
+			noiseMap[y][x] = RangeMapClamped(noiseMap[y][x], noiseHeightRange.m_min, noiseHeightRange.m_max, 0.0f, 1.0f);
 		}
-	}
+	});
+
+	delete[] octaveOffsets;
 
 	return noiseMap;
 }
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "Engine/Core/JobSystem.hpp"
+
+// Wraps a callable as a Job that lives on the stack of the thread that split the work
+template <typename TaskFunc>
+class ParallelTaskJob : public Job
+{
+	TaskFunc const& m_task;
+	std::atomic<bool> m_isDone = false;
+public:
+	ParallelTaskJob(TaskFunc const& task, JobPriority priority)
+		: m_task(task)
+	{
+		m_isRetrievable = false;
+		SetPriority(priority);
+	}
+
+	virtual void Execute() override
+	{
+		m_task();
+	}
+
+	// Helps run other queued jobs until this one finishes, so nested splits never starve the pool
+	void Wait(JobSystem* jobSystem)
+	{
+		jobSystem->ExecuteJobsUntil(m_isDone, m_priority);
+	}
+protected:
+	virtual void OnCompleted() override
+	{
+		m_isDone = true;
+	}
+};
+
+inline int GetParallelGrainSize(int count, int grain, JobSystem* jobSystem)
+{
+	if (grain > 0)
+		return grain;
+
+	// Aim for a few chunks per thread so stealing can balance uneven work
+	int numOfThreads = jobSystem->GetNumOfWorkerThreads() + 1;
+	int autoGrain = count / (8 * numOfThreads);
+
+	return autoGrain > 1 ? autoGrain : 1;
+}
+
+inline bool CanRunInParallel(JobSystem* jobSystem)
+{
+	return jobSystem && jobSystem->GetNumOfWorkerThreads() > 0;
+}
+
+template <typename RangeFunc>
+void ParallelForRange(JobSystem* jobSystem, int begin, int end, int grain, JobPriority priority, RangeFunc const& rangeFunc)
+{
+	if (end - begin <= grain)
+	{
+		rangeFunc(begin, end);
+		return;
+	}
+
+	int middle = begin + (end - begin) / 2;
+
+	auto rightHalf = [&]() { ParallelForRange(jobSystem, middle, end, grain, priority, rangeFunc); };
+	ParallelTaskJob<decltype(rightHalf)> rightJob(rightHalf, priority);
+	jobSystem->AddJob(&rightJob);
+
+	ParallelForRange(jobSystem, begin, middle, grain, priority, rangeFunc);
+
+	rightJob.Wait(jobSystem);
+}
+
+// Calls func(index) for every index in [begin, end), splitting the range across the calling thread and the JobSystem workers.
+// A grain of 0 or less picks a chunk size from the range length and worker count. The split jobs run in the lane of the job
+// calling ParallelFor, so background work stays out of the frame-critical lanes.
+template <typename Func>
+void ParallelFor(int begin, int end, int grain, Func const& func, JobSystem* jobSystem = g_theJobSystem, JobPriority priority = JobSystem::GetCurrentJobPriority())
+{
+	if (end <= begin)
+		return;
+
+	if (!CanRunInParallel(jobSystem))
+	{
+		for (int index = begin; index < end; index++)
+		{
+			func(index);
+		}
+
+		return;
+	}
+
+	auto rangeFunc = [&](int rangeBegin, int rangeEnd)
+	{
+		for (int index = rangeBegin; index < rangeEnd; index++)
+		{
+			func(index);
+		}
+	};
+
+	ParallelForRange(jobSystem, begin, end, GetParallelGrainSize(end - begin, grain, jobSystem), priority, rangeFunc);
+}
+
+template <typename T, typename MapFunc, typename ReduceFunc>
+T ParallelReduceRange(JobSystem* jobSystem, int begin, int end, int grain, JobPriority priority, T const& identity, MapFunc const& mapFunc, ReduceFunc const& reduceFunc)
+{
+	if (end - begin <= grain)
+	{
+		T result = identity;
+
+		for (int index = begin; index < end; index++)
+		{
+			result = reduceFunc(result, mapFunc(index));
+		}
+
+		return result;
+	}
+
+	int middle = begin + (end - begin) / 2;
+
+	T rightResult = identity;
+	auto rightHalf = [&]() { rightResult = ParallelReduceRange(jobSystem, middle, end, grain, priority, identity, mapFunc, reduceFunc); };
+	ParallelTaskJob<decltype(rightHalf)> rightJob(rightHalf, priority);
+	jobSystem->AddJob(&rightJob);
+
+	T leftResult = ParallelReduceRange(jobSystem, begin, middle, grain, priority, identity, mapFunc, reduceFunc);
+
+	rightJob.Wait(jobSystem);
+
+	return reduceFunc(leftResult, rightResult);
+}
+
+// Combines mapFunc(index) for every index in [begin, end) with reduceFunc, which must be associative.
+// Partial results are always combined in index order. Split jobs inherit the caller's lane like ParallelFor.
+template <typename T, typename MapFunc, typename ReduceFunc>
+T ParallelReduce(int begin, int end, int grain, T const& identity, MapFunc const& mapFunc, ReduceFunc const& reduceFunc, JobSystem* jobSystem = g_theJobSystem, JobPriority priority = JobSystem::GetCurrentJobPriority())
+{
+	if (end <= begin)
+		return identity;
+
+	if (!CanRunInParallel(jobSystem))
+	{
+		T result = identity;
+
+		for (int index = begin; index < end; index++)
+		{
+			result = reduceFunc(result, mapFunc(index));
+		}
+
+		return result;
+	}
+
+	return ParallelReduceRange(jobSystem, begin, end, GetParallelGrainSize(end - begin, grain, jobSystem), priority, identity, mapFunc, reduceFunc);
+}
\ No newline at end of file
@@ -6,63 +6,137 @@
 #include "Engine/Math/OBB2.hpp"
 #include "Engine/Math/OBB3.hpp"
 #include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/SimdUtils.hpp"
 
 #include "Engine/Core/Vertex_PCU.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/Vertex_PCUTBN.hpp"
 #include "Engine/Core/MeshVertex_PCU.hpp"
+#include "Engine/Core/ParallelFor.hpp"
 
-void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, float uniformScaleXY, float rotationDegreesAboutZ, Vec2 const& translationXY)
+constexpr int VERTEX_PARALLEL_GRAIN = 4096;
+
+// Shared by the XY transforms. Copies each vertex when in and out differ, then rewrites x and y from the basis;
+// the SIMD path gathers four positions into x and y lanes and sums in the same order as the scalar tail.
+static void TransformVertsXY3D(int numVerts, Vertex_PCU const* inVerts, Vertex_PCU* outVerts, Vec2 const& iBasis, Vec2 const& jBasis, Vec2 const& translationXY)
 {
-	for (int index = 0; index < numVerts; index++)
+	if (inVerts != outVerts)
 	{
-		Vec3& position = verts[index].m_position;
+		for (int index = 0; index < numVerts; index++)
+		{
+			outVerts[index] = inVerts[index];
+		}
+	}
+
+	int index = 0;
 
-		float thetaRadians = static_cast<float>(atan2(position.y, position.x));
-		float distanceXY = sqrtf((position.x * position.x) + (position.y * position.y));
+#if defined(ENGINE_SIMD_SSE2)
+	__m128 ix = _mm_set1_ps(iBasis.x);
+	__m128 iy = _mm_set1_ps(iBasis.y);
+	__m128 jx = _mm_set1_ps(jBasis.x);
+	__m128 jy = _mm_set1_ps(jBasis.y);
+	__m128 tx = _mm_set1_ps(translationXY.x);
+	__m128 ty = _mm_set1_ps(translationXY.y);
 
-		float rotateRadians = rotationDegreesAboutZ * (3.14f / 180.0f);
-		thetaRadians += rotateRadians;
+	for (; index + 4 <= numVerts; index += 4)
+	{
+		Vertex_PCU* verts = &outVerts[index];
 
-		distanceXY *= uniformScaleXY;
+		__m128 x = _mm_setr_ps(verts[0].m_position.x, verts[1].m_position.x, verts[2].m_position.x, verts[3].m_position.x);
+		__m128 y = _mm_setr_ps(verts[0].m_position.y, verts[1].m_position.y, verts[2].m_position.y, verts[3].m_position.y);
 
-		position.x = distanceXY * cosf(thetaRadians);
-		position.y = distanceXY * sinf(thetaRadians);
+		float resultX[4];
+		float resultY[4];
+		_mm_storeu_ps(resultX, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, ix), _mm_mul_ps(y, jx)), tx));
+		_mm_storeu_ps(resultY, _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, iy), _mm_mul_ps(y, jy)), ty));
+
+		for (int lane = 0; lane < 4; lane++)
+		{
+			verts[lane].m_position.x = resultX[lane];
+			verts[lane].m_position.y = resultY[lane];
+		}
+	}
+#endif
+
+	for (; index < numVerts; index++)
+	{
+		Vec3& position = outVerts[index].m_position;
+		float x = position.x;
+		float y = position.y;
 
-		position.x += translationXY.x;
-		position.y += translationXY.y;
+		position.x = ((x * iBasis.x) + (y * jBasis.x)) + translationXY.x;
+		position.y = ((x * iBasis.y) + (y * jBasis.y)) + translationXY.y;
 	}
 }
 
+void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, float uniformScaleXY, float rotationDegreesAboutZ, Vec2 const& translationXY)
+{
+	TransformVertexArrayXY3D(numVerts, verts, verts, uniformScaleXY, rotationDegreesAboutZ, translationXY);
+}
+
+void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, Vec2 const& iBasis, Vec2 const& jBasis, Vec2 const& translationXY)
+{
+	TransformVertsXY3D(numVerts, verts, verts, iBasis, jBasis, translationXY);
+}
+
+void TransformVertexArrayXY3D(int numVerts, Vertex_PCU const* localVerts, Vertex_PCU* worldVerts, float uniformScaleXY, float rotationDegreesAboutZ, Vec2 const& translationXY)
+{
+	// One sin/cos per call instead of an atan2, sqrt, sin and cos per vertex
+	float sine;
+	float cosine;
+	FastSinCosDegrees(rotationDegreesAboutZ, sine, cosine);
+
+	sine *= uniformScaleXY;
+	cosine *= uniformScaleXY;
+
+	TransformVertsXY3D(numVerts, localVerts, worldVerts, Vec2(cosine, sine), Vec2(-sine, cosine), translationXY);
+}
+
+// Splits a vertex array into chunks of VERTEX_PARALLEL_GRAIN for the JobSystem; each chunk runs the Mat44 batch transforms
+template <typename VertexType, typename ChunkFunc>
+static void ForEachVertexChunk(std::vector<VertexType>& verts, ChunkFunc const& chunkFunc)
+{
+	int numOfVerts = static_cast<int>(verts.size());
+	int numOfChunks = (numOfVerts + VERTEX_PARALLEL_GRAIN - 1) / VERTEX_PARALLEL_GRAIN;
+
+	ParallelFor(0, numOfChunks, 1, [&](int chunkIndex)
+	{
+		int begin = chunkIndex * VERTEX_PARALLEL_GRAIN;
+		int count = numOfVerts - begin < VERTEX_PARALLEL_GRAIN ? numOfVerts - begin : VERTEX_PARALLEL_GRAIN;
+
+		chunkFunc(&verts[begin], count);
+	});
+}
+
 void TransformVertexArray3D(std::vector<Vertex_PCU>& verts, Mat44 const& transform)
 {
-	for (size_t index = 0; index < verts.size(); index++)
+	ForEachVertexChunk(verts, [&](Vertex_PCU* chunk, int count)
 	{
-		verts[index].m_position = transform.TransformPosition3D(verts[index].m_position);
-	}
+		transform.TransformPositions3D(&chunk->m_position, &chunk->m_position, count, sizeof(Vertex_PCU));
+	});
 }
 
 void TransformVertexArray3D(std::vector<Vertex_PCUTBN>& verts, Mat44 const& transform, bool willTransformNormals)
 {
-	for (size_t index = 0; index < verts.size(); index++)
+	ForEachVertexChunk(verts, [&](Vertex_PCUTBN* chunk, int count)
 	{
-		verts[index].m_position = transform.TransformPosition3D(verts[index].m_position);
+		transform.TransformPositions3D(&chunk->m_position, &chunk->m_position, count, sizeof(Vertex_PCUTBN));
 
 		if (willTransformNormals)
 		{
-			verts[index].m_normal = transform.TransformVectorQuantity3D(verts[index].m_normal);
+			transform.TransformVectorQuantities3D(&chunk->m_normal, &chunk->m_normal, count, sizeof(Vertex_PCUTBN));
 		}
-	}
+	});
 }
 
 void TransformVertexArray3D(std::vector<MeshVertex_PCU>& verts, Mat44 const& transform, bool willTransformNormals)
 {
 	UNUSED(willTransformNormals);
 
-	for (size_t index = 0; index < verts.size(); index++)
+	ForEachVertexChunk(verts, [&](MeshVertex_PCU* chunk, int count)
 	{
-		verts[index].m_position = transform.TransformPosition3D(verts[index].m_position);
-	}
+		transform.TransformPositions3D(&chunk->m_position, &chunk->m_position, count, sizeof(MeshVertex_PCU));
+	});
 }
 
 void AddVertsForDirectedSector2D(std::vector<Vertex_PCU>& vertices, Vec2 const& sectorTip, Vec2 const& sectorForwardNormal, float sectorApertureDegrees, float sectorRadius, Rgba8 const& color)
@@ -225,14 +299,24 @@ void AddVertsForDisc2D(std::vector<Vertex_PCU>& vertices, Vec2 const& center, fl
 	constexpr int NUM_BONE_TRI = 64;
 	//constexpr int NUM_BONE_VERT = 3 * NUM_BONE_TRI;
 
-	for (int index = 0; index < NUM_BONE_TRI; index++)
+	// The whole rim in one batched pass; 360 degrees lands exactly on 0 so the seam closes
+	float rimDegrees[NUM_BONE_TRI + 1];
+	float rimSines[NUM_BONE_TRI + 1];
+	float rimCosines[NUM_BONE_TRI + 1];
+
+	float theta = 360.0f / static_cast<float>(NUM_BONE_TRI);
+
+	for (int index = 0; index <= NUM_BONE_TRI; index++)
 	{
-		float theta = 360.0f / static_cast<float>(NUM_BONE_TRI);
+		rimDegrees[index] = theta * index;
+	}
 
-		float angle1 = theta * index;
-		float angle2 = theta * (index + 1);
-			Vec2 vert1 = Vec2(radius * CosDegrees(angle1), radius * SinDegrees(angle1));
-			Vec2 vert2 = Vec2(radius * CosDegrees(angle2), radius * SinDegrees(angle2));
+	FastSinCosDegrees(rimDegrees, rimSines, rimCosines, NUM_BONE_TRI + 1);
+
+	for (int index = 0; index < NUM_BONE_TRI; index++)
+	{
+			Vec2 vert1 = Vec2(radius * rimCosines[index], radius * rimSines[index]);
+			Vec2 vert2 = Vec2(radius * rimCosines[index + 1], radius * rimSines[index + 1]);
 
 			vert1 += center;
 			vert2 += center;
@@ -762,14 +846,16 @@ void AddVertsForZSphere(std::vector<Vertex_PCUTBN>& verts, std::vector<unsigned
 	{
 		currentRow.clear();
 		float phi = stackAngle * yy - 90.0f;
-		float cosPhi = CosDegrees(phi);
-		float sinPhi = SinDegrees(phi);
+		float cosPhi;
+		float sinPhi;
+		FastSinCosDegrees(phi, sinPhi, cosPhi);
 
 		for (int xx = 0; xx <= numLongitudeSlices; xx++)
 		{
 			float theta = sliceAngle * xx;
-			float cosTheta = CosDegrees(theta);
-			float sinTheta = SinDegrees(theta);
+			float cosTheta;
+			float sinTheta;
+			FastSinCosDegrees(theta, sinTheta, cosTheta);
 
 			Vertex_PCUTBN currentVert;
 
@@ -1275,10 +1361,9 @@ void CalculateTangentSpaceBasisVectors(std::vector<Vertex_PCUTBN>& vertices, std
 		}
 	}
 
-	for (int i = 0; i < (int)vertices.size(); i++)
+	ParallelFor(0, static_cast<int>(vertices.size()), VERTEX_PARALLEL_GRAIN, [&](int i)
 	{
 		Vec3 vertNormal = vertices[i].m_normal;
-		Vec3 vertTangent = vertices[i].m_tangent;
 		Vec3 vertBiTangent = vertices[i].m_biTangent;
 
 		Vec3 correctedTangent = CrossProduct3D(vertBiTangent.GetNormalized(), vertNormal.GetNormalized()).GetNormalized();
@@ -1287,7 +1372,7 @@ void CalculateTangentSpaceBasisVectors(std::vector<Vertex_PCUTBN>& vertices, std
 		vertices[i].m_normal = vertNormal;
 		vertices[i].m_tangent = correctedTangent;
 		vertices[i].m_biTangent = correctBiTangent;
-	}
+	});
 }
 
 void CalculateTangentSpaceBasisVectors(std::vector<MeshVertex_PCUTBN>& vertices, std::vector<unsigned int> indices, bool computeNormals, bool computeTangents)
@@ -1355,10 +1440,9 @@ void CalculateTangentSpaceBasisVectors(std::vector<MeshVertex_PCUTBN>& vertices,
 		}
 	}
 
-	for (int i = 0; i < (int)vertices.size(); i++)
+	ParallelFor(0, static_cast<int>(vertices.size()), VERTEX_PARALLEL_GRAIN, [&](int i)
 	{
 		Vec3 vertNormal = vertices[i].m_normal;
-		Vec3 vertTangent = vertices[i].m_tangent;
 		Vec3 vertBiTangent = vertices[i].m_biTangent;
 
 		Vec3 correctedTangent = CrossProduct3D(vertBiTangent.GetNormalized(), vertNormal.GetNormalized()).GetNormalized();
@@ -1367,7 +1451,7 @@ void CalculateTangentSpaceBasisVectors(std::vector<MeshVertex_PCUTBN>& vertices,
 		vertices[i].m_normal = vertNormal;
 		vertices[i].m_tangent = correctedTangent;
 		vertices[i].m_biTangent = correctBiTangent;
-	}
+	});
 }
 
 AABB2 GetVertexBounds2D(std::vector<Vertex_PCU> const& verts)
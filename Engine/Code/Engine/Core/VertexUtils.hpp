@@ -21,6 +21,9 @@ struct MeshVertex_PCU;
 struct MeshVertex_PCUTBN;
 
 void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, float uniformScaleXY, float rotationDegreesAboutZ, Vec2 const& translationXY);
+void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, Vec2 const& iBasis, Vec2 const& jBasis, Vec2 const& translationXY);
+// Writes transformed copies of localVerts into worldVerts, so callers need no scratch copy first
+void TransformVertexArrayXY3D(int numVerts, Vertex_PCU const* localVerts, Vertex_PCU* worldVerts, float uniformScaleXY, float rotationDegreesAboutZ, Vec2 const& translationXY);
 void TransformVertexArray3D(std::vector<Vertex_PCU>& verts, Mat44 const& transform);
 void TransformVertexArray3D(std::vector<Vertex_PCUTBN>& verts, Mat44 const& transform, bool willTransformNormals = false);
 void TransformVertexArray3D(std::vector<MeshVertex_PCU>& verts, Mat44 const& transform, bool willTransformNormals = false);
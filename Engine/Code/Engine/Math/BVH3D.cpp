@@ -0,0 +1,664 @@
+#include "Engine/Math/BVH3D.hpp"
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+#include <float.h>
+#include <algorithm>
+
+constexpr int BVH_NUM_OF_SAH_BINS			= 12;
+constexpr int BVH_MAX_LEAF_PRIMITIVES		= 8;
+constexpr float BVH_TRAVERSAL_COST			= 1.0f;
+constexpr float BVH_INTERSECTION_COST		= 2.0f;
+
+static AABB3 GetEmptyBounds()
+{
+	return AABB3(Vec3(FLT_MAX, FLT_MAX, FLT_MAX), Vec3(-FLT_MAX, -FLT_MAX, -FLT_MAX));
+}
+
+static void GrowBounds(AABB3& bounds, AABB3 const& other)
+{
+	bounds.m_mins = Vec3(std::min(bounds.m_mins.x, other.m_mins.x), std::min(bounds.m_mins.y, other.m_mins.y), std::min(bounds.m_mins.z, other.m_mins.z));
+	bounds.m_maxs = Vec3(std::max(bounds.m_maxs.x, other.m_maxs.x), std::max(bounds.m_maxs.y, other.m_maxs.y), std::max(bounds.m_maxs.z, other.m_maxs.z));
+}
+
+static float GetHalfSurfaceArea(AABB3 const& bounds)
+{
+	Vec3 extents = bounds.m_maxs - bounds.m_mins;
+
+	if (extents.x < 0.0f)
+		return 0.0f;
+
+	return (extents.x * extents.y) + (extents.y * extents.z) + (extents.z * extents.x);
+}
+
+static float GetAxis(Vec3 const& vector, int axis)
+{
+	return axis == 0 ? vector.x : (axis == 1 ? vector.y : vector.z);
+}
+
+static Vec3 GetCentroid(AABB3 const& bounds)
+{
+	return (bounds.m_mins + bounds.m_maxs) * 0.5f;
+}
+
+// Slab test against precomputed reciprocal directions; outEntryDist is clamped to the start of the ray
+// Per-ray values shared by every node test of one query
+struct BVHRay
+{
+	Vec3	m_startPos;
+	Vec3	m_inverseFwd;
+	bool	m_hasParallelAxis	= false;	// Some fwd component is zero, so its inverse is infinite
+};
+
+static BVHRay MakeBVHRay(Vec3 const& startPos, Vec3 const& fwdNormal)
+{
+	BVHRay ray;
+	ray.m_startPos = startPos;
+	ray.m_inverseFwd = Vec3(1.0f / fwdNormal.x, 1.0f / fwdNormal.y, 1.0f / fwdNormal.z);
+	ray.m_hasParallelAxis = fwdNormal.x == 0.0f || fwdNormal.y == 0.0f || fwdNormal.z == 0.0f;
+
+	return ray;
+}
+
+// Narrows [entryDist, exitDist] to the part of the ray inside one axis slab, returning false when the ray never enters it.
+// An axis the ray runs parallel to is a plain inside test: its infinite inverse times a zero offset would be NaN when the
+// start lies exactly on the slab's plane.
+static bool ClipRayToSlab(float start, float inverseFwd, float slabMin, float slabMax, float& entryDist, float& exitDist)
+{
+	if (fabsf(inverseFwd) > FLT_MAX)
+		return start >= slabMin && start <= slabMax;
+
+	float t1 = (slabMin - start) * inverseFwd;
+	float t2 = (slabMax - start) * inverseFwd;
+
+	entryDist = std::max(entryDist, std::min(t1, t2));
+	exitDist = std::min(exitDist, std::max(t1, t2));
+
+	return true;
+}
+
+static bool DoesRayHitBounds(BVHRay const& ray, float maxDist, AABB3 const& bounds, float& outEntryDist)
+{
+	Vec3 const& startPos = ray.m_startPos;
+	Vec3 const& inverseFwd = ray.m_inverseFwd;
+
+	// Rays along an axis plane take the guarded path; everything else keeps the branch-free slab test
+	if (ray.m_hasParallelAxis)
+	{
+		float entryDist = 0.0f;
+		float exitDist = maxDist;
+
+		outEntryDist = entryDist;
+
+		if (!ClipRayToSlab(startPos.x, inverseFwd.x, bounds.m_mins.x, bounds.m_maxs.x, entryDist, exitDist) ||
+			!ClipRayToSlab(startPos.y, inverseFwd.y, bounds.m_mins.y, bounds.m_maxs.y, entryDist, exitDist) ||
+			!ClipRayToSlab(startPos.z, inverseFwd.z, bounds.m_mins.z, bounds.m_maxs.z, entryDist, exitDist))
+			return false;
+
+		outEntryDist = entryDist;
+
+		return entryDist <= exitDist;
+	}
+
+	float tx1 = (bounds.m_mins.x - startPos.x) * inverseFwd.x;
+	float tx2 = (bounds.m_maxs.x - startPos.x) * inverseFwd.x;
+	float ty1 = (bounds.m_mins.y - startPos.y) * inverseFwd.y;
+	float ty2 = (bounds.m_maxs.y - startPos.y) * inverseFwd.y;
+	float tz1 = (bounds.m_mins.z - startPos.z) * inverseFwd.z;
+	float tz2 = (bounds.m_maxs.z - startPos.z) * inverseFwd.z;
+
+	float entryDist = std::max(std::max(std::min(tx1, tx2), std::min(ty1, ty2)), std::max(std::min(tz1, tz2), 0.0f));
+	float exitDist = std::min(std::min(std::max(tx1, tx2), std::max(ty1, ty2)), std::min(std::max(tz1, tz2), maxDist));
+
+	outEntryDist = entryDist;
+
+	return entryDist <= exitDist;
+}
+
+void BVH3D::Clear()
+{
+	m_primitives.clear();
+	m_primitiveBounds.clear();
+	m_primitiveOrder.clear();
+	m_nodes.clear();
+}
+
+int BVH3D::AddAABB3(int id, AABB3 const& bounds)
+{
+	Primitive primitive;
+	primitive.m_type = BVHPrimitiveType::AABB3;
+	primitive.m_id = id;
+	primitive.m_pointA = bounds.m_mins;
+	primitive.m_pointB = bounds.m_maxs;
+
+	return AddPrimitive(primitive);
+}
+
+int BVH3D::AddOBB3(int id, OBB3 const& box)
+{
+	Primitive primitive;
+	primitive.m_type = BVHPrimitiveType::OBB3;
+	primitive.m_id = id;
+	primitive.m_pointA = box.m_center;
+	primitive.m_pointB = box.m_iBasisNormal;
+	primitive.m_pointC = box.m_halfDimensions;
+
+	return AddPrimitive(primitive);
+}
+
+int BVH3D::AddSphere(int id, Vec3 const& center, float radius)
+{
+	Primitive primitive;
+	primitive.m_type = BVHPrimitiveType::SPHERE;
+	primitive.m_id = id;
+	primitive.m_pointA = center;
+	primitive.m_radius = radius;
+
+	return AddPrimitive(primitive);
+}
+
+int BVH3D::AddZCylinder(int id, Vec3 const& start, float height, float radius)
+{
+	Primitive primitive;
+	primitive.m_type = BVHPrimitiveType::Z_CYLINDER;
+	primitive.m_id = id;
+	primitive.m_pointA = start;
+	primitive.m_height = height;
+	primitive.m_radius = radius;
+
+	return AddPrimitive(primitive);
+}
+
+int BVH3D::AddTriangle(int id, Vec3 const& vertexA, Vec3 const& vertexB, Vec3 const& vertexC)
+{
+	Primitive primitive;
+	primitive.m_type = BVHPrimitiveType::TRIANGLE;
+	primitive.m_id = id;
+	primitive.m_pointA = vertexA;
+	primitive.m_pointB = vertexB;
+	primitive.m_pointC = vertexC;
+
+	return AddPrimitive(primitive);
+}
+
+void BVH3D::SetAABB3(int handle, AABB3 const& bounds)
+{
+	Primitive& primitive = m_primitives[handle];
+
+	GUARANTEE_OR_DIE(primitive.m_type == BVHPrimitiveType::AABB3, "BVH primitive is not an AABB3!");
+
+	primitive.m_pointA = bounds.m_mins;
+	primitive.m_pointB = bounds.m_maxs;
+	m_primitiveBounds[handle] = ComputePrimitiveBounds(primitive);
+}
+
+void BVH3D::SetOBB3(int handle, OBB3 const& box)
+{
+	Primitive& primitive = m_primitives[handle];
+
+	GUARANTEE_OR_DIE(primitive.m_type == BVHPrimitiveType::OBB3, "BVH primitive is not an OBB3!");
+
+	primitive.m_pointA = box.m_center;
+	primitive.m_pointB = box.m_iBasisNormal;
+	primitive.m_pointC = box.m_halfDimensions;
+	m_primitiveBounds[handle] = ComputePrimitiveBounds(primitive);
+}
+
+void BVH3D::SetSphere(int handle, Vec3 const& center, float radius)
+{
+	Primitive& primitive = m_primitives[handle];
+
+	GUARANTEE_OR_DIE(primitive.m_type == BVHPrimitiveType::SPHERE, "BVH primitive is not a sphere!");
+
+	primitive.m_pointA = center;
+	primitive.m_radius = radius;
+	m_primitiveBounds[handle] = ComputePrimitiveBounds(primitive);
+}
+
+void BVH3D::SetZCylinder(int handle, Vec3 const& start, float height, float radius)
+{
+	Primitive& primitive = m_primitives[handle];
+
+	GUARANTEE_OR_DIE(primitive.m_type == BVHPrimitiveType::Z_CYLINDER, "BVH primitive is not a Z cylinder!");
+
+	primitive.m_pointA = start;
+	primitive.m_height = height;
+	primitive.m_radius = radius;
+	m_primitiveBounds[handle] = ComputePrimitiveBounds(primitive);
+}
+
+void BVH3D::SetTriangle(int handle, Vec3 const& vertexA, Vec3 const& vertexB, Vec3 const& vertexC)
+{
+	Primitive& primitive = m_primitives[handle];
+
+	GUARANTEE_OR_DIE(primitive.m_type == BVHPrimitiveType::TRIANGLE, "BVH primitive is not a triangle!");
+
+	primitive.m_pointA = vertexA;
+	primitive.m_pointB = vertexB;
+	primitive.m_pointC = vertexC;
+	m_primitiveBounds[handle] = ComputePrimitiveBounds(primitive);
+}
+
+void BVH3D::Build()
+{
+	int numOfPrimitives = GetNumOfPrimitives();
+
+	m_nodes.clear();
+	m_primitiveOrder.resize(numOfPrimitives);
+
+	for (int index = 0; index < numOfPrimitives; index++)
+	{
+		m_primitiveOrder[index] = index;
+	}
+
+	if (numOfPrimitives == 0)
+		return;
+
+	m_nodes.reserve(2 * numOfPrimitives);
+
+	Node root;
+	root.m_firstChildOrPrimitive = 0;
+	root.m_numOfPrimitives = numOfPrimitives;
+	m_nodes.push_back(root);
+
+	// Explicit stack of (node, depth) so a lopsided scene cannot overflow the call stack
+	int nodeStack[BVH_STACK_SIZE];
+	int depthStack[BVH_STACK_SIZE];
+	int stackSize = 0;
+
+	nodeStack[stackSize] = 0;
+	depthStack[stackSize++] = 0;
+
+	while (stackSize > 0)
+	{
+		stackSize--;
+		int nodeIndex = nodeStack[stackSize];
+		int depth = depthStack[stackSize];
+
+		if (depth < BVH_STACK_SIZE - 2)
+		{
+			SplitNode(nodeIndex);
+		}
+
+		if (m_nodes[nodeIndex].m_numOfPrimitives == 0)
+		{
+			int leftIndex = m_nodes[nodeIndex].m_firstChildOrPrimitive;
+
+			// Left subtree is split first so its nodes end up close together in memory
+			nodeStack[stackSize] = leftIndex + 1;
+			depthStack[stackSize++] = depth + 1;
+			nodeStack[stackSize] = leftIndex;
+			depthStack[stackSize++] = depth + 1;
+		}
+	}
+
+	Refit();
+}
+
+void BVH3D::Refit()
+{
+	// Children are always stored after their parent, so a reverse sweep visits them first
+	for (int nodeIndex = GetNumOfNodes() - 1; nodeIndex >= 0; nodeIndex--)
+	{
+		Node& node = m_nodes[nodeIndex];
+		AABB3 bounds = GetEmptyBounds();
+
+		if (node.m_numOfPrimitives == 0)
+		{
+			GrowBounds(bounds, m_nodes[node.m_firstChildOrPrimitive].m_bounds);
+			GrowBounds(bounds, m_nodes[node.m_firstChildOrPrimitive + 1].m_bounds);
+		}
+		else
+		{
+			for (int orderIndex = node.m_firstChildOrPrimitive; orderIndex < node.m_firstChildOrPrimitive + node.m_numOfPrimitives; orderIndex++)
+			{
+				GrowBounds(bounds, m_primitiveBounds[m_primitiveOrder[orderIndex]]);
+			}
+		}
+
+		node.m_bounds = bounds;
+	}
+}
+
+int BVH3D::GetNumOfPrimitives() const
+{
+	return static_cast<int>(m_primitives.size());
+}
+
+int BVH3D::GetNumOfNodes() const
+{
+	return static_cast<int>(m_nodes.size());
+}
+
+RaycastResult3D BVH3D::RaycastClosest(Vec3 const& startPos, Vec3 const& fwdNormal, float maxDist, int& outHitID) const
+{
+	RaycastResult3D closest;
+	closest.m_rayStartPos = startPos;
+	closest.m_rayFwdNormal = fwdNormal;
+	closest.m_rayMaxLength = maxDist;
+	closest.m_impactPos = startPos + (maxDist * fwdNormal);
+
+	outHitID = -1;
+
+	if (m_nodes.empty())
+		return closest;
+
+	BVHRay ray = MakeBVHRay(startPos, fwdNormal);
+	float closestDist = maxDist;
+
+	int nodeStack[BVH_STACK_SIZE];
+	float entryStack[BVH_STACK_SIZE];
+	int stackSize = 0;
+
+	float rootEntry;
+	if (!DoesRayHitBounds(ray, maxDist, m_nodes[0].m_bounds, rootEntry))
+		return closest;
+
+	nodeStack[stackSize] = 0;
+	entryStack[stackSize++] = rootEntry;
+
+	while (stackSize > 0)
+	{
+		stackSize--;
+
+		// Skip subtrees that start beyond a hit found since they were pushed
+		if (entryStack[stackSize] > closestDist)
+			continue;
+
+		Node const& node = m_nodes[nodeStack[stackSize]];
+
+		if (node.m_numOfPrimitives == 0)
+		{
+			int nearIndex = node.m_firstChildOrPrimitive;
+			int farIndex = nearIndex + 1;
+
+			float nearEntry;
+			float farEntry;
+			bool isNearHit = DoesRayHitBounds(ray, closestDist, m_nodes[nearIndex].m_bounds, nearEntry);
+			bool isFarHit = DoesRayHitBounds(ray, closestDist, m_nodes[farIndex].m_bounds, farEntry);
+
+			if (isNearHit && isFarHit && farEntry < nearEntry)
+			{
+				std::swap(nearIndex, farIndex);
+				std::swap(nearEntry, farEntry);
+			}
+			else if (!isNearHit)
+			{
+				nearIndex = farIndex;
+				nearEntry = farEntry;
+				isNearHit = isFarHit;
+				isFarHit = false;
+			}
+
+			// Far child goes underneath so the near one is popped first
+			if (isFarHit)
+			{
+				nodeStack[stackSize] = farIndex;
+				entryStack[stackSize++] = farEntry;
+			}
+
+			if (isNearHit)
+			{
+				nodeStack[stackSize] = nearIndex;
+				entryStack[stackSize++] = nearEntry;
+			}
+
+			continue;
+		}
+
+		for (int orderIndex = node.m_firstChildOrPrimitive; orderIndex < node.m_firstChildOrPrimitive + node.m_numOfPrimitives; orderIndex++)
+		{
+			int primitiveIndex = m_primitiveOrder[orderIndex];
+			RaycastResult3D result = RaycastPrimitive(primitiveIndex, startPos, fwdNormal, maxDist);
+
+			if (!result.m_didImpact || result.m_impactDist > closestDist)
+				continue;
+
+			// Equal distances go to the lowest id, so the answer doesn't depend on traversal order
+			int id = m_primitives[primitiveIndex].m_id;
+
+			if (result.m_impactDist < closestDist || outHitID < 0 || id < outHitID)
+			{
+				closest = result;
+				closestDist = result.m_impactDist;
+				outHitID = id;
+			}
+		}
+	}
+
+	return closest;
+}
+
+bool BVH3D::RaycastAny(Vec3 const& startPos, Vec3 const& fwdNormal, float maxDist) const
+{
+	if (m_nodes.empty())
+		return false;
+
+	BVHRay ray = MakeBVHRay(startPos, fwdNormal);
+
+	int nodeStack[BVH_STACK_SIZE];
+	int stackSize = 0;
+	nodeStack[stackSize++] = 0;
+
+	while (stackSize > 0)
+	{
+		Node const& node = m_nodes[nodeStack[--stackSize]];
+
+		float entryDist;
+		if (!DoesRayHitBounds(ray, maxDist, node.m_bounds, entryDist))
+			continue;
+
+		if (node.m_numOfPrimitives == 0)
+		{
+			nodeStack[stackSize++] = node.m_firstChildOrPrimitive + 1;
+			nodeStack[stackSize++] = node.m_firstChildOrPrimitive;
+			continue;
+		}
+
+		for (int orderIndex = node.m_firstChildOrPrimitive; orderIndex < node.m_firstChildOrPrimitive + node.m_numOfPrimitives; orderIndex++)
+		{
+			if (RaycastPrimitive(m_primitiveOrder[orderIndex], startPos, fwdNormal, maxDist).m_didImpact)
+				return true;
+		}
+	}
+
+	return false;
+}
+
+RaycastResult3D BVH3D::RaycastPrimitive(int handle, Vec3 const& startPos, Vec3 const& fwdNormal, float maxDist) const
+{
+	Primitive const& primitive = m_primitives[handle];
+
+	switch (primitive.m_type)
+	{
+	case BVHPrimitiveType::AABB3:		return RaycastVsAABB3D(startPos, fwdNormal, maxDist, AABB3(primitive.m_pointA, primitive.m_pointB));
+	case BVHPrimitiveType::OBB3:		return RaycastVsOBB3D(startPos, fwdNormal, maxDist, OBB3(primitive.m_pointA, primitive.m_pointB, primitive.m_pointC));
+	case BVHPrimitiveType::SPHERE:		return RaycastVsSphere3D(startPos, fwdNormal, maxDist, primitive.m_pointA, primitive.m_radius);
+	case BVHPrimitiveType::Z_CYLINDER:	return RaycastVsZCylinder3D(startPos, fwdNormal, maxDist, primitive.m_pointA, primitive.m_height, primitive.m_radius);
+	case BVHPrimitiveType::TRIANGLE:	return RaycastVsTriangle3D(startPos, fwdNormal, maxDist, primitive.m_pointA, primitive.m_pointB, primitive.m_pointC);
+	}
+
+	return RaycastResult3D();
+}
+
+int BVH3D::AddPrimitive(Primitive const& primitive)
+{
+	m_primitives.push_back(primitive);
+	m_primitiveBounds.push_back(ComputePrimitiveBounds(primitive));
+
+	return GetNumOfPrimitives() - 1;
+}
+
+AABB3 BVH3D::ComputePrimitiveBounds(Primitive const& primitive) const
+{
+	switch (primitive.m_type)
+	{
+	case BVHPrimitiveType::AABB3:
+	{
+		return AABB3(primitive.m_pointA, primitive.m_pointB);
+	}
+	case BVHPrimitiveType::OBB3:
+	{
+		// Same basis RaycastVsOBB3D builds from the i basis
+		Vec3 iBasis = primitive.m_pointB.GetNormalized();
+		Vec3 jBasis = CrossProduct3D(Vec3(0.0f, 0.0f, 1.0f), iBasis).GetNormalized();
+		Vec3 kBasis = CrossProduct3D(jBasis, iBasis).GetNormalized();
+		Vec3 halfDimensions = primitive.m_pointC;
+
+		Vec3 extents;
+		extents.x = fabsf(iBasis.x) * halfDimensions.x + fabsf(jBasis.x) * halfDimensions.y + fabsf(kBasis.x) * halfDimensions.z;
+		extents.y = fabsf(iBasis.y) * halfDimensions.x + fabsf(jBasis.y) * halfDimensions.y + fabsf(kBasis.y) * halfDimensions.z;
+		extents.z = fabsf(iBasis.z) * halfDimensions.x + fabsf(jBasis.z) * halfDimensions.y + fabsf(kBasis.z) * halfDimensions.z;
+
+		return AABB3(primitive.m_pointA - extents, primitive.m_pointA + extents);
+	}
+	case BVHPrimitiveType::SPHERE:
+	{
+		Vec3 extents = Vec3(primitive.m_radius, primitive.m_radius, primitive.m_radius);
+
+		return AABB3(primitive.m_pointA - extents, primitive.m_pointA + extents);
+	}
+	case BVHPrimitiveType::Z_CYLINDER:
+	{
+		Vec3 mins = Vec3(primitive.m_pointA.x - primitive.m_radius, primitive.m_pointA.y - primitive.m_radius, primitive.m_pointA.z);
+		Vec3 maxs = Vec3(primitive.m_pointA.x + primitive.m_radius, primitive.m_pointA.y + primitive.m_radius, primitive.m_pointA.z + primitive.m_height);
+
+		return AABB3(mins, maxs);
+	}
+	case BVHPrimitiveType::TRIANGLE:
+	{
+		AABB3 bounds = AABB3(primitive.m_pointA, primitive.m_pointA);
+		bounds.StretchToIncludePoint(primitive.m_pointB);
+		bounds.StretchToIncludePoint(primitive.m_pointC);
+
+		return bounds;
+	}
+	}
+
+	return AABB3();
+}
+
+void BVH3D::SplitNode(int nodeIndex)
+{
+	int first = m_nodes[nodeIndex].m_firstChildOrPrimitive;
+	int count = m_nodes[nodeIndex].m_numOfPrimitives;
+
+	if (count <= 1)
+		return;
+
+	AABB3 nodeBounds = GetEmptyBounds();
+	AABB3 centroidBounds = GetEmptyBounds();
+
+	for (int orderIndex = first; orderIndex < first + count; orderIndex++)
+	{
+		AABB3 const& bounds = m_primitiveBounds[m_primitiveOrder[orderIndex]];
+		Vec3 centroid = GetCentroid(bounds);
+
+		GrowBounds(nodeBounds, bounds);
+		GrowBounds(centroidBounds, AABB3(centroid, centroid));
+	}
+
+	// Binned SAH: drop every centroid into one of a few buckets per axis and cost each bucket boundary as a split plane
+	float bestCost = FLT_MAX;
+	int bestAxis = -1;
+	int bestSplit = 0;
+
+	for (int axis = 0; axis < 3; axis++)
+	{
+		float axisMin = GetAxis(centroidBounds.m_mins, axis);
+		float axisExtent = GetAxis(centroidBounds.m_maxs, axis) - axisMin;
+
+		if (axisExtent <= 0.0f)
+			continue;
+
+		float binScale = static_cast<float>(BVH_NUM_OF_SAH_BINS) / axisExtent;
+
+		AABB3 binBounds[BVH_NUM_OF_SAH_BINS];
+		int binCounts[BVH_NUM_OF_SAH_BINS] = {};
+
+		for (int bin = 0; bin < BVH_NUM_OF_SAH_BINS; bin++)
+		{
+			binBounds[bin] = GetEmptyBounds();
+		}
+
+		for (int orderIndex = first; orderIndex < first + count; orderIndex++)
+		{
+			AABB3 const& bounds = m_primitiveBounds[m_primitiveOrder[orderIndex]];
+			int bin = std::min(static_cast<int>((GetAxis(GetCentroid(bounds), axis) - axisMin) * binScale), BVH_NUM_OF_SAH_BINS - 1);
+
+			binCounts[bin]++;
+			GrowBounds(binBounds[bin], bounds);
+		}
+
+		// Sweep from the right to get the area and count of everything past each boundary
+		float rightAreas[BVH_NUM_OF_SAH_BINS];
+		int rightCounts[BVH_NUM_OF_SAH_BINS];
+		AABB3 rightBounds = GetEmptyBounds();
+		int rightCount = 0;
+
+		for (int bin = BVH_NUM_OF_SAH_BINS - 1; bin > 0; bin--)
+		{
+			GrowBounds(rightBounds, binBounds[bin]);
+			rightCount += binCounts[bin];
+			rightAreas[bin] = GetHalfSurfaceArea(rightBounds);
+			rightCounts[bin] = rightCount;
+		}
+
+		AABB3 leftBounds = GetEmptyBounds();
+		int leftCount = 0;
+
+		for (int split = 1; split < BVH_NUM_OF_SAH_BINS; split++)
+		{
+			GrowBounds(leftBounds, binBounds[split - 1]);
+			leftCount += binCounts[split - 1];
+
+			if (leftCount == 0 || rightCounts[split] == 0)
+				continue;
+
+			float cost = GetHalfSurfaceArea(leftBounds) * static_cast<float>(leftCount) + rightAreas[split] * static_cast<float>(rightCounts[split]);
+
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestAxis = axis;
+				bestSplit = split;
+			}
+		}
+	}
+
+	if (bestAxis < 0)
+		return;
+
+	float nodeArea = GetHalfSurfaceArea(nodeBounds);
+	float leafCost = BVH_INTERSECTION_COST * static_cast<float>(count);
+	float splitCost = nodeArea > 0.0f ? BVH_TRAVERSAL_COST + BVH_INTERSECTION_COST * bestCost / nodeArea : leafCost;
+
+	if (splitCost >= leafCost && count <= BVH_MAX_LEAF_PRIMITIVES)
+		return;
+
+	float axisMin = GetAxis(centroidBounds.m_mins, bestAxis);
+	float binScale = static_cast<float>(BVH_NUM_OF_SAH_BINS) / (GetAxis(centroidBounds.m_maxs, bestAxis) - axisMin);
+
+	int* middle = std::partition(&m_primitiveOrder[first], &m_primitiveOrder[first] + count, [&](int primitiveIndex)
+	{
+		int bin = std::min(static_cast<int>((GetAxis(GetCentroid(m_primitiveBounds[primitiveIndex]), bestAxis) - axisMin) * binScale), BVH_NUM_OF_SAH_BINS - 1);
+		return bin < bestSplit;
+	});
+
+	int leftCount = static_cast<int>(middle - &m_primitiveOrder[first]);
+
+	Node leftChild;
+	leftChild.m_firstChildOrPrimitive = first;
+	leftChild.m_numOfPrimitives = leftCount;
+
+	Node rightChild;
+	rightChild.m_firstChildOrPrimitive = first + leftCount;
+	rightChild.m_numOfPrimitives = count - leftCount;
+
+	int leftIndex = GetNumOfNodes();
+	m_nodes.push_back(leftChild);
+	m_nodes.push_back(rightChild);
+
+	m_nodes[nodeIndex].m_firstChildOrPrimitive = leftIndex;
+	m_nodes[nodeIndex].m_numOfPrimitives = 0;
+}
\ No newline at end of file
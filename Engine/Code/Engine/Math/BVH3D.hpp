@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Engine/Math/OBB3.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RaycastUtils.hpp"
+
+#include <vector>
+
+// Traversal stacks are fixed arrays, so Build stops splitting two levels short of this depth
+constexpr int BVH_STACK_SIZE = 64;
+
+enum class BVHPrimitiveType
+{
+	AABB3,
+	OBB3,
+	SPHERE,
+	Z_CYLINDER,
+	TRIANGLE
+};
+
+// Bounding volume hierarchy over mixed 3D primitives for scene raycasts and overlap queries.
+// Primitives are added once, Build runs a binned SAH split over their centroids, and Refit re-fits the node bounds
+// bottom-up after Set* calls move primitives without rebuilding the tree. Hits are tested with the RaycastUtils functions,
+// so a BVH query returns exactly what a brute force loop over those functions would.
+class BVH3D
+{
+	struct Primitive
+	{
+		BVHPrimitiveType	m_type		= BVHPrimitiveType::AABB3;
+		int					m_id		= -1;
+		Vec3				m_pointA;	// AABB3 mins, OBB3/sphere center, cylinder start, triangle vertex A
+		Vec3				m_pointB;	// AABB3 maxs, OBB3 i basis, triangle vertex B
+		Vec3				m_pointC;	// OBB3 half dimensions, triangle vertex C
+		float				m_radius	= 0.0f;
+		float				m_height	= 0.0f;
+	};
+	struct Node
+	{
+		AABB3				m_bounds;
+		int					m_firstChildOrPrimitive	= 0;
+		int					m_numOfPrimitives		= 0;	// 0 for interior nodes, whose children are adjacent
+	};
+	std::vector<Primitive>		m_primitives;
+	std::vector<AABB3>			m_primitiveBounds;
+	std::vector<int>			m_primitiveOrder;
+	std::vector<Node>			m_nodes;
+public:
+								BVH3D() {}
+								~BVH3D() {}
+
+	void						Clear();
+
+	// Each Add returns the primitive's handle for the matching Set call; queries report the id
+	int							AddAABB3(int id, AABB3 const& bounds);
+	int							AddOBB3(int id, OBB3 const& box);
+	int							AddSphere(int id, Vec3 const& center, float radius);
+	int							AddZCylinder(int id, Vec3 const& start, float height, float radius);
+	int							AddTriangle(int id, Vec3 const& vertexA, Vec3 const& vertexB, Vec3 const& vertexC);
+
+	void						SetAABB3(int handle, AABB3 const& bounds);
+	void						SetOBB3(int handle, OBB3 const& box);
+	void						SetSphere(int handle, Vec3 const& center, float radius);
+	void						SetZCylinder(int handle, Vec3 const& start, float height, float radius);
+	void						SetTriangle(int handle, Vec3 const& vertexA, Vec3 const& vertexB, Vec3 const& vertexC);
+
+	void						Build();
+	void						Refit();
+
+	int							GetNumOfPrimitives() const;
+	int							GetNumOfNodes() const;
+
+	// Nearest hit along the ray, with outHitID set to its id or -1 on a miss; hits at the same distance go to the lowest id
+	RaycastResult3D				RaycastClosest(Vec3 const& startPos, Vec3 const& fwdNormal, float maxDist, int& outHitID) const;
+	// Stops at the first primitive hit in traversal order, for line of sight style checks
+	bool						RaycastAny(Vec3 const& startPos, Vec3 const& fwdNormal, float maxDist) const;
+	RaycastResult3D				RaycastPrimitive(int handle, Vec3 const& startPos, Vec3 const& fwdNormal, float maxDist) const;
+
+	// Calls func(id) for every primitive whose bounds overlap the query box, in no particular order
+	template <typename Func>
+	void						ForEachOverlap(AABB3 const& bounds, Func const& func) const;
+private:
+	int							AddPrimitive(Primitive const& primitive);
+	AABB3						ComputePrimitiveBounds(Primitive const& primitive) const;
+	void						SplitNode(int nodeIndex);
+};
+
+template <typename Func>
+void BVH3D::ForEachOverlap(AABB3 const& bounds, Func const& func) const
+{
+	if (m_nodes.empty())
+		return;
+
+	int nodeStack[BVH_STACK_SIZE];
+	int stackSize = 0;
+	nodeStack[stackSize++] = 0;
+
+	while (stackSize > 0)
+	{
+		Node const& node = m_nodes[nodeStack[--stackSize]];
+
+		if (!DoAABB3sOverlap(node.m_bounds, bounds))
+			continue;
+
+		if (node.m_numOfPrimitives == 0)
+		{
+			nodeStack[stackSize++] = node.m_firstChildOrPrimitive;
+			nodeStack[stackSize++] = node.m_firstChildOrPrimitive + 1;
+			continue;
+		}
+
+		for (int orderIndex = node.m_firstChildOrPrimitive; orderIndex < node.m_firstChildOrPrimitive + node.m_numOfPrimitives; orderIndex++)
+		{
+			int primitiveIndex = m_primitiveOrder[orderIndex];
+
+			if (DoAABB3sOverlap(m_primitiveBounds[primitiveIndex], bounds))
+			{
+				func(m_primitives[primitiveIndex].m_id);
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -48,14 +48,17 @@ EulerAngles EulerAngles::SetFromText(char const* text)
 
 void EulerAngles::GetAsVectors_XFwd_YLeft_ZUp(Vec3& iBasisForward, Vec3& jBasisLeft, Vec3& kBasisUp)
 {
-	float cy = CosDegrees(m_yawDegrees);
-	float sy = SinDegrees(m_yawDegrees);
+	float cy;
+	float sy;
+	SinCosDegrees(m_yawDegrees, sy, cy);
 
-	float cp = CosDegrees(m_pitchDegrees);
-	float sp = SinDegrees(m_pitchDegrees);
+	float cp;
+	float sp;
+	SinCosDegrees(m_pitchDegrees, sp, cp);
 
-	float cr = CosDegrees(m_rollDegrees);
-	float sr = SinDegrees(m_rollDegrees);
+	float cr;
+	float sr;
+	SinCosDegrees(m_rollDegrees, sr, cr);
 
 	Mat44 result;
 
@@ -79,14 +82,17 @@ void EulerAngles::GetAsVectors_XFwd_YLeft_ZUp(Vec3& iBasisForward, Vec3& jBasisL
 
 Mat44 EulerAngles::GetAsMatrix_XFwd_YLeft_ZUp() const
 {
-	float cy = CosDegrees(m_yawDegrees);
-	float sy = SinDegrees(m_yawDegrees);
+	float cy;
+	float sy;
+	SinCosDegrees(m_yawDegrees, sy, cy);
 
-	float cp = CosDegrees(m_pitchDegrees);
-	float sp = SinDegrees(m_pitchDegrees);
+	float cp;
+	float sp;
+	SinCosDegrees(m_pitchDegrees, sp, cp);
 
-	float cr = CosDegrees(m_rollDegrees);
-	float sr = SinDegrees(m_rollDegrees);
+	float cr;
+	float sr;
+	SinCosDegrees(m_rollDegrees, sr, cr);
 
 	Mat44 result;
 
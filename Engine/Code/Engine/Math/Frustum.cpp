@@ -1 +1,242 @@
-#include "Engine/Math/Frustum.hpp"
\ No newline at end of file
+#include "Engine/Math/Frustum.hpp"
+
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec4.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/SimdUtils.hpp"
+#include "Engine/Core/ParallelFor.hpp"
+
+#include <math.h>
+
+constexpr int CULL_PARALLEL_GRAIN = 16384;
+
+static_assert(sizeof(AABB3) == 6 * sizeof(float), "CullAABBs reads AABB3 arrays as packed floats");
+
+// The six planes laid out as arrays so the scalar and SIMD tests walk them in the same order
+struct FrustumPlanes
+{
+	float	m_normalX[6];
+	float	m_normalY[6];
+	float	m_normalZ[6];
+	float	m_distance[6];
+};
+
+static Plane3D MakeClipPlane(Vec4 const& row, Vec4 const& wRow, float rowSign)
+{
+	Vec3 normal = Vec3(wRow.x + rowSign * row.x, wRow.y + rowSign * row.y, wRow.z + rowSign * row.z);
+	float offset = wRow.w + rowSign * row.w;
+	float inverseLength = 1.0f / normal.GetLength();
+
+	return Plane3D(normal * inverseLength, -offset * inverseLength);
+}
+
+Frustum const Frustum::CreateFromViewProjection(Mat44 const& viewProjection)
+{
+	float const* values = viewProjection.m_values;
+
+	Vec4 rowX = Vec4(values[Mat44::Ix], values[Mat44::Jx], values[Mat44::Kx], values[Mat44::Tx]);
+	Vec4 rowY = Vec4(values[Mat44::Iy], values[Mat44::Jy], values[Mat44::Ky], values[Mat44::Ty]);
+	Vec4 rowZ = Vec4(values[Mat44::Iz], values[Mat44::Jz], values[Mat44::Kz], values[Mat44::Tz]);
+	Vec4 rowW = Vec4(values[Mat44::Iw], values[Mat44::Jw], values[Mat44::Kw], values[Mat44::Tw]);
+
+	Frustum frustum;
+
+	frustum.m_leftPlane		= MakeClipPlane(rowX, rowW, 1.0f);
+	frustum.m_rightPlane	= MakeClipPlane(rowX, rowW, -1.0f);
+	frustum.m_bottomPlane	= MakeClipPlane(rowY, rowW, 1.0f);
+	frustum.m_topPlane		= MakeClipPlane(rowY, rowW, -1.0f);
+	frustum.m_nearPlane		= MakeClipPlane(rowZ, Vec4(0.0f, 0.0f, 0.0f, 0.0f), 1.0f);
+	frustum.m_farPlane		= MakeClipPlane(rowZ, rowW, -1.0f);
+
+	return frustum;
+}
+
+static FrustumPlanes GetFrustumPlanes(Frustum const& frustum)
+{
+	Plane3D const* planes[6] = { &frustum.m_nearPlane, &frustum.m_farPlane, &frustum.m_rightPlane, &frustum.m_leftPlane, &frustum.m_topPlane, &frustum.m_bottomPlane };
+
+	FrustumPlanes result;
+
+	for (int planeIndex = 0; planeIndex < 6; planeIndex++)
+	{
+		result.m_normalX[planeIndex] = planes[planeIndex]->m_normal.x;
+		result.m_normalY[planeIndex] = planes[planeIndex]->m_normal.y;
+		result.m_normalZ[planeIndex] = planes[planeIndex]->m_normal.z;
+		result.m_distance[planeIndex] = planes[planeIndex]->m_distanceFromOriginAlongNormal;
+	}
+
+	return result;
+}
+
+// A box is culled once its center sits further behind a plane than the box reaches along that plane's normal
+static bool IsAABB3VisibleToPlanes(FrustumPlanes const& planes, AABB3 const& bounds)
+{
+	float centerX = (bounds.m_mins.x + bounds.m_maxs.x) * 0.5f;
+	float centerY = (bounds.m_mins.y + bounds.m_maxs.y) * 0.5f;
+	float centerZ = (bounds.m_mins.z + bounds.m_maxs.z) * 0.5f;
+	float extentX = (bounds.m_maxs.x - bounds.m_mins.x) * 0.5f;
+	float extentY = (bounds.m_maxs.y - bounds.m_mins.y) * 0.5f;
+	float extentZ = (bounds.m_maxs.z - bounds.m_mins.z) * 0.5f;
+
+	for (int planeIndex = 0; planeIndex < 6; planeIndex++)
+	{
+		float centerDistance = planes.m_normalX[planeIndex] * centerX + planes.m_normalY[planeIndex] * centerY + planes.m_normalZ[planeIndex] * centerZ - planes.m_distance[planeIndex];
+		float reach = fabsf(planes.m_normalX[planeIndex]) * extentX + fabsf(planes.m_normalY[planeIndex]) * extentY + fabsf(planes.m_normalZ[planeIndex]) * extentZ;
+
+		if (centerDistance + reach < 0.0f)
+			return false;
+	}
+
+	return true;
+}
+
+static bool IsSphereVisibleToPlanes(FrustumPlanes const& planes, Vec3 const& center, float radius)
+{
+	for (int planeIndex = 0; planeIndex < 6; planeIndex++)
+	{
+		float centerDistance = planes.m_normalX[planeIndex] * center.x + planes.m_normalY[planeIndex] * center.y + planes.m_normalZ[planeIndex] * center.z - planes.m_distance[planeIndex];
+
+		if (centerDistance + radius < 0.0f)
+			return false;
+	}
+
+	return true;
+}
+
+bool Frustum::IsAABB3Visible(AABB3 const& bounds) const
+{
+	return IsAABB3VisibleToPlanes(GetFrustumPlanes(*this), bounds);
+}
+
+bool Frustum::IsSphereVisible(Vec3 const& center, float radius) const
+{
+	return IsSphereVisibleToPlanes(GetFrustumPlanes(*this), center, radius);
+}
+
+static void CullAABBsChunk(FrustumPlanes const& planes, AABB3 const* boxes, int numOfBoxes, uint8_t* outVisible)
+{
+	int index = 0;
+
+#if defined(ENGINE_SIMD_SSE2)
+	__m128 half = _mm_set1_ps(0.5f);
+	__m128 signMask = _mm_set1_ps(-0.0f);
+
+	for (; index + 4 <= numOfBoxes; index += 4)
+	{
+		// Transpose four packed boxes into min/max lanes; the second load per box starts at mins.z so it stays in bounds
+		float const* packed = &boxes[index].m_mins.x;
+
+		__m128 minX = _mm_loadu_ps(packed);
+		__m128 minY = _mm_loadu_ps(packed + 6);
+		__m128 minZ = _mm_loadu_ps(packed + 12);
+		__m128 maxX = _mm_loadu_ps(packed + 18);
+		_MM_TRANSPOSE4_PS(minX, minY, minZ, maxX);
+
+		__m128 spareZ = _mm_loadu_ps(packed + 2);
+		__m128 spareX = _mm_loadu_ps(packed + 8);
+		__m128 maxY = _mm_loadu_ps(packed + 14);
+		__m128 maxZ = _mm_loadu_ps(packed + 20);
+		_MM_TRANSPOSE4_PS(spareZ, spareX, maxY, maxZ);
+
+		__m128 centerX = _mm_mul_ps(_mm_add_ps(minX, maxX), half);
+		__m128 centerY = _mm_mul_ps(_mm_add_ps(minY, maxY), half);
+		__m128 centerZ = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half);
+		__m128 extentX = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+		__m128 extentY = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+		__m128 extentZ = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+		__m128 isCulled = _mm_setzero_ps();
+
+		for (int planeIndex = 0; planeIndex < 6; planeIndex++)
+		{
+			__m128 normalX = _mm_set1_ps(planes.m_normalX[planeIndex]);
+			__m128 normalY = _mm_set1_ps(planes.m_normalY[planeIndex]);
+			__m128 normalZ = _mm_set1_ps(planes.m_normalZ[planeIndex]);
+
+			__m128 centerDistance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(normalX, centerX), _mm_mul_ps(normalY, centerY)), _mm_mul_ps(normalZ, centerZ));
+			centerDistance = _mm_sub_ps(centerDistance, _mm_set1_ps(planes.m_distance[planeIndex]));
+
+			__m128 reach = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(signMask, normalX), extentX), _mm_mul_ps(_mm_andnot_ps(signMask, normalY), extentY)), _mm_mul_ps(_mm_andnot_ps(signMask, normalZ), extentZ));
+
+			isCulled = _mm_or_ps(isCulled, _mm_cmplt_ps(_mm_add_ps(centerDistance, reach), _mm_setzero_ps()));
+		}
+
+		int culledMask = _mm_movemask_ps(isCulled);
+
+		for (int lane = 0; lane < 4; lane++)
+		{
+			outVisible[index + lane] = static_cast<uint8_t>(((culledMask >> lane) & 1) ^ 1);
+		}
+	}
+#endif
+
+	for (; index < numOfBoxes; index++)
+	{
+		outVisible[index] = IsAABB3VisibleToPlanes(planes, boxes[index]) ? 1 : 0;
+	}
+}
+
+static void CullSpheresChunk(FrustumPlanes const& planes, Vec3 const* centers, float const* radii, int numOfSpheres, uint8_t* outVisible)
+{
+	int index = 0;
+
+#if defined(ENGINE_SIMD_SSE2)
+	for (; index + 4 <= numOfSpheres; index += 4)
+	{
+		__m128 centerX = _mm_setr_ps(centers[index].x, centers[index + 1].x, centers[index + 2].x, centers[index + 3].x);
+		__m128 centerY = _mm_setr_ps(centers[index].y, centers[index + 1].y, centers[index + 2].y, centers[index + 3].y);
+		__m128 centerZ = _mm_setr_ps(centers[index].z, centers[index + 1].z, centers[index + 2].z, centers[index + 3].z);
+		__m128 radius = _mm_loadu_ps(radii + index);
+
+		__m128 isCulled = _mm_setzero_ps();
+
+		for (int planeIndex = 0; planeIndex < 6; planeIndex++)
+		{
+			__m128 centerDistance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes.m_normalX[planeIndex]), centerX), _mm_mul_ps(_mm_set1_ps(planes.m_normalY[planeIndex]), centerY)), _mm_mul_ps(_mm_set1_ps(planes.m_normalZ[planeIndex]), centerZ));
+			centerDistance = _mm_sub_ps(centerDistance, _mm_set1_ps(planes.m_distance[planeIndex]));
+
+			isCulled = _mm_or_ps(isCulled, _mm_cmplt_ps(_mm_add_ps(centerDistance, radius), _mm_setzero_ps()));
+		}
+
+		int culledMask = _mm_movemask_ps(isCulled);
+
+		for (int lane = 0; lane < 4; lane++)
+		{
+			outVisible[index + lane] = static_cast<uint8_t>(((culledMask >> lane) & 1) ^ 1);
+		}
+	}
+#endif
+
+	for (; index < numOfSpheres; index++)
+	{
+		outVisible[index] = IsSphereVisibleToPlanes(planes, centers[index], radii[index]) ? 1 : 0;
+	}
+}
+
+void CullAABBs(Frustum const& frustum, AABB3 const* boxes, int numOfBoxes, uint8_t* outVisible)
+{
+	FrustumPlanes planes = GetFrustumPlanes(frustum);
+	int numOfChunks = (numOfBoxes + CULL_PARALLEL_GRAIN - 1) / CULL_PARALLEL_GRAIN;
+
+	ParallelFor(0, numOfChunks, 1, [&](int chunkIndex)
+	{
+		int begin = chunkIndex * CULL_PARALLEL_GRAIN;
+		int count = numOfBoxes - begin < CULL_PARALLEL_GRAIN ? numOfBoxes - begin : CULL_PARALLEL_GRAIN;
+
+		CullAABBsChunk(planes, boxes + begin, count, outVisible + begin);
+	});
+}
+
+void CullSpheres(Frustum const& frustum, Vec3 const* centers, float const* radii, int numOfSpheres, uint8_t* outVisible)
+{
+	FrustumPlanes planes = GetFrustumPlanes(frustum);
+	int numOfChunks = (numOfSpheres + CULL_PARALLEL_GRAIN - 1) / CULL_PARALLEL_GRAIN;
+
+	ParallelFor(0, numOfChunks, 1, [&](int chunkIndex)
+	{
+		int begin = chunkIndex * CULL_PARALLEL_GRAIN;
+		int count = numOfSpheres - begin < CULL_PARALLEL_GRAIN ? numOfSpheres - begin : CULL_PARALLEL_GRAIN;
+
+		CullSpheresChunk(planes, centers + begin, radii + begin, count, outVisible + begin);
+	});
+}
@@ -1,10 +1,15 @@
 #pragma once
 
 #include "Engine/Math/Plane3D.hpp"
+#include "Engine/Math/AABB3.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
 
 #include <vector>
+#include <cstdint>
 
+struct Mat44;
+
+// Plane normals face into the frustum, so a point is inside when it is in front of all six planes
 struct Frustum
 {
 	Plane3D m_nearPlane;
@@ -19,4 +24,15 @@ struct Frustum
 	std::vector<Vertex_PCU> m_frustumVerts;
 
 	Frustum() = default;
-};
\ No newline at end of file
+
+	// Expects D3D clip space (0 <= z <= w), which both Camera projections produce
+	static Frustum const CreateFromViewProjection(Mat44 const& viewProjection);
+
+	bool IsAABB3Visible(AABB3 const& bounds) const;
+	bool IsSphereVisible(Vec3 const& center, float radius) const;
+};
+
+// Writes 1 to outVisible for every box or sphere touching the frustum and 0 for the rest.
+// Runs four at a time with SSE2 and splits large arrays across the JobSystem.
+void CullAABBs(Frustum const& frustum, AABB3 const* boxes, int numOfBoxes, uint8_t* outVisible);
+void CullSpheres(Frustum const& frustum, Vec3 const* centers, float const* radii, int numOfSpheres, uint8_t* outVisible);
@@ -4,6 +4,116 @@
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/Vec4.hpp"
 #include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/SimdUtils.hpp"
+
+#if defined(ENGINE_SIMD_SSE2)
+// Sums columns[n] * weights[n] in the same order as the scalar dot products, so both paths round identically
+static __m128 CombineColumns(__m128 const* columns, float const* weights)
+{
+	__m128 result = _mm_mul_ps(columns[0], _mm_set1_ps(weights[0]));
+	result = _mm_add_ps(result, _mm_mul_ps(columns[1], _mm_set1_ps(weights[1])));
+	result = _mm_add_ps(result, _mm_mul_ps(columns[2], _mm_set1_ps(weights[2])));
+	result = _mm_add_ps(result, _mm_mul_ps(columns[3], _mm_set1_ps(weights[3])));
+	return result;
+}
+
+static void LoadColumns(Mat44 const& matrix, __m128* outColumns)
+{
+	outColumns[0] = _mm_loadu_ps(&matrix.m_values[Mat44::Ix]);
+	outColumns[1] = _mm_loadu_ps(&matrix.m_values[Mat44::Jx]);
+	outColumns[2] = _mm_loadu_ps(&matrix.m_values[Mat44::Kx]);
+	outColumns[3] = _mm_loadu_ps(&matrix.m_values[Mat44::Tx]);
+}
+
+#define SHUFFLE_MASK(x, y, z, w) _MM_SHUFFLE(w, z, y, x)
+#define SWIZZLE(vec, x, y, z, w) _mm_shuffle_ps(vec, vec, SHUFFLE_MASK(x, y, z, w))
+
+// 2x2 blocks packed as (m00, m01, m10, m11): A * B
+static __m128 Mat22Multiply(__m128 a, __m128 b)
+{
+	return _mm_add_ps(_mm_mul_ps(a, SWIZZLE(b, 0, 3, 0, 3)), _mm_mul_ps(SWIZZLE(a, 1, 0, 3, 2), SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+// adj(A) * B
+static __m128 Mat22AdjugateMultiply(__m128 a, __m128 b)
+{
+	return _mm_sub_ps(_mm_mul_ps(SWIZZLE(a, 3, 3, 0, 0), b), _mm_mul_ps(SWIZZLE(a, 1, 1, 2, 2), SWIZZLE(b, 2, 3, 0, 1)));
+}
+
+// A * adj(B)
+static __m128 Mat22MultiplyAdjugate(__m128 a, __m128 b)
+{
+	return _mm_sub_ps(_mm_mul_ps(a, SWIZZLE(b, 3, 0, 3, 0)), _mm_mul_ps(SWIZZLE(a, 1, 0, 3, 2), SWIZZLE(b, 2, 1, 2, 1)));
+}
+#endif
+
+// Shared by the position and vector batch transforms; vectors pass a zero translation
+static void TransformVec3Array(Mat44 const& matrix, float const* translation, Vec3 const* inVecs, Vec3* outVecs, int count, int strideBytes)
+{
+	if (strideBytes <= 0)
+	{
+		strideBytes = static_cast<int>(sizeof(Vec3));
+	}
+
+	unsigned char const* inBytes = reinterpret_cast<unsigned char const*>(inVecs);
+	unsigned char* outBytes = reinterpret_cast<unsigned char*>(outVecs);
+	float const* values = matrix.m_values;
+
+	int index = 0;
+
+#if defined(ENGINE_SIMD_SSE2)
+	// Gather four elements into x, y and z lanes, transform them together, then scatter back
+	__m128 ix = _mm_set1_ps(values[Mat44::Ix]);
+	__m128 iy = _mm_set1_ps(values[Mat44::Iy]);
+	__m128 iz = _mm_set1_ps(values[Mat44::Iz]);
+	__m128 jx = _mm_set1_ps(values[Mat44::Jx]);
+	__m128 jy = _mm_set1_ps(values[Mat44::Jy]);
+	__m128 jz = _mm_set1_ps(values[Mat44::Jz]);
+	__m128 kx = _mm_set1_ps(values[Mat44::Kx]);
+	__m128 ky = _mm_set1_ps(values[Mat44::Ky]);
+	__m128 kz = _mm_set1_ps(values[Mat44::Kz]);
+	__m128 tx = _mm_set1_ps(translation[0]);
+	__m128 ty = _mm_set1_ps(translation[1]);
+	__m128 tz = _mm_set1_ps(translation[2]);
+
+	for (; index + 4 <= count; index += 4)
+	{
+		Vec3 const& in0 = *reinterpret_cast<Vec3 const*>(inBytes + (index + 0) * strideBytes);
+		Vec3 const& in1 = *reinterpret_cast<Vec3 const*>(inBytes + (index + 1) * strideBytes);
+		Vec3 const& in2 = *reinterpret_cast<Vec3 const*>(inBytes + (index + 2) * strideBytes);
+		Vec3 const& in3 = *reinterpret_cast<Vec3 const*>(inBytes + (index + 3) * strideBytes);
+
+		__m128 x = _mm_setr_ps(in0.x, in1.x, in2.x, in3.x);
+		__m128 y = _mm_setr_ps(in0.y, in1.y, in2.y, in3.y);
+		__m128 z = _mm_setr_ps(in0.z, in1.z, in2.z, in3.z);
+
+		float resultX[4];
+		float resultY[4];
+		float resultZ[4];
+		_mm_storeu_ps(resultX, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(ix, x), _mm_mul_ps(jx, y)), _mm_mul_ps(kx, z)), tx));
+		_mm_storeu_ps(resultY, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(iy, x), _mm_mul_ps(jy, y)), _mm_mul_ps(ky, z)), ty));
+		_mm_storeu_ps(resultZ, _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(iz, x), _mm_mul_ps(jz, y)), _mm_mul_ps(kz, z)), tz));
+
+		for (int lane = 0; lane < 4; lane++)
+		{
+			Vec3& out = *reinterpret_cast<Vec3*>(outBytes + (index + lane) * strideBytes);
+			out.x = resultX[lane];
+			out.y = resultY[lane];
+			out.z = resultZ[lane];
+		}
+	}
+#endif
+
+	for (; index < count; index++)
+	{
+		Vec3 in = *reinterpret_cast<Vec3 const*>(inBytes + index * strideBytes);
+		Vec3& out = *reinterpret_cast<Vec3*>(outBytes + index * strideBytes);
+
+		out.x = (values[Mat44::Ix] * in.x) + (values[Mat44::Jx] * in.y) + (values[Mat44::Kx] * in.z) + translation[0];
+		out.y = (values[Mat44::Iy] * in.x) + (values[Mat44::Jy] * in.y) + (values[Mat44::Ky] * in.z) + translation[1];
+		out.z = (values[Mat44::Iz] * in.x) + (values[Mat44::Jz] * in.y) + (values[Mat44::Kz] * in.z) + translation[2];
+	}
+}
 
 Mat44::Mat44()
 {
@@ -270,6 +380,16 @@ Vec2 const Mat44::TransformPosition2D(Vec2 const& positionXY) const
 
 Vec3 const Mat44::TransformPosition3D(Vec3 const& positionXYZ) const
 {
+#if defined(ENGINE_SIMD_SSE2)
+	__m128 columns[4];
+	LoadColumns(*this, columns);
+
+	float weights[4] = { positionXYZ.x, positionXYZ.y, positionXYZ.z, 1.0f };
+	float result[4];
+	_mm_storeu_ps(result, CombineColumns(columns, weights));
+
+	return Vec3(result[0], result[1], result[2]);
+#else
 	Vec4 aX = Vec4(m_values[Ix], m_values[Jx], m_values[Kx], m_values[Tx]);
 	Vec4 aY = Vec4(m_values[Iy], m_values[Jy], m_values[Ky], m_values[Ty]);
 	Vec4 aZ = Vec4(m_values[Iz], m_values[Jz], m_values[Kz], m_values[Tz]);
@@ -277,16 +397,39 @@ Vec3 const Mat44::TransformPosition3D(Vec3 const& positionXYZ) const
 	Vec4 vectorQuantity = Vec4(positionXYZ.x, positionXYZ.y, positionXYZ.z, 1.0f);
 
 	return Vec3(DotProduct2D(aX, vectorQuantity), DotProduct2D(aY, vectorQuantity), DotProduct2D(aZ, vectorQuantity));
+#endif
 }
 
 Vec4 const Mat44::TransformHomogeneous3D(Vec4 const& homogeneousPoint3D) const
 {
+#if defined(ENGINE_SIMD_SSE2)
+	__m128 columns[4];
+	LoadColumns(*this, columns);
+
+	Vec4 result;
+	_mm_storeu_ps(&result.x, CombineColumns(columns, &homogeneousPoint3D.x));
+
+	return result;
+#else
 	Vec4 aX = Vec4(m_values[Ix], m_values[Jx], m_values[Kx], m_values[Tx]);
 	Vec4 aY = Vec4(m_values[Iy], m_values[Jy], m_values[Ky], m_values[Ty]);
 	Vec4 aZ = Vec4(m_values[Iz], m_values[Jz], m_values[Kz], m_values[Tz]);
 	Vec4 aW = Vec4(m_values[Iw], m_values[Jw], m_values[Kw], m_values[Tw]);
 
 	return Vec4(DotProduct2D(aX, homogeneousPoint3D), DotProduct2D(aY, homogeneousPoint3D), DotProduct2D(aZ, homogeneousPoint3D), DotProduct2D(aW, homogeneousPoint3D));
+#endif
+}
+
+void Mat44::TransformPositions3D(Vec3 const* inPositions, Vec3* outPositions, int count, int strideBytes) const
+{
+	float translation[3] = { m_values[Tx], m_values[Ty], m_values[Tz] };
+	TransformVec3Array(*this, translation, inPositions, outPositions, count, strideBytes);
+}
+
+void Mat44::TransformVectorQuantities3D(Vec3 const* inVectors, Vec3* outVectors, int count, int strideBytes) const
+{
+	float translation[3] = { 0.0f, 0.0f, 0.0f };
+	TransformVec3Array(*this, translation, inVectors, outVectors, count, strideBytes);
 }
 
 float* Mat44::GetAsFloatArray()
@@ -375,6 +518,89 @@ Mat44 const Mat44::GetOrthonormalInverse() const
 	return result;
 }
 
+Mat44 const Mat44::GetInverse() const
+{
+	Mat44 result;
+
+#if defined(ENGINE_SIMD_SSE2)
+	// Block-wise inverse over the four 2x2 sub-matrices | A B / C D |
+	__m128 columns[4];
+	LoadColumns(*this, columns);
+
+	__m128 a = _mm_movelh_ps(columns[0], columns[1]);
+	__m128 b = _mm_movehl_ps(columns[1], columns[0]);
+	__m128 c = _mm_movelh_ps(columns[2], columns[3]);
+	__m128 d = _mm_movehl_ps(columns[3], columns[2]);
+
+	// (|A|, |B|, |C|, |D|)
+	__m128 subDeterminants = _mm_sub_ps(
+		_mm_mul_ps(_mm_shuffle_ps(columns[0], columns[2], SHUFFLE_MASK(0, 2, 0, 2)), _mm_shuffle_ps(columns[1], columns[3], SHUFFLE_MASK(1, 3, 1, 3))),
+		_mm_mul_ps(_mm_shuffle_ps(columns[0], columns[2], SHUFFLE_MASK(1, 3, 1, 3)), _mm_shuffle_ps(columns[1], columns[3], SHUFFLE_MASK(0, 2, 0, 2))));
+
+	__m128 determinantA = SWIZZLE(subDeterminants, 0, 0, 0, 0);
+	__m128 determinantB = SWIZZLE(subDeterminants, 1, 1, 1, 1);
+	__m128 determinantC = SWIZZLE(subDeterminants, 2, 2, 2, 2);
+	__m128 determinantD = SWIZZLE(subDeterminants, 3, 3, 3, 3);
+
+	__m128 adjugateDTimesC = Mat22AdjugateMultiply(d, c);
+	__m128 adjugateATimesB = Mat22AdjugateMultiply(a, b);
+
+	__m128 x = _mm_sub_ps(_mm_mul_ps(determinantD, a), Mat22Multiply(b, adjugateDTimesC));
+	__m128 w = _mm_sub_ps(_mm_mul_ps(determinantA, d), Mat22Multiply(c, adjugateATimesB));
+	__m128 y = _mm_sub_ps(_mm_mul_ps(determinantB, c), Mat22MultiplyAdjugate(d, adjugateATimesB));
+	__m128 z = _mm_sub_ps(_mm_mul_ps(determinantC, b), Mat22MultiplyAdjugate(a, adjugateDTimesC));
+
+	// |M| = |A||D| + |B||C| - trace(adj(A)B adj(D)C)
+	__m128 trace = _mm_mul_ps(adjugateATimesB, SWIZZLE(adjugateDTimesC, 0, 2, 1, 3));
+	trace = _mm_add_ps(trace, SWIZZLE(trace, 2, 3, 0, 1));
+	trace = _mm_add_ps(trace, SWIZZLE(trace, 1, 0, 3, 2));
+
+	__m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(determinantA, determinantD), _mm_mul_ps(determinantB, determinantC)), trace);
+	__m128 inverseDeterminant = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+
+	x = _mm_mul_ps(x, inverseDeterminant);
+	y = _mm_mul_ps(y, inverseDeterminant);
+	z = _mm_mul_ps(z, inverseDeterminant);
+	w = _mm_mul_ps(w, inverseDeterminant);
+
+	// Adjugate each block while scattering it back into columns
+	_mm_storeu_ps(&result.m_values[Ix], _mm_shuffle_ps(x, y, SHUFFLE_MASK(3, 1, 3, 1)));
+	_mm_storeu_ps(&result.m_values[Jx], _mm_shuffle_ps(x, y, SHUFFLE_MASK(2, 0, 2, 0)));
+	_mm_storeu_ps(&result.m_values[Kx], _mm_shuffle_ps(z, w, SHUFFLE_MASK(3, 1, 3, 1)));
+	_mm_storeu_ps(&result.m_values[Tx], _mm_shuffle_ps(z, w, SHUFFLE_MASK(2, 0, 2, 0)));
+#else
+	// Cofactor expansion; the same formula inverts either storage order
+	float const* m = m_values;
+	float* inverse = result.m_values;
+
+	inverse[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] + m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+	inverse[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] - m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+	inverse[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] + m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+	inverse[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] - m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+	inverse[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] - m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+	inverse[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] + m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+	inverse[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] - m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+	inverse[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] + m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+	inverse[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15] + m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
+	inverse[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15] - m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
+	inverse[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15] + m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
+	inverse[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14] - m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
+	inverse[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11] - m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
+	inverse[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11] + m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
+	inverse[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11] - m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
+	inverse[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10] + m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
+
+	float inverseDeterminant = 1.0f / (m[0] * inverse[0] + m[1] * inverse[4] + m[2] * inverse[8] + m[3] * inverse[12]);
+
+	for (int index = 0; index < 16; index++)
+	{
+		inverse[index] *= inverseDeterminant;
+	}
+#endif
+
+	return result;
+}
+
 void Mat44::SetTranslation2D(Vec2 const& translationXY)
 {
 	m_values[Tx] = translationXY.x;
@@ -521,6 +747,16 @@ void Mat44::Orthonormalize_IFwd_JLeft_KUp()
 
 void Mat44::Append(Mat44 const& appendThis)
 {
+#if defined(ENGINE_SIMD_SSE2)
+	// Each result column only reads the matching column of appendThis, so appending a matrix to itself is safe
+	__m128 columns[4];
+	LoadColumns(*this, columns);
+
+	_mm_storeu_ps(&m_values[Ix], CombineColumns(columns, &appendThis.m_values[Ix]));
+	_mm_storeu_ps(&m_values[Jx], CombineColumns(columns, &appendThis.m_values[Jx]));
+	_mm_storeu_ps(&m_values[Kx], CombineColumns(columns, &appendThis.m_values[Kx]));
+	_mm_storeu_ps(&m_values[Tx], CombineColumns(columns, &appendThis.m_values[Tx]));
+#else
 	Vec4 aX = Vec4(m_values[Ix], m_values[Jx], m_values[Kx], m_values[Tx]);
 	Vec4 aY = Vec4(m_values[Iy], m_values[Jy], m_values[Ky], m_values[Ty]);
 	Vec4 aZ = Vec4(m_values[Iz], m_values[Jz], m_values[Kz], m_values[Tz]);
@@ -547,14 +783,16 @@ void Mat44::Append(Mat44 const& appendThis)
 	m_values[Ty] = DotProduct2D(aY, bT);
 	m_values[Tz] = DotProduct2D(aZ, bT);
 	m_values[Tw] = DotProduct2D(aW, bT);
+#endif
 }
 
 void Mat44::AppendZRotation(float degreesRotationAboutZ)
 {
 	Mat44 rotationMatrix;
 
-	float c = CosDegrees(degreesRotationAboutZ);
-	float s = SinDegrees(degreesRotationAboutZ);
+	float c;
+	float s;
+	SinCosDegrees(degreesRotationAboutZ, s, c);
 
 	rotationMatrix.m_values[Ix] = c;
 	rotationMatrix.m_values[Iy] = s;
@@ -580,8 +818,9 @@ void Mat44::AppendYRotation(float degreesRotationAboutY)
 {
 	Mat44 rotationMatrix;
 
-	float c = CosDegrees(degreesRotationAboutY);
-	float s = SinDegrees(degreesRotationAboutY);
+	float c;
+	float s;
+	SinCosDegrees(degreesRotationAboutY, s, c);
 
 	rotationMatrix.m_values[Ix] = c;
 	rotationMatrix.m_values[Iy] = 0;
@@ -607,8 +846,9 @@ void Mat44::AppendXRotation(float degreesRotationAboutX)
 {
 	Mat44 rotationMatrix;
 
-	float c = CosDegrees(degreesRotationAboutX);
-	float s = SinDegrees(degreesRotationAboutX);
+	float c;
+	float s;
+	SinCosDegrees(degreesRotationAboutX, s, c);
 
 	rotationMatrix.m_values[Ix] = 1;
 	rotationMatrix.m_values[Iy] = 0;
@@ -33,6 +33,11 @@ struct Mat44
 	Vec3 const TransformPosition3D(Vec3 const& positionXYZ) const;
 	Vec4 const TransformHomogeneous3D(Vec4 const& homogeneousPoint3D) const;
 
+	// Batch transforms over strided arrays, so positions and normals can be transformed in place inside vertex structs.
+	// strideBytes is the distance between consecutive elements, 0 meaning tightly packed Vec3s; in and out may alias.
+	void TransformPositions3D(Vec3 const* inPositions, Vec3* outPositions, int count, int strideBytes = 0) const;
+	void TransformVectorQuantities3D(Vec3 const* inVectors, Vec3* outVectors, int count, int strideBytes = 0) const;
+
 	float* GetAsFloatArray();
 	float const* GetAsFloatArray() const;
 	Vec2 const GetIBasis2D() const;
@@ -47,6 +52,7 @@ struct Mat44
 	Vec4 const GetKBasis4D() const;
 	Vec4 const GetTranslation4D() const;
 	Mat44 const GetOrthonormalInverse() const;
+	Mat44 const GetInverse() const; // General inverse; a singular matrix gives non-finite values
 
 	void SetTranslation2D(Vec2 const& translationXY);
 	void SetTranslation3D(Vec3 const& translationXYZ);
@@ -7,6 +7,7 @@
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Math/OBB2.hpp"
 #include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/SimdUtils.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 
 #include <stdio.h>
@@ -46,6 +47,110 @@ float TanDegrees(float degrees)
 	return tanf(radians);
 }
 
+void SinCosDegrees(float degrees, float& outSine, float& outCosine)
+{
+	float radians = ConvertDegreesToRadians(degrees);
+
+	outSine = sinf(radians);
+	outCosine = cosf(radians);
+}
+
+constexpr float FAST_TRIG_INVERSE_QUADRANT	= 1.0f / 90.0f;
+constexpr float FAST_TRIG_DEGREES_TO_RADIANS	= 0.01745329251994329577f;
+
+// Cephes single precision coefficients for sin and cos on [-pi/4, pi/4]
+constexpr float FAST_SIN_C0 = -1.6666654611e-1f;
+constexpr float FAST_SIN_C1 = 8.3321608736e-3f;
+constexpr float FAST_SIN_C2 = -1.9515295891e-4f;
+constexpr float FAST_COS_C0 = 4.166664568298827e-2f;
+constexpr float FAST_COS_C1 = -1.388731625493765e-3f;
+constexpr float FAST_COS_C2 = 2.443315711809948e-5f;
+
+void FastSinCosDegrees(float degrees, float& outSine, float& outCosine)
+{
+	int quadrant = static_cast<int>(lrintf(degrees * FAST_TRIG_INVERSE_QUADRANT));
+	float x = (degrees - static_cast<float>(quadrant) * 90.0f) * FAST_TRIG_DEGREES_TO_RADIANS;
+	float z = x * x;
+
+	float sine = x + x * z * ((FAST_SIN_C2 * z + FAST_SIN_C1) * z + FAST_SIN_C0);
+	float cosine = (1.0f - 0.5f * z) + z * z * ((FAST_COS_C2 * z + FAST_COS_C1) * z + FAST_COS_C0);
+
+	if (quadrant & 1)
+	{
+		float temp = sine;
+		sine = cosine;
+		cosine = temp;
+	}
+
+	outSine = (quadrant & 2) ? -sine : sine;
+	outCosine = ((quadrant + 1) & 2) ? -cosine : cosine;
+}
+
+float FastCosDegrees(float degrees)
+{
+	float sine;
+	float cosine;
+	FastSinCosDegrees(degrees, sine, cosine);
+
+	return cosine;
+}
+
+float FastSinDegrees(float degrees)
+{
+	float sine;
+	float cosine;
+	FastSinCosDegrees(degrees, sine, cosine);
+
+	return sine;
+}
+
+void FastSinCosDegrees(float const* degrees, float* outSines, float* outCosines, int count)
+{
+	int index = 0;
+
+#if defined(ENGINE_SIMD_SSE2)
+	__m128 inverseQuadrant = _mm_set1_ps(FAST_TRIG_INVERSE_QUADRANT);
+	__m128 ninety = _mm_set1_ps(90.0f);
+	__m128 toRadians = _mm_set1_ps(FAST_TRIG_DEGREES_TO_RADIANS);
+	__m128 one = _mm_set1_ps(1.0f);
+	__m128 half = _mm_set1_ps(0.5f);
+	__m128i oneBits = _mm_set1_epi32(1);
+	__m128i twoBits = _mm_set1_epi32(2);
+
+	for (; index + 4 <= count; index += 4)
+	{
+		__m128 angles = _mm_loadu_ps(&degrees[index]);
+
+		// Rounds to nearest even like lrintf in the scalar path
+		__m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(angles, inverseQuadrant));
+		__m128 x = _mm_mul_ps(_mm_sub_ps(angles, _mm_mul_ps(_mm_cvtepi32_ps(quadrant), ninety)), toRadians);
+		__m128 z = _mm_mul_ps(x, x);
+
+		__m128 sinePoly = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(FAST_SIN_C2), z), _mm_set1_ps(FAST_SIN_C1)), z), _mm_set1_ps(FAST_SIN_C0));
+		__m128 sine = _mm_add_ps(x, _mm_mul_ps(_mm_mul_ps(x, z), sinePoly));
+
+		__m128 cosinePoly = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(FAST_COS_C2), z), _mm_set1_ps(FAST_COS_C1)), z), _mm_set1_ps(FAST_COS_C0));
+		__m128 cosine = _mm_add_ps(_mm_sub_ps(one, _mm_mul_ps(half, z)), _mm_mul_ps(_mm_mul_ps(z, z), cosinePoly));
+
+		__m128 swapMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, oneBits), oneBits));
+		__m128 swappedSine = _mm_or_ps(_mm_and_ps(swapMask, cosine), _mm_andnot_ps(swapMask, sine));
+		__m128 swappedCosine = _mm_or_ps(_mm_and_ps(swapMask, sine), _mm_andnot_ps(swapMask, cosine));
+
+		// Bit 1 of the quadrant moved up to the sign bit
+		__m128 sineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, twoBits), 30));
+		__m128 cosineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, oneBits), twoBits), 30));
+
+		_mm_storeu_ps(&outSines[index], _mm_xor_ps(swappedSine, sineSign));
+		_mm_storeu_ps(&outCosines[index], _mm_xor_ps(swappedCosine, cosineSign));
+	}
+#endif
+
+	for (; index < count; index++)
+	{
+		FastSinCosDegrees(degrees[index], outSines[index], outCosines[index]);
+	}
+}
+
 float Atan2Degrees(float y, float x)
 {
 	float radians = atan2f(y, x);
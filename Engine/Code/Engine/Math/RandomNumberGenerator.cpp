@@ -1,27 +1,202 @@
 #include "RandomNumberGenerator.hpp"
 
-#include <cstdlib>
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/SimdUtils.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+#include "ThirdParty/Squirrel/RawNoise.hpp"
+
+// Floats come from the top 24 bits so the int to float conversion is exact and the SIMD path rounds the same way
+constexpr float ONE_OVER_MAX_24_BITS = 1.0f / 16777215.0f;
+
+static float ConvertBitsToZeroToOne(unsigned int bits)
+{
+	return static_cast<float>(bits >> 8) * ONE_OVER_MAX_24_BITS;
+}
+
+// Multiply-shift maps the bits onto [0, range) without a divide
+static int ConvertBitsToLessThan(unsigned int bits, unsigned int range)
+{
+	return static_cast<int>((static_cast<unsigned long long>(bits) * range) >> 32);
+}
+
+#if defined(ENGINE_SIMD_SSE2)
+static __m128i MultiplyLow32(__m128i a, __m128i b)
+{
+	__m128i evenProducts = _mm_mul_epu32(a, b);
+	__m128i oddProducts = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(evenProducts, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(oddProducts, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+// Four lanes of Get1dNoiseUint; the constants and shifts must stay in step with RawNoise.hpp
+static __m128i Get1dNoiseUint4(__m128i positions, __m128i seed)
+{
+	__m128i mangledBits = MultiplyLow32(positions, _mm_set1_epi32(static_cast<int>(0xd2a80a23)));
+	mangledBits = _mm_add_epi32(mangledBits, seed);
+	mangledBits = _mm_xor_si128(mangledBits, _mm_srli_epi32(mangledBits, 7));
+	mangledBits = _mm_add_epi32(mangledBits, _mm_set1_epi32(static_cast<int>(0xa884f197)));
+	mangledBits = _mm_xor_si128(mangledBits, _mm_srli_epi32(mangledBits, 8));
+	mangledBits = MultiplyLow32(mangledBits, _mm_set1_epi32(static_cast<int>(0x1b56c4e9)));
+	mangledBits = _mm_xor_si128(mangledBits, _mm_srli_epi32(mangledBits, 11));
+	return mangledBits;
+}
+#endif
+
+RandomNumberGenerator::RandomNumberGenerator(unsigned int seed, unsigned int position)
+	: m_seed(seed), m_position(position)
+{
+}
+
+void RandomNumberGenerator::SetSeed(unsigned int seed)
+{
+	m_seed = seed;
+}
+
+void RandomNumberGenerator::SetPosition(unsigned int position)
+{
+	m_position = position;
+}
+
+unsigned int RandomNumberGenerator::GetSeed() const
+{
+	return m_seed;
+}
+
+unsigned int RandomNumberGenerator::GetPosition() const
+{
+	return m_position;
+}
+
+unsigned int RandomNumberGenerator::RollRandomUint()
+{
+	return GetRandomUintAtPosition(m_position++);
+}
 
 int RandomNumberGenerator::RollRandomIntLessThan(int maxNotInclusive)
 {
-	return rand() % maxNotInclusive;
+	GUARANTEE_OR_DIE(maxNotInclusive > 0, "RollRandomIntLessThan needs a positive max!");
+
+	return ConvertBitsToLessThan(RollRandomUint(), static_cast<unsigned int>(maxNotInclusive));
 }
 
 int RandomNumberGenerator::RollRandomIntInRange(int minInclusive, int maxInclusive)
 {
-	int range = 1 + maxInclusive - minInclusive;
- 	return static_cast<int>(rand() % range) + minInclusive;
+	GUARANTEE_OR_DIE(minInclusive <= maxInclusive, "RollRandomIntInRange needs min <= max!");
+
+	unsigned int range = static_cast<unsigned int>(1 + maxInclusive - minInclusive);
+	return ConvertBitsToLessThan(RollRandomUint(), range) + minInclusive;
 }
 
 float RandomNumberGenerator::RollRandomFloatZeroToOne()
 {
-	return static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+	return ConvertBitsToZeroToOne(RollRandomUint());
 }
 
 float RandomNumberGenerator::RollRandomFloatInRange(float minInclusive, float maxInclusive)
-{  
-	int randomInt = rand();
-	float randFloat = static_cast<float>(randomInt) / static_cast<float>(RAND_MAX);
+{
 	float range = maxInclusive - minInclusive;
-	return (randFloat * range) + minInclusive;
+	return (RollRandomFloatZeroToOne() * range) + minInclusive;
 }
+
+Vec2 RandomNumberGenerator::RollRandomUnitVec2()
+{
+	float degrees = RollRandomFloatZeroToOne() * 360.0f;
+	return Vec2(CosDegrees(degrees), SinDegrees(degrees));
+}
+
+void RandomNumberGenerator::FillRandomUints(unsigned int* outValues, int count)
+{
+	int index = 0;
+
+#if defined(ENGINE_SIMD_SSE2)
+	__m128i seed = _mm_set1_epi32(static_cast<int>(m_seed));
+	__m128i positions = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(m_position)), _mm_setr_epi32(0, 1, 2, 3));
+	__m128i step = _mm_set1_epi32(4);
+
+	for (; index + 4 <= count; index += 4)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(outValues + index), Get1dNoiseUint4(positions, seed));
+		positions = _mm_add_epi32(positions, step);
+	}
+#endif
+
+	for (; index < count; index++)
+	{
+		outValues[index] = GetRandomUintAtPosition(m_position + index);
+	}
+
+	m_position += static_cast<unsigned int>(count);
+}
+
+void RandomNumberGenerator::FillRandomIntsInRange(int* outValues, int count, int minInclusive, int maxInclusive)
+{
+	GUARANTEE_OR_DIE(minInclusive <= maxInclusive, "FillRandomIntsInRange needs min <= max!");
+
+	unsigned int* bits = reinterpret_cast<unsigned int*>(outValues);
+	FillRandomUints(bits, count);
+
+	unsigned int range = static_cast<unsigned int>(1 + maxInclusive - minInclusive);
+
+	for (int index = 0; index < count; index++)
+	{
+		outValues[index] = ConvertBitsToLessThan(bits[index], range) + minInclusive;
+	}
+}
+
+void RandomNumberGenerator::FillRandomFloatsZeroToOne(float* outValues, int count)
+{
+	int index = 0;
+
+#if defined(ENGINE_SIMD_SSE2)
+	__m128i seed = _mm_set1_epi32(static_cast<int>(m_seed));
+	__m128i positions = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(m_position)), _mm_setr_epi32(0, 1, 2, 3));
+	__m128i step = _mm_set1_epi32(4);
+	__m128 scale = _mm_set1_ps(ONE_OVER_MAX_24_BITS);
+
+	for (; index + 4 <= count; index += 4)
+	{
+		__m128i topBits = _mm_srli_epi32(Get1dNoiseUint4(positions, seed), 8);
+		_mm_storeu_ps(outValues + index, _mm_mul_ps(_mm_cvtepi32_ps(topBits), scale));
+		positions = _mm_add_epi32(positions, step);
+	}
+#endif
+
+	for (; index < count; index++)
+	{
+		outValues[index] = ConvertBitsToZeroToOne(GetRandomUintAtPosition(m_position + index));
+	}
+
+	m_position += static_cast<unsigned int>(count);
+}
+
+void RandomNumberGenerator::FillRandomFloatsInRange(float* outValues, int count, float minInclusive, float maxInclusive)
+{
+	FillRandomFloatsZeroToOne(outValues, count);
+
+	float range = maxInclusive - minInclusive;
+
+	for (int index = 0; index < count; index++)
+	{
+		outValues[index] = (outValues[index] * range) + minInclusive;
+	}
+}
+
+void RandomNumberGenerator::FillRandomUnitVec2s(Vec2* outValues, int count)
+{
+	for (int index = 0; index < count; index++)
+	{
+		outValues[index] = RollRandomUnitVec2();
+	}
+}
+
+unsigned int RandomNumberGenerator::GetRandomUintAtPosition(unsigned int position) const
+{
+	return Get1dNoiseUint(static_cast<int>(position), m_seed);
+}
+
+float RandomNumberGenerator::GetRandomFloatZeroToOneAtPosition(unsigned int position) const
+{
+	return ConvertBitsToZeroToOne(GetRandomUintAtPosition(position));
+}
\ No newline at end of file
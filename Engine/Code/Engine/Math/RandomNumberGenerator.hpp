@@ -1,14 +1,38 @@
 #pragma once
 
+struct Vec2;
+
+// Counter-based generator: every roll hashes (seed, position) with SquirrelNoise and advances the position.
+// Each instance owns its state, so jobs can keep their own generators, or share one through the const positional
+// getters, without contention. The same seed and position always replay the same sequence on every platform.
 class RandomNumberGenerator
 {
-	unsigned int m_seed = 0;
-	//int m_position = 0;
+	unsigned int	m_seed			= 0;
+	unsigned int	m_position		= 0;
 public:
-				RandomNumberGenerator() = default;
+					RandomNumberGenerator() = default;
+	explicit		RandomNumberGenerator(unsigned int seed, unsigned int position = 0);
+
+	void			SetSeed(unsigned int seed);
+	void			SetPosition(unsigned int position);
+	unsigned int	GetSeed() const;
+	unsigned int	GetPosition() const;
+
+	unsigned int	RollRandomUint();
+	int				RollRandomIntLessThan(int maxNotInclusive);
+	int				RollRandomIntInRange(int minInclusive, int maxInclusive);
+	float			RollRandomFloatZeroToOne();
+	float			RollRandomFloatInRange(float minInclusive, float maxInclusive);
+	Vec2			RollRandomUnitVec2();
+
+	// Bulk rolls consume count positions and match the same number of single rolls exactly
+	void			FillRandomUints(unsigned int* outValues, int count);
+	void			FillRandomIntsInRange(int* outValues, int count, int minInclusive, int maxInclusive);
+	void			FillRandomFloatsZeroToOne(float* outValues, int count);
+	void			FillRandomFloatsInRange(float* outValues, int count, float minInclusive, float maxInclusive);
+	void			FillRandomUnitVec2s(Vec2* outValues, int count);
 
-	int			RollRandomIntLessThan(int maxNotInclusive);
-	int			RollRandomIntInRange(int minInclusive, int maxInclusive);
-	float		RollRandomFloatZeroToOne();
-	float		RollRandomFloatInRange(float minInclusive, float maxInclusive);
+	// Stateless lookups that leave the position alone
+	unsigned int	GetRandomUintAtPosition(unsigned int position) const;
+	float			GetRandomFloatZeroToOneAtPosition(unsigned int position) const;
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "Engine/Math/Mat44.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/FloatRange.hpp"
+#include "Engine/Math/SimdUtils.hpp"
 
 #include <vector>
 #include <algorithm>
@@ -572,6 +573,9 @@ RaycastResult3D RaycastVsZCylinder3D(Vec3 startPos, Vec3 fwdNormal, float maxDis
 					impactPoint.y = startPos.y + (tZ * (fwdNormal * maxDist).y);
 					impactPoint.z = startPos.z + (tZ * (fwdNormal * maxDist).z);
 
+					if (tZ > 1.0f || GetDistanceXYSquared3D(impactPoint, cylinderStart) > radius * radius)
+						return raycast;
+
 					raycast.m_didImpact = true;
 					raycast.m_impactDist = (impactPoint - startPos).GetLength();
 					raycast.m_impactNormal = Vec3(0.0f, 0.0f, -1.0f);
@@ -587,6 +591,9 @@ RaycastResult3D RaycastVsZCylinder3D(Vec3 startPos, Vec3 fwdNormal, float maxDis
 					impactPoint.y = startPos.y + (tXY * (fwdNormal * maxDist).y);
 					impactPoint.z = startPos.z + (tXY * (fwdNormal * maxDist).z);
 
+					if (impactPoint.z < cylinderStart.z || impactPoint.z > cylinderStart.z + height)
+						return raycast;
+
 					raycast.m_didImpact = true;
 					raycast.m_impactDist = (impactPoint - startPos).GetLength();
 					raycast.m_impactNormal = (impactPoint - Vec3(cylinderStart.x, cylinderStart.y, impactPoint.z)).GetNormalized();
@@ -615,6 +622,9 @@ RaycastResult3D RaycastVsZCylinder3D(Vec3 startPos, Vec3 fwdNormal, float maxDis
 					impactPoint.y = startPos.y + (tZ * (fwdNormal * maxDist).y);
 					impactPoint.z = startPos.z + (tZ * (fwdNormal * maxDist).z);
 
+					if (tZ > 1.0f || GetDistanceXYSquared3D(impactPoint, cylinderStart) > radius * radius)
+						return raycast;
+
 					raycast.m_didImpact = true;
 					raycast.m_impactDist = (impactPoint - startPos).GetLength();
 					raycast.m_impactNormal = Vec3(0.0f, 0.0f, 1.0f);
@@ -630,6 +640,9 @@ RaycastResult3D RaycastVsZCylinder3D(Vec3 startPos, Vec3 fwdNormal, float maxDis
 					impactPoint.y = startPos.y + (tXY * (fwdNormal * maxDist).y);
 					impactPoint.z = startPos.z + (tXY * (fwdNormal * maxDist).z);
 
+					if (impactPoint.z < cylinderStart.z || impactPoint.z > cylinderStart.z + height)
+						return raycast;
+
 					raycast.m_didImpact = true;
 					raycast.m_impactDist = (impactPoint - startPos).GetLength();
 					raycast.m_impactNormal = (impactPoint - Vec3(cylinderStart.x, cylinderStart.y, impactPoint.z)).GetNormalized();
@@ -647,6 +660,9 @@ RaycastResult3D RaycastVsZCylinder3D(Vec3 startPos, Vec3 fwdNormal, float maxDis
 			impactPoint.y = startPos.y + (tXY * (fwdNormal * maxDist).y);
 			impactPoint.z = startPos.z + (tXY * (fwdNormal * maxDist).z);
 
+			if (impactPoint.z < cylinderStart.z || impactPoint.z > cylinderStart.z + height)
+				return raycast;
+
 			raycast.m_didImpact = true;
 			raycast.m_impactDist = (impactPoint - startPos).GetLength();
 			raycast.m_impactNormal = (impactPoint - Vec3(cylinderStart.x, cylinderStart.y, impactPoint.z)).GetNormalized();
@@ -658,3 +674,513 @@ RaycastResult3D RaycastVsZCylinder3D(Vec3 startPos, Vec3 fwdNormal, float maxDis
 
 	return raycast;
 }
+
+RaycastResult3D RaycastVsTriangle3D(Vec3 startPos, Vec3 fwdNormal, float maxDist, Vec3 vertexA, Vec3 vertexB, Vec3 vertexC)
+{
+	RaycastResult3D raycast;
+	raycast.m_rayStartPos = startPos;
+	raycast.m_rayFwdNormal = fwdNormal;
+	raycast.m_rayMaxLength = maxDist;
+	raycast.m_impactPos = startPos + (maxDist * fwdNormal);
+
+	// Moller-Trumbore: solve for the impact distance and the barycentric u, v in one go
+	Vec3 edgeAB = vertexB - vertexA;
+	Vec3 edgeAC = vertexC - vertexA;
+
+	Vec3 pVec = CrossProduct3D(fwdNormal, edgeAC);
+	float determinant = DotProduct3D(edgeAB, pVec);
+
+	if (fabsf(determinant) < 1e-12f)
+		return raycast;
+
+	float inverseDeterminant = 1.0f / determinant;
+
+	Vec3 aToStart = startPos - vertexA;
+	float u = DotProduct3D(aToStart, pVec) * inverseDeterminant;
+
+	if (u < 0.0f || u > 1.0f)
+		return raycast;
+
+	Vec3 qVec = CrossProduct3D(aToStart, edgeAB);
+	float v = DotProduct3D(fwdNormal, qVec) * inverseDeterminant;
+
+	if (v < 0.0f || u + v > 1.0f)
+		return raycast;
+
+	float impactDist = DotProduct3D(edgeAC, qVec) * inverseDeterminant;
+
+	if (impactDist < 0.0f || impactDist > maxDist)
+		return raycast;
+
+	Vec3 normal = CrossProduct3D(edgeAB, edgeAC).GetNormalized();
+
+	raycast.m_didImpact = true;
+	raycast.m_impactDist = impactDist;
+	raycast.m_impactPos = startPos + (impactDist * fwdNormal);
+	raycast.m_impactNormal = DotProduct3D(normal, fwdNormal) > 0.0f ? -1.0f * normal : normal;
+
+	return raycast;
+}
+
+void RayPacket2D::SetRay(int lane, Vec2 const& startPos, Vec2 const& fwdNormal, float maxDist)
+{
+	m_startX[lane] = startPos.x;
+	m_startY[lane] = startPos.y;
+	m_fwdX[lane] = fwdNormal.x;
+	m_fwdY[lane] = fwdNormal.y;
+	m_maxDist[lane] = maxDist;
+}
+
+void RayPacket3D::SetRay(int lane, Vec3 const& startPos, Vec3 const& fwdNormal, float maxDist)
+{
+	m_startX[lane] = startPos.x;
+	m_startY[lane] = startPos.y;
+	m_startZ[lane] = startPos.z;
+	m_fwdX[lane] = fwdNormal.x;
+	m_fwdY[lane] = fwdNormal.y;
+	m_fwdZ[lane] = fwdNormal.z;
+	m_maxDist[lane] = maxDist;
+}
+
+// Per-lane primitives. The two packet shapes broadcast either the ray or the primitive and share one kernel each.
+struct DiscLanes
+{
+	float	m_centerX[RAYCAST_PACKET_WIDTH];
+	float	m_centerY[RAYCAST_PACKET_WIDTH];
+	float	m_radius[RAYCAST_PACKET_WIDTH];
+};
+
+struct SphereLanes
+{
+	float	m_centerX[RAYCAST_PACKET_WIDTH];
+	float	m_centerY[RAYCAST_PACKET_WIDTH];
+	float	m_centerZ[RAYCAST_PACKET_WIDTH];
+	float	m_radius[RAYCAST_PACKET_WIDTH];
+};
+
+struct AABB3Lanes
+{
+	float	m_minX[RAYCAST_PACKET_WIDTH];
+	float	m_minY[RAYCAST_PACKET_WIDTH];
+	float	m_minZ[RAYCAST_PACKET_WIDTH];
+	float	m_maxX[RAYCAST_PACKET_WIDTH];
+	float	m_maxY[RAYCAST_PACKET_WIDTH];
+	float	m_maxZ[RAYCAST_PACKET_WIDTH];
+};
+
+#if defined(ENGINE_SIMD_SSE2)
+static __m128 SelectLanes(__m128 mask, __m128 ifTrue, __m128 ifFalse)
+{
+	return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+}
+
+static __m128 NegateLanes(__m128 value)
+{
+	return _mm_xor_ps(value, _mm_set1_ps(-0.0f));
+}
+
+// std::min and std::max semantics, so ties and NaNs pick the same operand as the scalar code
+static __m128 MinLanes(__m128 a, __m128 b)
+{
+	return SelectLanes(_mm_cmplt_ps(b, a), b, a);
+}
+
+static __m128 MaxLanes(__m128 a, __m128 b)
+{
+	return SelectLanes(_mm_cmplt_ps(a, b), b, a);
+}
+
+static __m128 IsOnRangeLanes(__m128 value, __m128 rangeMin, __m128 rangeMax)
+{
+	return _mm_and_ps(_mm_cmpge_ps(value, rangeMin), _mm_cmple_ps(value, rangeMax));
+}
+#else
+static void StoreLane(RaycastPacketResult2D& result, int lane, RaycastResult2D const& raycast)
+{
+	if (!raycast.m_didImpact)
+		return;
+
+	result.m_didImpactMask |= 1 << lane;
+	result.m_impactDist[lane] = raycast.m_impactDist;
+	result.m_impactPosX[lane] = raycast.m_impactPos.x;
+	result.m_impactPosY[lane] = raycast.m_impactPos.y;
+	result.m_impactNormalX[lane] = raycast.m_impactNormal.x;
+	result.m_impactNormalY[lane] = raycast.m_impactNormal.y;
+}
+
+static void StoreLane(RaycastPacketResult3D& result, int lane, RaycastResult3D const& raycast)
+{
+	if (!raycast.m_didImpact)
+		return;
+
+	result.m_didImpactMask |= 1 << lane;
+	result.m_impactDist[lane] = raycast.m_impactDist;
+	result.m_impactPosX[lane] = raycast.m_impactPos.x;
+	result.m_impactPosY[lane] = raycast.m_impactPos.y;
+	result.m_impactPosZ[lane] = raycast.m_impactPos.z;
+	result.m_impactNormalX[lane] = raycast.m_impactNormal.x;
+	result.m_impactNormalY[lane] = raycast.m_impactNormal.y;
+	result.m_impactNormalZ[lane] = raycast.m_impactNormal.z;
+}
+#endif
+
+static RaycastPacketResult2D RaycastDiscLanes(RayPacket2D const& rays, DiscLanes const& discs)
+{
+	RaycastPacketResult2D result;
+
+#if defined(ENGINE_SIMD_SSE2)
+	__m128 startX = _mm_loadu_ps(rays.m_startX);
+	__m128 startY = _mm_loadu_ps(rays.m_startY);
+	__m128 fwdX = _mm_loadu_ps(rays.m_fwdX);
+	__m128 fwdY = _mm_loadu_ps(rays.m_fwdY);
+	__m128 maxDist = _mm_loadu_ps(rays.m_maxDist);
+	__m128 centerX = _mm_loadu_ps(discs.m_centerX);
+	__m128 centerY = _mm_loadu_ps(discs.m_centerY);
+	__m128 radius = _mm_loadu_ps(discs.m_radius);
+	__m128 zero = _mm_setzero_ps();
+
+	// Same normalize as Vec2::GetNormalized, leaving zero vectors at zero
+	__m128 fwdLengthSquared = _mm_add_ps(_mm_mul_ps(fwdX, fwdX), _mm_mul_ps(fwdY, fwdY));
+	__m128 fwdScale = _mm_and_ps(_mm_cmpgt_ps(fwdLengthSquared, zero), _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(fwdLengthSquared)));
+	__m128 iBasisX = _mm_mul_ps(fwdX, fwdScale);
+	__m128 iBasisY = _mm_mul_ps(fwdY, fwdScale);
+
+	__m128 centerToStartX = _mm_sub_ps(centerX, startX);
+	__m128 centerToStartY = _mm_sub_ps(centerY, startY);
+
+	__m128 jMagnitude = _mm_add_ps(_mm_mul_ps(centerToStartX, NegateLanes(iBasisY)), _mm_mul_ps(centerToStartY, iBasisX));
+	// Lanes that have already missed keep computing; the packet only stops once every lane is out
+	__m128 isMiss = _mm_or_ps(_mm_cmpge_ps(jMagnitude, radius), _mm_cmple_ps(jMagnitude, NegateLanes(radius)));
+
+	if (_mm_movemask_ps(isMiss) == (1 << RAYCAST_PACKET_WIDTH) - 1)
+		return result;
+
+	__m128 a = _mm_sqrt_ps(_mm_sub_ps(_mm_mul_ps(radius, radius), _mm_mul_ps(jMagnitude, jMagnitude)));
+	__m128 iMagnitude = _mm_add_ps(_mm_mul_ps(centerToStartX, iBasisX), _mm_mul_ps(centerToStartY, iBasisY));
+	__m128 impactDist = _mm_sub_ps(iMagnitude, a);
+	isMiss = _mm_or_ps(isMiss, _mm_cmple_ps(maxDist, impactDist));
+
+	__m128 startToCenterX = _mm_sub_ps(startX, centerX);
+	__m128 startToCenterY = _mm_sub_ps(startY, centerY);
+	__m128 startDistance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(startToCenterX, startToCenterX), _mm_mul_ps(startToCenterY, startToCenterY)));
+	__m128 isInside = _mm_cmplt_ps(startDistance, radius);
+	isMiss = _mm_or_ps(isMiss, _mm_andnot_ps(isInside, _mm_cmple_ps(iMagnitude, zero)));
+
+	__m128 impactPosX = _mm_add_ps(startX, _mm_mul_ps(iBasisX, impactDist));
+	__m128 impactPosY = _mm_add_ps(startY, _mm_mul_ps(iBasisY, impactDist));
+
+	__m128 normalX = _mm_sub_ps(impactPosX, centerX);
+	__m128 normalY = _mm_sub_ps(impactPosY, centerY);
+	__m128 normalLengthSquared = _mm_add_ps(_mm_mul_ps(normalX, normalX), _mm_mul_ps(normalY, normalY));
+	__m128 normalScale = _mm_and_ps(_mm_cmpgt_ps(normalLengthSquared, zero), _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(normalLengthSquared)));
+
+	_mm_storeu_ps(result.m_impactDist, SelectLanes(isInside, zero, impactDist));
+	_mm_storeu_ps(result.m_impactPosX, SelectLanes(isInside, startX, impactPosX));
+	_mm_storeu_ps(result.m_impactPosY, SelectLanes(isInside, startY, impactPosY));
+	_mm_storeu_ps(result.m_impactNormalX, SelectLanes(isInside, NegateLanes(iBasisX), _mm_mul_ps(normalX, normalScale)));
+	_mm_storeu_ps(result.m_impactNormalY, SelectLanes(isInside, NegateLanes(iBasisY), _mm_mul_ps(normalY, normalScale)));
+
+	result.m_didImpactMask = _mm_movemask_ps(isMiss) ^ ((1 << RAYCAST_PACKET_WIDTH) - 1);
+#else
+	for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+	{
+		RaycastResult2D raycast = RaycastVsDisc2D(Vec2(rays.m_startX[lane], rays.m_startY[lane]), Vec2(rays.m_fwdX[lane], rays.m_fwdY[lane]), rays.m_maxDist[lane], Vec2(discs.m_centerX[lane], discs.m_centerY[lane]), discs.m_radius[lane]);
+		StoreLane(result, lane, raycast);
+	}
+#endif
+
+	return result;
+}
+
+static RaycastPacketResult3D RaycastSphereLanes(RayPacket3D const& rays, SphereLanes const& spheres)
+{
+	RaycastPacketResult3D result;
+
+#if defined(ENGINE_SIMD_SSE2)
+	__m128 startX = _mm_loadu_ps(rays.m_startX);
+	__m128 startY = _mm_loadu_ps(rays.m_startY);
+	__m128 startZ = _mm_loadu_ps(rays.m_startZ);
+	__m128 fwdX = _mm_loadu_ps(rays.m_fwdX);
+	__m128 fwdY = _mm_loadu_ps(rays.m_fwdY);
+	__m128 fwdZ = _mm_loadu_ps(rays.m_fwdZ);
+	__m128 maxDist = _mm_loadu_ps(rays.m_maxDist);
+	__m128 centerX = _mm_loadu_ps(spheres.m_centerX);
+	__m128 centerY = _mm_loadu_ps(spheres.m_centerY);
+	__m128 centerZ = _mm_loadu_ps(spheres.m_centerZ);
+	__m128 radius = _mm_loadu_ps(spheres.m_radius);
+	__m128 zero = _mm_setzero_ps();
+
+	__m128 centerVecX = _mm_sub_ps(centerX, startX);
+	__m128 centerVecY = _mm_sub_ps(centerY, startY);
+	__m128 centerVecZ = _mm_sub_ps(centerZ, startZ);
+
+	__m128 centerDistance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(centerVecX, fwdX), _mm_mul_ps(centerVecY, fwdY)), _mm_mul_ps(centerVecZ, fwdZ));
+	__m128 isMiss = _mm_or_ps(_mm_cmple_ps(centerDistance, zero), _mm_cmpge_ps(centerDistance, _mm_add_ps(maxDist, radius)));
+
+	__m128 jkX = _mm_sub_ps(centerVecX, _mm_mul_ps(centerDistance, fwdX));
+	__m128 jkY = _mm_sub_ps(centerVecY, _mm_mul_ps(centerDistance, fwdY));
+	__m128 jkZ = _mm_sub_ps(centerVecZ, _mm_mul_ps(centerDistance, fwdZ));
+	__m128 jkLengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(jkX, jkX), _mm_mul_ps(jkY, jkY)), _mm_mul_ps(jkZ, jkZ));
+	__m128 radiusSquared = _mm_mul_ps(radius, radius);
+	isMiss = _mm_or_ps(isMiss, _mm_cmpge_ps(jkLengthSquared, radiusSquared));
+
+	if (_mm_movemask_ps(isMiss) == (1 << RAYCAST_PACKET_WIDTH) - 1)
+		return result;
+
+	// (-v) * (-v) == v * v, so the center vector gives the same start-to-center length as the scalar inside test
+	__m128 startLengthSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(centerVecX, centerVecX), _mm_mul_ps(centerVecY, centerVecY)), _mm_mul_ps(centerVecZ, centerVecZ));
+	__m128 isInside = _mm_cmplt_ps(startLengthSquared, radiusSquared);
+
+	__m128 impactDist = _mm_sub_ps(centerDistance, _mm_sqrt_ps(_mm_sub_ps(radiusSquared, jkLengthSquared)));
+	isMiss = _mm_or_ps(isMiss, _mm_andnot_ps(isInside, _mm_cmpge_ps(impactDist, maxDist)));
+
+	__m128 impactPosX = _mm_add_ps(startX, _mm_mul_ps(impactDist, fwdX));
+	__m128 impactPosY = _mm_add_ps(startY, _mm_mul_ps(impactDist, fwdY));
+	__m128 impactPosZ = _mm_add_ps(startZ, _mm_mul_ps(impactDist, fwdZ));
+
+	__m128 normalX = _mm_sub_ps(impactPosX, centerX);
+	__m128 normalY = _mm_sub_ps(impactPosY, centerY);
+	__m128 normalZ = _mm_sub_ps(impactPosZ, centerZ);
+	__m128 normalLength = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(normalX, normalX), _mm_mul_ps(normalY, normalY)), _mm_mul_ps(normalZ, normalZ)));
+
+	_mm_storeu_ps(result.m_impactDist, SelectLanes(isInside, zero, impactDist));
+	_mm_storeu_ps(result.m_impactPosX, SelectLanes(isInside, startX, impactPosX));
+	_mm_storeu_ps(result.m_impactPosY, SelectLanes(isInside, startY, impactPosY));
+	_mm_storeu_ps(result.m_impactPosZ, SelectLanes(isInside, startZ, impactPosZ));
+	_mm_storeu_ps(result.m_impactNormalX, SelectLanes(isInside, NegateLanes(fwdX), _mm_div_ps(normalX, normalLength)));
+	_mm_storeu_ps(result.m_impactNormalY, SelectLanes(isInside, NegateLanes(fwdY), _mm_div_ps(normalY, normalLength)));
+	_mm_storeu_ps(result.m_impactNormalZ, SelectLanes(isInside, NegateLanes(fwdZ), _mm_div_ps(normalZ, normalLength)));
+
+	result.m_didImpactMask = _mm_movemask_ps(isMiss) ^ ((1 << RAYCAST_PACKET_WIDTH) - 1);
+#else
+	for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+	{
+		RaycastResult3D raycast = RaycastVsSphere3D(Vec3(rays.m_startX[lane], rays.m_startY[lane], rays.m_startZ[lane]), Vec3(rays.m_fwdX[lane], rays.m_fwdY[lane], rays.m_fwdZ[lane]), rays.m_maxDist[lane], Vec3(spheres.m_centerX[lane], spheres.m_centerY[lane], spheres.m_centerZ[lane]), spheres.m_radius[lane]);
+		StoreLane(result, lane, raycast);
+	}
+#endif
+
+	return result;
+}
+
+static RaycastPacketResult3D RaycastAABB3Lanes(RayPacket3D const& rays, AABB3Lanes const& boxes)
+{
+	RaycastPacketResult3D result;
+
+#if defined(ENGINE_SIMD_SSE2)
+	__m128 startX = _mm_loadu_ps(rays.m_startX);
+	__m128 startY = _mm_loadu_ps(rays.m_startY);
+	__m128 startZ = _mm_loadu_ps(rays.m_startZ);
+	__m128 fwdX = _mm_loadu_ps(rays.m_fwdX);
+	__m128 fwdY = _mm_loadu_ps(rays.m_fwdY);
+	__m128 fwdZ = _mm_loadu_ps(rays.m_fwdZ);
+	__m128 maxDist = _mm_loadu_ps(rays.m_maxDist);
+	__m128 minX = _mm_loadu_ps(boxes.m_minX);
+	__m128 minY = _mm_loadu_ps(boxes.m_minY);
+	__m128 minZ = _mm_loadu_ps(boxes.m_minZ);
+	__m128 maxX = _mm_loadu_ps(boxes.m_maxX);
+	__m128 maxY = _mm_loadu_ps(boxes.m_maxY);
+	__m128 maxZ = _mm_loadu_ps(boxes.m_maxZ);
+	__m128 zero = _mm_setzero_ps();
+	__m128 one = _mm_set1_ps(1.0f);
+
+	__m128 endX = _mm_add_ps(startX, _mm_mul_ps(fwdX, maxDist));
+	__m128 endY = _mm_add_ps(startY, _mm_mul_ps(fwdY, maxDist));
+	__m128 endZ = _mm_add_ps(startZ, _mm_mul_ps(fwdZ, maxDist));
+
+	// Box of the ray segment, rejected with the same strict test as DoAABB3sOverlap
+	__m128 isMiss = _mm_or_ps(_mm_cmple_ps(maxX, MinLanes(startX, endX)), _mm_cmpge_ps(minX, MaxLanes(startX, endX)));
+	isMiss = _mm_or_ps(isMiss, _mm_or_ps(_mm_cmple_ps(maxY, MinLanes(startY, endY)), _mm_cmpge_ps(minY, MaxLanes(startY, endY))));
+	isMiss = _mm_or_ps(isMiss, _mm_or_ps(_mm_cmple_ps(maxZ, MinLanes(startZ, endZ)), _mm_cmpge_ps(minZ, MaxLanes(startZ, endZ))));
+
+	if (_mm_movemask_ps(isMiss) == (1 << RAYCAST_PACKET_WIDTH) - 1)
+		return result;
+
+	__m128 isInside = _mm_and_ps(_mm_and_ps(_mm_cmpgt_ps(startX, minX), _mm_cmplt_ps(startX, maxX)), _mm_and_ps(_mm_cmpgt_ps(startY, minY), _mm_cmplt_ps(startY, maxY)));
+	isInside = _mm_and_ps(isInside, _mm_and_ps(_mm_cmpgt_ps(startZ, minZ), _mm_cmplt_ps(startZ, maxZ)));
+
+	__m128 displacementX = _mm_sub_ps(endX, startX);
+	__m128 displacementY = _mm_sub_ps(endY, startY);
+	__m128 displacementZ = _mm_sub_ps(endZ, startZ);
+
+	__m128 tXFirst = _mm_div_ps(_mm_sub_ps(minX, startX), displacementX);
+	__m128 tXSecond = _mm_div_ps(_mm_sub_ps(maxX, startX), displacementX);
+	__m128 tYFirst = _mm_div_ps(_mm_sub_ps(minY, startY), displacementY);
+	__m128 tYSecond = _mm_div_ps(_mm_sub_ps(maxY, startY), displacementY);
+	__m128 tZFirst = _mm_div_ps(_mm_sub_ps(minZ, startZ), displacementZ);
+	__m128 tZSecond = _mm_div_ps(_mm_sub_ps(maxZ, startZ), displacementZ);
+
+	__m128 tXMin = MinLanes(tXFirst, tXSecond);
+	__m128 tXMax = MaxLanes(tXFirst, tXSecond);
+	__m128 tYMin = MinLanes(tYFirst, tYSecond);
+	__m128 tYMax = MaxLanes(tYFirst, tYSecond);
+	__m128 tZMin = MinLanes(tZFirst, tZSecond);
+	__m128 tZMax = MaxLanes(tZFirst, tZSecond);
+
+	__m128 xOverlapY = _mm_and_ps(_mm_cmple_ps(tXMin, tYMax), _mm_cmpge_ps(tXMax, tYMin));
+	__m128 yOverlapZ = _mm_and_ps(_mm_cmple_ps(tYMin, tZMax), _mm_cmpge_ps(tYMax, tZMin));
+	__m128 zOverlapX = _mm_and_ps(_mm_cmple_ps(tZMin, tXMax), _mm_cmpge_ps(tZMax, tXMin));
+	__m128 isSlabHit = _mm_and_ps(_mm_and_ps(xOverlapY, yOverlapZ), zOverlapX);
+	isMiss = _mm_or_ps(isMiss, _mm_andnot_ps(isInside, _mm_andnot_ps(isSlabHit, _mm_cmpeq_ps(zero, zero))));
+
+	// The scalar version picks its impact face from the smallest slab value lying inside another axis' range
+	__m128 candidates[8]	= { tXMin, tXMax, tYMin, tYMax, tZMax, tZMin, tZMax, tZMin };
+	__m128 rangeMins[8]		= { tYMin, tYMin, tXMin, tXMin, tXMin, tXMin, tYMin, tYMin };
+	__m128 rangeMaxs[8]		= { tYMax, tYMax, tXMax, tXMax, tXMax, tXMax, tYMax, tYMax };
+
+	__m128 t = _mm_set1_ps(FLT_MAX);
+
+	for (int candidateIndex = 0; candidateIndex < 8; candidateIndex++)
+	{
+		__m128 isCloser = _mm_and_ps(IsOnRangeLanes(candidates[candidateIndex], rangeMins[candidateIndex], rangeMaxs[candidateIndex]), _mm_cmplt_ps(candidates[candidateIndex], t));
+		t = SelectLanes(isCloser, candidates[candidateIndex], t);
+	}
+
+	__m128 faces[6]			= { tXMin, tXMax, tYMin, tYMax, tZMin, tZMax };
+	float faceNormals[6][3]	= { { -1.0f, 0.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, -1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, -1.0f }, { 0.0f, 0.0f, 1.0f } };
+
+	__m128 normalX = zero;
+	__m128 normalY = zero;
+	__m128 normalZ = zero;
+	__m128 isUnassigned = _mm_cmpeq_ps(zero, zero);
+
+	for (int faceIndex = 0; faceIndex < 6; faceIndex++)
+	{
+		__m128 isFace = _mm_and_ps(isUnassigned, _mm_cmpeq_ps(t, faces[faceIndex]));
+		normalX = SelectLanes(isFace, _mm_set1_ps(faceNormals[faceIndex][0]), normalX);
+		normalY = SelectLanes(isFace, _mm_set1_ps(faceNormals[faceIndex][1]), normalY);
+		normalZ = SelectLanes(isFace, _mm_set1_ps(faceNormals[faceIndex][2]), normalZ);
+		isUnassigned = _mm_andnot_ps(isFace, isUnassigned);
+	}
+
+	__m128 entryT = SelectLanes(_mm_cmplt_ps(tXMin, tYMin), SelectLanes(_mm_cmplt_ps(tYMin, tZMin), tZMin, tYMin), SelectLanes(_mm_cmplt_ps(tXMin, tZMin), tZMin, tXMin));
+
+	__m128 impactPosX = _mm_add_ps(startX, _mm_mul_ps(_mm_mul_ps(entryT, fwdX), maxDist));
+	__m128 impactPosY = _mm_add_ps(startY, _mm_mul_ps(_mm_mul_ps(entryT, fwdY), maxDist));
+	__m128 impactPosZ = _mm_add_ps(startZ, _mm_mul_ps(_mm_mul_ps(entryT, fwdZ), maxDist));
+
+	__m128 impactOffsetX = _mm_sub_ps(impactPosX, startX);
+	__m128 impactOffsetY = _mm_sub_ps(impactPosY, startY);
+	__m128 impactOffsetZ = _mm_sub_ps(impactPosZ, startZ);
+	__m128 impactDist = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(impactOffsetX, impactOffsetX), _mm_mul_ps(impactOffsetY, impactOffsetY)), _mm_mul_ps(impactOffsetZ, impactOffsetZ)));
+
+	__m128 minusOne = NegateLanes(one);
+
+	_mm_storeu_ps(result.m_impactDist, SelectLanes(isInside, zero, impactDist));
+	_mm_storeu_ps(result.m_impactPosX, SelectLanes(isInside, startX, impactPosX));
+	_mm_storeu_ps(result.m_impactPosY, SelectLanes(isInside, startY, impactPosY));
+	_mm_storeu_ps(result.m_impactPosZ, SelectLanes(isInside, startZ, impactPosZ));
+	_mm_storeu_ps(result.m_impactNormalX, SelectLanes(isInside, _mm_mul_ps(minusOne, fwdX), normalX));
+	_mm_storeu_ps(result.m_impactNormalY, SelectLanes(isInside, _mm_mul_ps(minusOne, fwdY), normalY));
+	_mm_storeu_ps(result.m_impactNormalZ, SelectLanes(isInside, _mm_mul_ps(minusOne, fwdZ), normalZ));
+
+	result.m_didImpactMask = _mm_movemask_ps(isMiss) ^ ((1 << RAYCAST_PACKET_WIDTH) - 1);
+#else
+	for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+	{
+		AABB3 bounds = AABB3(boxes.m_minX[lane], boxes.m_minY[lane], boxes.m_minZ[lane], boxes.m_maxX[lane], boxes.m_maxY[lane], boxes.m_maxZ[lane]);
+		RaycastResult3D raycast = RaycastVsAABB3D(Vec3(rays.m_startX[lane], rays.m_startY[lane], rays.m_startZ[lane]), Vec3(rays.m_fwdX[lane], rays.m_fwdY[lane], rays.m_fwdZ[lane]), rays.m_maxDist[lane], bounds);
+		StoreLane(result, lane, raycast);
+	}
+#endif
+
+	return result;
+}
+
+RaycastPacketResult2D RaycastPacketVsDisc2D(RayPacket2D const& rays, Vec2 discCenter, float discRadius)
+{
+	DiscLanes discs;
+
+	for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+	{
+		discs.m_centerX[lane] = discCenter.x;
+		discs.m_centerY[lane] = discCenter.y;
+		discs.m_radius[lane] = discRadius;
+	}
+
+	return RaycastDiscLanes(rays, discs);
+}
+
+RaycastPacketResult3D RaycastPacketVsAABB3D(RayPacket3D const& rays, AABB3 const& bounds)
+{
+	AABB3Lanes boxes;
+
+	for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+	{
+		boxes.m_minX[lane] = bounds.m_mins.x;
+		boxes.m_minY[lane] = bounds.m_mins.y;
+		boxes.m_minZ[lane] = bounds.m_mins.z;
+		boxes.m_maxX[lane] = bounds.m_maxs.x;
+		boxes.m_maxY[lane] = bounds.m_maxs.y;
+		boxes.m_maxZ[lane] = bounds.m_maxs.z;
+	}
+
+	return RaycastAABB3Lanes(rays, boxes);
+}
+
+RaycastPacketResult3D RaycastPacketVsSphere3D(RayPacket3D const& rays, Vec3 sphereCenter, float sphereRadius)
+{
+	SphereLanes spheres;
+
+	for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+	{
+		spheres.m_centerX[lane] = sphereCenter.x;
+		spheres.m_centerY[lane] = sphereCenter.y;
+		spheres.m_centerZ[lane] = sphereCenter.z;
+		spheres.m_radius[lane] = sphereRadius;
+	}
+
+	return RaycastSphereLanes(rays, spheres);
+}
+
+RaycastPacketResult2D RaycastVsDiscs2D(Vec2 startPos, Vec2 fwdNormal, float maxDist, Vec2 const* discCenters, float const* discRadii)
+{
+	RayPacket2D rays;
+	DiscLanes discs;
+
+	for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+	{
+		rays.SetRay(lane, startPos, fwdNormal, maxDist);
+		discs.m_centerX[lane] = discCenters[lane].x;
+		discs.m_centerY[lane] = discCenters[lane].y;
+		discs.m_radius[lane] = discRadii[lane];
+	}
+
+	return RaycastDiscLanes(rays, discs);
+}
+
+RaycastPacketResult3D RaycastVsAABB3s(Vec3 startPos, Vec3 fwdNormal, float maxDist, AABB3 const* boxes)
+{
+	RayPacket3D rays;
+	AABB3Lanes boxLanes;
+
+	for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+	{
+		rays.SetRay(lane, startPos, fwdNormal, maxDist);
+		boxLanes.m_minX[lane] = boxes[lane].m_mins.x;
+		boxLanes.m_minY[lane] = boxes[lane].m_mins.y;
+		boxLanes.m_minZ[lane] = boxes[lane].m_mins.z;
+		boxLanes.m_maxX[lane] = boxes[lane].m_maxs.x;
+		boxLanes.m_maxY[lane] = boxes[lane].m_maxs.y;
+		boxLanes.m_maxZ[lane] = boxes[lane].m_maxs.z;
+	}
+
+	return RaycastAABB3Lanes(rays, boxLanes);
+}
+
+RaycastPacketResult3D RaycastVsSpheres3D(Vec3 startPos, Vec3 fwdNormal, float maxDist, Vec3 const* sphereCenters, float const* sphereRadii)
+{
+	RayPacket3D rays;
+	SphereLanes spheres;
+
+	for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+	{
+		rays.SetRay(lane, startPos, fwdNormal, maxDist);
+		spheres.m_centerX[lane] = sphereCenters[lane].x;
+		spheres.m_centerY[lane] = sphereCenters[lane].y;
+		spheres.m_centerZ[lane] = sphereCenters[lane].z;
+		spheres.m_radius[lane] = sphereRadii[lane];
+	}
+
+	return RaycastSphereLanes(rays, spheres);
+}
\ No newline at end of file
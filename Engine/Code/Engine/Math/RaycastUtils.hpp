@@ -35,6 +35,60 @@ struct RaycastResult3D
 	float	m_rayMaxLength = 1.f;
 };
 
+constexpr int RAYCAST_PACKET_WIDTH = 4;
+
+// Structure-of-arrays batches for the packet raycasts below. Lane i of a packet call gives the same hit, distance and
+// normal as the scalar RaycastVs call for that lane; only lanes set in m_didImpactMask carry impact data.
+struct RayPacket2D
+{
+	float	m_startX[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_startY[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_fwdX[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_fwdY[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_maxDist[RAYCAST_PACKET_WIDTH]		= {};
+
+	void	SetRay(int lane, Vec2 const& startPos, Vec2 const& fwdNormal, float maxDist);
+};
+
+struct RayPacket3D
+{
+	float	m_startX[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_startY[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_startZ[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_fwdX[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_fwdY[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_fwdZ[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_maxDist[RAYCAST_PACKET_WIDTH]		= {};
+
+	void	SetRay(int lane, Vec3 const& startPos, Vec3 const& fwdNormal, float maxDist);
+};
+
+struct RaycastPacketResult2D
+{
+	int		m_didImpactMask							= 0;
+	float	m_impactDist[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_impactPosX[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_impactPosY[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_impactNormalX[RAYCAST_PACKET_WIDTH]	= {};
+	float	m_impactNormalY[RAYCAST_PACKET_WIDTH]	= {};
+
+	bool	DidImpact(int lane) const { return (m_didImpactMask & (1 << lane)) != 0; }
+};
+
+struct RaycastPacketResult3D
+{
+	int		m_didImpactMask							= 0;
+	float	m_impactDist[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_impactPosX[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_impactPosY[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_impactPosZ[RAYCAST_PACKET_WIDTH]		= {};
+	float	m_impactNormalX[RAYCAST_PACKET_WIDTH]	= {};
+	float	m_impactNormalY[RAYCAST_PACKET_WIDTH]	= {};
+	float	m_impactNormalZ[RAYCAST_PACKET_WIDTH]	= {};
+
+	bool	DidImpact(int lane) const { return (m_didImpactMask & (1 << lane)) != 0; }
+};
+
 RaycastResult2D RaycastVsDisc2D(Vec2 startPos, Vec2 fwdNormal, float maxDist, Vec2 discCenter, float discRadius);
 RaycastResult2D RaycastVsLineSegment2D(Vec2 startPos, Vec2 fwdNormal, float maxDist, Vec2 lineStart, Vec2 lineEnd);
 RaycastResult2D RaycastVsAABB2D(Vec2 startPos, Vec2 fwdNormal, float maxDist, AABB2 const& bounds);
@@ -42,4 +96,15 @@ RaycastResult3D RaycastVsAABB3D(Vec3 startPos, Vec3 fwdNormal, float maxDist, AA
 RaycastResult3D RaycastVsOBB3D(Vec3 startPos, Vec3 fwdNormal, float maxDist, OBB3 const& box);
 RaycastResult3D RaycastVsPlane3D(Vec3 startPos, Vec3 fwdNormal, float maxDist, Plane3D const& plane);
 RaycastResult3D RaycastVsSphere3D(Vec3 startPos, Vec3 fwdNormal, float maxDist, Vec3 sphereCenter, float sphereRadius);
-RaycastResult3D RaycastVsZCylinder3D(Vec3 startPos, Vec3 fwdNormal, float maxDist, Vec3 cylinderStart, float height, float radius);
\ No newline at end of file
+RaycastResult3D RaycastVsZCylinder3D(Vec3 startPos, Vec3 fwdNormal, float maxDist, Vec3 cylinderStart, float height, float radius);
+RaycastResult3D RaycastVsTriangle3D(Vec3 startPos, Vec3 fwdNormal, float maxDist, Vec3 vertexA, Vec3 vertexB, Vec3 vertexC);
+
+// Four rays against one primitive
+RaycastPacketResult2D RaycastPacketVsDisc2D(RayPacket2D const& rays, Vec2 discCenter, float discRadius);
+RaycastPacketResult3D RaycastPacketVsAABB3D(RayPacket3D const& rays, AABB3 const& bounds);
+RaycastPacketResult3D RaycastPacketVsSphere3D(RayPacket3D const& rays, Vec3 sphereCenter, float sphereRadius);
+
+// One ray against four primitives
+RaycastPacketResult2D RaycastVsDiscs2D(Vec2 startPos, Vec2 fwdNormal, float maxDist, Vec2 const* discCenters, float const* discRadii);
+RaycastPacketResult3D RaycastVsAABB3s(Vec3 startPos, Vec3 fwdNormal, float maxDist, AABB3 const* boxes);
+RaycastPacketResult3D RaycastVsSpheres3D(Vec3 startPos, Vec3 fwdNormal, float maxDist, Vec3 const* sphereCenters, float const* sphereRadii);
\ No newline at end of file
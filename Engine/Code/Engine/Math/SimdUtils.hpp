@@ -0,0 +1,8 @@
+#pragma once
+
+// SSE2 is the SIMD baseline. Every x64 target has it; x86 only when the compiler targets it (/arch:SSE2 or above).
+// Code paths guarded by ENGINE_SIMD_SSE2 must keep a scalar fallback that returns the same results.
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define ENGINE_SIMD_SSE2
+#include <emmintrin.h>
+#endif
\ No newline at end of file
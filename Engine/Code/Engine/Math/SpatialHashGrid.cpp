@@ -0,0 +1,122 @@
+#include "SpatialHashGrid.hpp"
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+#include <algorithm>
+
+SpatialHashGrid::SpatialHashGrid(AABB2 const& bounds, float cellSize)
+{
+	Initialize(bounds, cellSize);
+}
+
+void SpatialHashGrid::Initialize(AABB2 const& bounds, float cellSize)
+{
+	GUARANTEE_OR_DIE(cellSize > 0.0f, "Spatial hash cell size must be positive");
+
+	Vec2 dimensions = bounds.GetDimensions();
+
+	m_bounds = bounds;
+	m_inverseCellSize = 1.0f / cellSize;
+	m_numOfCellsX = RoundDownToInt(dimensions.x * m_inverseCellSize) + 1;
+	m_numOfCellsY = RoundDownToInt(dimensions.y * m_inverseCellSize) + 1;
+
+	m_cellStarts.assign(m_numOfCellsX * m_numOfCellsY + 1, 0);
+
+	Clear();
+}
+
+void SpatialHashGrid::Clear()
+{
+	m_stagedEntries.clear();
+	m_sortedEntries.clear();
+	m_maxRadius = 0.0f;
+
+	std::fill(m_cellStarts.begin(), m_cellStarts.end(), 0);
+}
+
+void SpatialHashGrid::Add(int id, Vec2 const& center, float radius)
+{
+	Entry entry;
+	entry.m_center = center;
+	entry.m_radius = radius;
+	entry.m_id = id;
+
+	m_stagedEntries.push_back(entry);
+
+	if (radius > m_maxRadius)
+	{
+		m_maxRadius = radius;
+	}
+}
+
+void SpatialHashGrid::Build()
+{
+	int numOfCells = GetNumOfCells();
+
+	GUARANTEE_OR_DIE(numOfCells > 0, "Spatial hash grid built before Initialize");
+
+	std::fill(m_cellStarts.begin(), m_cellStarts.end(), 0);
+
+	// Counting sort: count per cell, prefix sum into start offsets, then scatter
+	for (Entry const& entry : m_stagedEntries)
+	{
+		m_cellStarts[GetCellIndex(entry.m_center) + 1]++;
+	}
+
+	for (int cellIndex = 0; cellIndex < numOfCells; cellIndex++)
+	{
+		m_cellStarts[cellIndex + 1] += m_cellStarts[cellIndex];
+	}
+
+	m_sortedEntries.resize(m_stagedEntries.size());
+
+	m_cellCursors.assign(m_cellStarts.begin(), m_cellStarts.end() - 1);
+
+	for (Entry const& entry : m_stagedEntries)
+	{
+		m_sortedEntries[m_cellCursors[GetCellIndex(entry.m_center)]++] = entry;
+	}
+
+	m_stagedEntries.clear();
+}
+
+int SpatialHashGrid::GetNumOfEntries() const
+{
+	return static_cast<int>(m_sortedEntries.size());
+}
+
+int SpatialHashGrid::GetNumOfCells() const
+{
+	return m_numOfCellsX * m_numOfCellsY;
+}
+
+int SpatialHashGrid::GetCellX(float x) const
+{
+	int cellX = RoundDownToInt((x - m_bounds.m_mins.x) * m_inverseCellSize);
+
+	if (cellX < 0)
+		return 0;
+
+	if (cellX >= m_numOfCellsX)
+		return m_numOfCellsX - 1;
+
+	return cellX;
+}
+
+int SpatialHashGrid::GetCellY(float y) const
+{
+	int cellY = RoundDownToInt((y - m_bounds.m_mins.y) * m_inverseCellSize);
+
+	if (cellY < 0)
+		return 0;
+
+	if (cellY >= m_numOfCellsY)
+		return m_numOfCellsY - 1;
+
+	return cellY;
+}
+
+int SpatialHashGrid::GetCellIndex(Vec2 const& position) const
+{
+	return GetCellX(position.x) + GetCellY(position.y) * m_numOfCellsX;
+}
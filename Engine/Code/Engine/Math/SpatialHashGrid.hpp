@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/MathUtils.hpp"
+
+#include <vector>
+
+// Uniform grid broadphase for discs. Discs are staged with Add, then Build counting-sorts them by cell so each cell's
+// entries sit next to each other in memory. Every disc lives in the single cell holding its center; queries widen their
+// search by the largest added radius, so a pair is never reported twice. Positions outside the bounds clamp to the edge cells.
+class SpatialHashGrid
+{
+	struct Entry
+	{
+		Vec2	m_center;
+		float	m_radius	= 0.0f;
+		int		m_id		= -1;
+	};
+	AABB2					m_bounds;
+	float					m_inverseCellSize		= 1.0f;
+	int						m_numOfCellsX			= 0;
+	int						m_numOfCellsY			= 0;
+	float					m_maxRadius				= 0.0f;
+
+	std::vector<Entry>		m_stagedEntries;
+	std::vector<Entry>		m_sortedEntries;
+	std::vector<int>		m_cellStarts;
+	std::vector<int>		m_cellCursors;
+public:
+							SpatialHashGrid() {}
+	explicit				SpatialHashGrid(AABB2 const& bounds, float cellSize);
+							~SpatialHashGrid() {}
+
+	void					Initialize(AABB2 const& bounds, float cellSize);
+	void					Clear();
+	void					Add(int id, Vec2 const& center, float radius);
+	void					Build();
+
+	int						GetNumOfEntries() const;
+	int						GetNumOfCells() const;
+
+	// Calls func(id) for every built disc overlapping the query disc, in no particular order
+	template <typename Func>
+	void					ForEachOverlap(Vec2 const& center, float radius, Func const& func) const;
+
+	// Lowest id overlapping the query disc that isCandidate(id) accepts, or -1. Matches a front-to-back scan over the ids
+	template <typename Predicate>
+	int						FindLowestOverlappingId(Vec2 const& center, float radius, Predicate const& isCandidate) const;
+private:
+	int						GetCellX(float x) const;
+	int						GetCellY(float y) const;
+	int						GetCellIndex(Vec2 const& position) const;
+};
+
+template <typename Func>
+void SpatialHashGrid::ForEachOverlap(Vec2 const& center, float radius, Func const& func) const
+{
+	if (m_sortedEntries.empty())
+		return;
+
+	float reach = radius + m_maxRadius;
+
+	int minX = GetCellX(center.x - reach);
+	int maxX = GetCellX(center.x + reach);
+	int minY = GetCellY(center.y - reach);
+	int maxY = GetCellY(center.y + reach);
+
+	for (int cellY = minY; cellY <= maxY; cellY++)
+	{
+		for (int cellX = minX; cellX <= maxX; cellX++)
+		{
+			int cellIndex = cellX + cellY * m_numOfCellsX;
+
+			for (int entryIndex = m_cellStarts[cellIndex]; entryIndex < m_cellStarts[cellIndex + 1]; entryIndex++)
+			{
+				Entry const& entry = m_sortedEntries[entryIndex];
+
+				if (DoDiscsOverlap(entry.m_center, entry.m_radius, center, radius))
+				{
+					func(entry.m_id);
+				}
+			}
+		}
+	}
+}
+
+template <typename Predicate>
+int SpatialHashGrid::FindLowestOverlappingId(Vec2 const& center, float radius, Predicate const& isCandidate) const
+{
+	int lowestId = -1;
+
+	ForEachOverlap(center, radius, [&](int id)
+	{
+		if ((lowestId < 0 || id < lowestId) && isCandidate(id))
+		{
+			lowestId = id;
+		}
+	});
+
+	return lowestId;
+}
\ No newline at end of file
@@ -36,8 +36,12 @@ Vec2 const Vec2::MakeFromPolarDegrees(float orientationDegrees, float length)
 {
 	Vec2 vec;
 
-	vec.x = length * CosDegrees(orientationDegrees);
-	vec.y = length * SinDegrees(orientationDegrees);
+	float sine;
+	float cosine;
+	SinCosDegrees(orientationDegrees, sine, cosine);
+
+	vec.x = length * cosine;
+	vec.y = length * sine;
 
 	return vec;
 }
@@ -196,10 +200,12 @@ void Vec2::SetPolarRadians(float newOrientationRadians, float length)
 
 void Vec2::SetPolarDegrees(float newOrientationDegrees, float length)
 {
-	float degrees = newOrientationDegrees;
+	float sine;
+	float cosine;
+	SinCosDegrees(newOrientationDegrees, sine, cosine);
 
-	x = length * CosDegrees(degrees);
-	y = length * SinDegrees(degrees);
+	x = length * cosine;
+	y = length * sine;
 }
 
 Vec2 Vec2::SetFromText(char const* text)
@@ -18,11 +18,13 @@ Vec3 const Vec3::MakeFromPolarRadians(float latitudeRadians, float longitudeRadi
 	float latitudeDegrees = ConvertRadiansToDegrees(latitudeRadians);
 	float longitudeDegrees = ConvertRadiansToDegrees(longitudeRadians);
 
-	float cy = CosDegrees(longitudeDegrees);
-	float sy = SinDegrees(longitudeDegrees);
+	float cy;
+	float sy;
+	SinCosDegrees(longitudeDegrees, sy, cy);
 
-	float cp = CosDegrees(latitudeDegrees);
-	float sp = SinDegrees(latitudeDegrees);
+	float cp;
+	float sp;
+	SinCosDegrees(latitudeDegrees, sp, cp);
 
 	Vec3 result;
 
@@ -35,11 +37,13 @@ Vec3 const Vec3::MakeFromPolarRadians(float latitudeRadians, float longitudeRadi
 
 Vec3 const Vec3::MakeFromPolarDegrees(float latitudeDegrees, float longitudeDegrees, float length)
 {
-	float cy = CosDegrees(longitudeDegrees);
-	float sy = SinDegrees(longitudeDegrees);
+	float cy;
+	float sy;
+	SinCosDegrees(longitudeDegrees, sy, cy);
 
-	float cp = CosDegrees(latitudeDegrees);
-	float sp = SinDegrees(latitudeDegrees);
+	float cp;
+	float sp;
+	SinCosDegrees(latitudeDegrees, sp, cp);
 
 	Vec3 result;
 
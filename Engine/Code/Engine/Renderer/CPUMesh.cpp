@@ -4,5 +4,5 @@
 
 bool CPUMesh::Load(std::string const& objFileName, Mat44& transform)
 {
-	return ObjLoader::Load(objFileName, transform, m_vertices, m_indices, m_hasNormals, m_hasUVs);
+	return ObjLoader::Load(objFileName, transform, m_vertices, m_indices, m_materials, m_submeshes, m_hasNormals, m_hasUVs);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Core/Vertex_PCUTBN.hpp"
+#include "Engine/Renderer/ObjLoader.hpp"
 
 #include <vector>
 #include <string>
@@ -12,6 +13,8 @@ class CPUMesh
 public:
 	std::vector<Vertex_PCUTBN>	m_vertices;
 	std::vector<unsigned int>	m_indices;
+	std::vector<ObjMaterial>	m_materials;
+	std::vector<ObjSubmesh>		m_submeshes;
 	bool						m_hasNormals	= false;
 	bool						m_hasUVs		= false;
 public:
@@ -141,6 +141,15 @@ Mat44 Camera::GetRenderMatrix() const
 	return renderMatrix;
 }
 
+Frustum Camera::GetFrustum() const
+{
+	Mat44 viewProjection = GetProjectionMatrix();
+
+	viewProjection.Append(GetViewMatrix());
+
+	return Frustum::CreateFromViewProjection(viewProjection);
+}
+
 AABB2 Camera::GetDXViewport() const
 {
 	AABB2 normalizedDXViewport;
@@ -5,6 +5,7 @@
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Math/Mat44.hpp"
 #include "Engine/Math/EulerAngles.hpp"
+#include "Engine/Math/Frustum.hpp"
 
 class ConstantBuffer;
 
@@ -66,4 +67,5 @@ public:
 	Mat44										GetViewMatrix() const;
 	Mat44										GetModelMatrix() const;
 	Mat44										GetRenderMatrix() const;
+	Frustum										GetFrustum() const;
 };
\ No newline at end of file
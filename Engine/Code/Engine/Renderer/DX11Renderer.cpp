@@ -1576,6 +1576,17 @@ void DX11Renderer::DrawVertexBufferIndexed(VertexBuffer* vbo, IndexBuffer* ibo,
 	m_deviceContext->DrawIndexed(indexCount, 0, 0);
 }
 
+void DX11Renderer::DrawVertexBufferIndexedRange(VertexBuffer* vbo, IndexBuffer* ibo, int indexCount, int startIndex, int vertexStride, PrimitiveType type)
+{
+	BindVertexBuffer(vbo, vertexStride, type);
+	BindIndexBuffer(ibo);
+	SetBlendStatesIfChanged();
+	SetDepthStatesIfChanged();
+	SetSamplerStatesIfChanged();
+	SetRasterizerStatesIfChanged();
+	m_deviceContext->DrawIndexed((unsigned int)indexCount, (unsigned int)startIndex, 0);
+}
+
 void DX11Renderer::DrawVertexArray(int numVertexes, Vertex_PCU const* vertexes)
 {
 	CopyCPUToGPU(vertexes, numVertexes * 24, m_immediateVBO);
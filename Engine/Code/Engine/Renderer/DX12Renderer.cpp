@@ -4240,6 +4240,15 @@ void DX12Renderer::DrawVertexBufferIndexed(VertexBuffer* vbo, IndexBuffer* ibo,
 	m_commandList->DrawIndexedInstanced((UINT)ibo->m_size / sizeof(unsigned int), 1, 0, 0, 0);
 }
 
+void DX12Renderer::DrawVertexBufferIndexedRange(VertexBuffer* vbo, IndexBuffer* ibo, int indexCount, int startIndex, int vertexStride)
+{
+	BindVertexBuffer(vbo, vertexStride);
+	BindIndexBuffer(ibo);
+	SetPipelineState();
+	m_commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	m_commandList->DrawIndexedInstanced((UINT)indexCount, 1, (UINT)startIndex, 0, 0);
+}
+
 void DX12Renderer::DrawVertexArray(int numVertexes, Vertex_PCU const* vertexes)
 {
 	CopyCPUToGPU(vertexes, numVertexes * 24, m_immediateVBO);
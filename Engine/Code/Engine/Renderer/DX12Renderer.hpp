@@ -451,6 +451,7 @@ public:
 	void									EndCamera(Camera const& camera);
 	void									DrawVertexBuffer(VertexBuffer* vbo, int vertexCount, int vertexStride = 0, int vertexOffset = 0, PrimitiveType type = PrimitiveType::TRIANGLE_LIST);
 	void									DrawVertexBufferIndexed(VertexBuffer* vbo, IndexBuffer* ibo, int vertexStride = 0);
+	void									DrawVertexBufferIndexedRange(VertexBuffer* vbo, IndexBuffer* ibo, int indexCount, int startIndex, int vertexStride = 0);
 	void									DrawVertexArray(int numVertexes, Vertex_PCU const* vertexes);
 	void									DrawVertexArray(int numVertexes, Vertex_PCU const* vertexes, VertexBuffer* vbo);
 	void									DrawVertexArrayIndexed(int numVertexes, Vertex_PCU const* vertexes, std::vector<unsigned int> const& indices);
@@ -20,6 +20,17 @@ void GPUMesh::Create(CPUMesh const& cpuMesh)
 
 	g_theRenderer->CopyCPUToGPU(cpuMesh.m_vertices.data(), cpuMesh.m_vertices.size() * sizeof(Vertex_PCUTBN), m_vbo);
 	g_theRenderer->CopyCPUToGPU(cpuMesh.m_indices.data(), cpuMesh.m_indices.size() * sizeof(unsigned int), m_ibo);
+
+	m_submeshes = cpuMesh.m_submeshes;
+
+	// Textures come from the renderer's cache, so materials and meshes that share an image load it once
+	for (ObjMaterial const& material : cpuMesh.m_materials)
+	{
+		Texture* diffuseTexture = material.m_diffuseMapFilePath.empty() ? nullptr : g_theRenderer->CreateOrGetTextureFromFile(material.m_diffuseMapFilePath.c_str());
+
+		m_diffuseTextures.push_back(diffuseTexture);
+		m_hasTextures = m_hasTextures || diffuseTexture;
+	}
 }
 
 void GPUMesh::Render(Shader* shader) const
@@ -29,5 +40,20 @@ void GPUMesh::Render(Shader* shader) const
 	g_theRenderer->SetSamplerMode(SamplerMode::POINT_CLAMP);
 	g_theRenderer->SetRasterizerMode(RasterizerMode::SOLID_CULL_NONE);
 	g_theRenderer->BindShader(shader);
-	g_theRenderer->DrawVertexBufferIndexed(m_vbo, m_ibo, sizeof(Vertex_PCUTBN));
+
+	// Untextured meshes keep whatever texture the caller bound, and draw in one call
+	if (!m_hasTextures || m_submeshes.empty())
+	{
+		g_theRenderer->DrawVertexBufferIndexed(m_vbo, m_ibo, sizeof(Vertex_PCUTBN));
+		return;
+	}
+
+	for (ObjSubmesh const& submesh : m_submeshes)
+	{
+		g_theRenderer->BindTexture(0, submesh.m_materialID >= 0 ? m_diffuseTextures[submesh.m_materialID] : nullptr);
+		g_theRenderer->DrawVertexBufferIndexedRange(m_vbo, m_ibo, (int)submesh.m_numOfIndices, (int)submesh.m_firstIndex, sizeof(Vertex_PCUTBN));
+	}
+
+	// Leave the default texture bound so the next untextured draw does not pick up the last material
+	g_theRenderer->BindTexture();
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Engine/Renderer/ObjLoader.hpp"
+
 #include <vector>
 #include <string>
 
@@ -8,17 +10,21 @@ struct Vertex_PCUTBN;
 
 class Shader;
 class CPUMesh;
+class Texture;
 class IndexBuffer;
 class VertexBuffer;
 
 class GPUMesh
 {
-	VertexBuffer*	m_vbo = nullptr;
-	IndexBuffer*	m_ibo = nullptr;
+	VertexBuffer*				m_vbo = nullptr;
+	IndexBuffer*				m_ibo = nullptr;
+	std::vector<ObjSubmesh>		m_submeshes;
+	std::vector<Texture*>		m_diffuseTextures;		// Indexed by material ID, nullptr without a map_Kd
+	bool						m_hasTextures = false;
 public:
-					GPUMesh() = default;
-					~GPUMesh();
+							GPUMesh() = default;
+							~GPUMesh();
 
-	void			Create(CPUMesh const& cpuMesh);
-	void			Render(Shader* shader) const;
+	void					Create(CPUMesh const& cpuMesh);
+	void					Render(Shader* shader) const;
 };
\ No newline at end of file
@@ -0,0 +1,259 @@
+#include "Engine/Renderer/MeshCache.hpp"
+
+#include "Engine/Renderer/ObjLoader.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+#include <cstdio>
+#include <string_view>
+#include <string.h>
+
+static uint64_t ComputeDependencyHash(std::vector<std::string> const& dependencies)
+{
+	uint64_t hash = MESH_CACHE_VERSION;
+
+	for (std::string const& dependency : dependencies)
+	{
+		hash = MeshCache::HashBytes(dependency.data(), dependency.size(), hash);
+
+		MappedFile dependencyFile;
+
+		if (FileMapReadOnly(dependencyFile, dependency))
+		{
+			hash = MeshCache::HashBytes(dependencyFile.m_data, dependencyFile.m_size, hash);
+			FileUnmap(dependencyFile);
+		}
+	}
+
+	return hash;
+}
+
+static bool IsSectionInFile(MeshCacheSectionInfo const& section, size_t fileSize)
+{
+	uint64_t sectionSize = static_cast<uint64_t>(section.m_elementSize) * section.m_numOfElements;
+
+	return section.m_offset <= fileSize && sectionSize <= fileSize - section.m_offset;
+}
+
+static bool IsCacheValid(MappedFile const& cacheFile, MeshCacheHeader const& header, uint64_t sourceHash, MeshCacheVertexLayout vertexLayout, uint32_t vertexSize, std::vector<std::string>& outDependencies)
+{
+	if (header.m_magic != MESH_CACHE_MAGIC || header.m_version != MESH_CACHE_VERSION || header.m_sourceHash != sourceHash)
+		return false;
+
+	if (header.m_vertexLayout != static_cast<uint32_t>(vertexLayout))
+		return false;
+
+	if (header.m_sections[MESH_CACHE_SECTION_VERTICES].m_elementSize != vertexSize || header.m_sections[MESH_CACHE_SECTION_INDICES].m_elementSize != sizeof(unsigned int))
+		return false;
+
+	if (header.m_sections[MESH_CACHE_SECTION_SUBMESHES].m_elementSize != sizeof(ObjSubmesh))
+		return false;
+
+	for (int sectionIndex = 0; sectionIndex < NUM_MESH_CACHE_SECTIONS; sectionIndex++)
+	{
+		if (!IsSectionInFile(header.m_sections[sectionIndex], cacheFile.m_size))
+			return false;
+	}
+
+	// Dependencies are rehashed from disk, so editing a material library invalidates the cache too
+	MeshCacheSectionInfo const& dependencySection = header.m_sections[MESH_CACHE_SECTION_DEPENDENCIES];
+	std::string_view dependencyText(reinterpret_cast<char const*>(cacheFile.m_data + dependencySection.m_offset), dependencySection.m_numOfElements);
+
+	while (!dependencyText.empty())
+	{
+		size_t lineEnd = dependencyText.find('\n');
+
+		outDependencies.push_back(std::string(dependencyText.substr(0, lineEnd)));
+		dependencyText.remove_prefix(lineEnd == std::string_view::npos ? dependencyText.size() : lineEnd + 1);
+	}
+
+	return header.m_dependencyHash == ComputeDependencyHash(outDependencies);
+}
+
+// Sections start on 16 byte boundaries so mapped vertex data is aligned for in-place reads
+static void AppendSection(std::vector<unsigned char>& buffer, MeshCacheHeader& header, MeshCacheSection section, void const* data, uint32_t elementSize, uint32_t numOfElements)
+{
+	size_t offset = (buffer.size() + 15) & ~static_cast<size_t>(15);
+	size_t sectionSize = static_cast<size_t>(elementSize) * numOfElements;
+
+	buffer.resize(offset + sectionSize);
+
+	if (sectionSize > 0)
+	{
+		memcpy(buffer.data() + offset, data, sectionSize);
+	}
+
+	header.m_sections[section].m_offset = offset;
+	header.m_sections[section].m_elementSize = elementSize;
+	header.m_sections[section].m_numOfElements = numOfElements;
+}
+
+std::string MeshCache::GetCacheFileName(std::string const& sourceFileName)
+{
+	return sourceFileName + ".meshcache";
+}
+
+// MurmurHash64A
+uint64_t MeshCache::HashBytes(void const* data, size_t size, uint64_t seed)
+{
+	uint64_t const multiplier = 0xc6a4a7935bd1e995ULL;
+	int const shift = 47;
+
+	uint8_t const* bytes = static_cast<uint8_t const*>(data);
+	uint64_t hash = seed ^ (size * multiplier);
+
+	size_t numOfWords = size / 8;
+
+	for (size_t wordIndex = 0; wordIndex < numOfWords; wordIndex++)
+	{
+		uint64_t word;
+		memcpy(&word, bytes + wordIndex * 8, 8);
+
+		word *= multiplier;
+		word ^= word >> shift;
+		word *= multiplier;
+
+		hash ^= word;
+		hash *= multiplier;
+	}
+
+	size_t numOfTailBytes = size & 7;
+
+	if (numOfTailBytes > 0)
+	{
+		uint64_t tail = 0;
+		memcpy(&tail, bytes + numOfWords * 8, numOfTailBytes);
+
+		hash ^= tail;
+		hash *= multiplier;
+	}
+
+	hash ^= hash >> shift;
+	hash *= multiplier;
+	hash ^= hash >> shift;
+
+	return hash;
+}
+
+uint64_t MeshCache::ComputeSourceHash(void const* sourceData, size_t sourceSize, Mat44 const& transform)
+{
+	uint64_t transformHash = HashBytes(transform.m_values, sizeof(transform.m_values), MESH_CACHE_VERSION);
+
+	return HashBytes(sourceData, sourceSize, transformHash);
+}
+
+bool MeshCache::Read(std::string const& cacheFileName, uint64_t sourceHash, std::vector<Vertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices, std::vector<ObjSubmesh>& outSubmeshes, std::vector<std::string>& outDependencies, bool& outHasNormals, bool& outHasUVs, MeshCacheHeader* outHeader)
+{
+	MappedFile cacheFile;
+
+	if (!FileMapReadOnly(cacheFile, cacheFileName))
+		return false;
+
+	MeshCacheHeader header;
+	std::vector<std::string> dependencies;
+	bool isValid = cacheFile.m_size >= sizeof(MeshCacheHeader);
+
+	if (isValid)
+	{
+		memcpy(&header, cacheFile.m_data, sizeof(MeshCacheHeader));
+		isValid = IsCacheValid(cacheFile, header, sourceHash, MeshCacheVertexLayout::VERTEX_PCUTBN, sizeof(Vertex_PCUTBN), dependencies);
+	}
+
+	if (isValid)
+	{
+		MeshCacheSectionInfo const& vertexSection = header.m_sections[MESH_CACHE_SECTION_VERTICES];
+		MeshCacheSectionInfo const& indexSection = header.m_sections[MESH_CACHE_SECTION_INDICES];
+		MeshCacheSectionInfo const& submeshSection = header.m_sections[MESH_CACHE_SECTION_SUBMESHES];
+
+		Vertex_PCUTBN const* vertices = reinterpret_cast<Vertex_PCUTBN const*>(cacheFile.m_data + vertexSection.m_offset);
+		unsigned int const* indices = reinterpret_cast<unsigned int const*>(cacheFile.m_data + indexSection.m_offset);
+		ObjSubmesh const* submeshes = reinterpret_cast<ObjSubmesh const*>(cacheFile.m_data + submeshSection.m_offset);
+
+		outVertices.insert(outVertices.end(), vertices, vertices + vertexSection.m_numOfElements);
+		outIndices.insert(outIndices.end(), indices, indices + indexSection.m_numOfElements);
+		outSubmeshes.insert(outSubmeshes.end(), submeshes, submeshes + submeshSection.m_numOfElements);
+		outDependencies.insert(outDependencies.end(), dependencies.begin(), dependencies.end());
+
+		if (header.m_flags & MESH_CACHE_FLAG_HAS_NORMALS)
+		{
+			outHasNormals = true;
+		}
+
+		if (header.m_flags & MESH_CACHE_FLAG_HAS_UVS)
+		{
+			outHasUVs = true;
+		}
+
+		if (outHeader)
+		{
+			*outHeader = header;
+		}
+	}
+
+	FileUnmap(cacheFile);
+
+	return isValid;
+}
+
+bool MeshCache::Write(std::string const& cacheFileName, uint64_t sourceHash, std::vector<std::string> const& dependencies, std::vector<Vertex_PCUTBN> const& vertices, std::vector<unsigned int> const& indices, std::vector<ObjSubmesh> const& submeshes, bool hasNormals, bool hasUVs)
+{
+	MeshCacheHeader header;
+
+	header.m_sourceHash = sourceHash;
+	header.m_dependencyHash = ComputeDependencyHash(dependencies);
+	header.m_vertexLayout = static_cast<uint32_t>(MeshCacheVertexLayout::VERTEX_PCUTBN);
+	header.m_flags = (hasNormals ? MESH_CACHE_FLAG_HAS_NORMALS : 0) | (hasUVs ? MESH_CACHE_FLAG_HAS_UVS : 0);
+
+	if (!vertices.empty())
+	{
+		Vec3 mins = vertices[0].m_position;
+		Vec3 maxs = vertices[0].m_position;
+
+		for (Vertex_PCUTBN const& vertex : vertices)
+		{
+			mins.x = vertex.m_position.x < mins.x ? vertex.m_position.x : mins.x;
+			mins.y = vertex.m_position.y < mins.y ? vertex.m_position.y : mins.y;
+			mins.z = vertex.m_position.z < mins.z ? vertex.m_position.z : mins.z;
+			maxs.x = vertex.m_position.x > maxs.x ? vertex.m_position.x : maxs.x;
+			maxs.y = vertex.m_position.y > maxs.y ? vertex.m_position.y : maxs.y;
+			maxs.z = vertex.m_position.z > maxs.z ? vertex.m_position.z : maxs.z;
+		}
+
+		header.m_boundsMins[0] = mins.x;
+		header.m_boundsMins[1] = mins.y;
+		header.m_boundsMins[2] = mins.z;
+		header.m_boundsMaxs[0] = maxs.x;
+		header.m_boundsMaxs[1] = maxs.y;
+		header.m_boundsMaxs[2] = maxs.z;
+	}
+
+	std::string dependencyText;
+
+	for (std::string const& dependency : dependencies)
+	{
+		dependencyText += dependency;
+		dependencyText += '\n';
+	}
+
+	std::vector<unsigned char> buffer(sizeof(MeshCacheHeader));
+
+	AppendSection(buffer, header, MESH_CACHE_SECTION_VERTICES, vertices.data(), sizeof(Vertex_PCUTBN), static_cast<uint32_t>(vertices.size()));
+	AppendSection(buffer, header, MESH_CACHE_SECTION_INDICES, indices.data(), sizeof(unsigned int), static_cast<uint32_t>(indices.size()));
+	AppendSection(buffer, header, MESH_CACHE_SECTION_DEPENDENCIES, dependencyText.data(), 1, static_cast<uint32_t>(dependencyText.size()));
+	AppendSection(buffer, header, MESH_CACHE_SECTION_SUBMESHES, submeshes.data(), sizeof(ObjSubmesh), static_cast<uint32_t>(submeshes.size()));
+
+	memcpy(buffer.data(), &header, sizeof(MeshCacheHeader));
+
+	std::string fileName = cacheFileName;
+
+	if (!WriteBufferToFile(buffer, fileName))
+	{
+		DebuggerPrintf("MeshCache: couldn't write %s, the mesh will be parsed again next time\n", cacheFileName.c_str());
+		remove(cacheFileName.c_str());
+
+		return false;
+	}
+
+	return true;
+}
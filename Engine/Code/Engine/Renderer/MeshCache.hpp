@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Engine/Core/Vertex_PCUTBN.hpp"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+struct Mat44;
+struct ObjSubmesh;
+
+constexpr uint32_t MESH_CACHE_MAGIC = 0x4853454D; // "MESH"
+// Bump whenever the file layout or a cached vertex struct changes, so old caches are rebuilt instead of misread
+constexpr uint32_t MESH_CACHE_VERSION = 3;
+
+enum class MeshCacheVertexLayout : uint32_t
+{
+	VERTEX_PCUTBN = 1,
+	MESH_VERTEX_PCU,
+	MESH_VERTEX_PCUTBN
+};
+
+enum MeshCacheSection
+{
+	MESH_CACHE_SECTION_VERTICES,
+	MESH_CACHE_SECTION_INDICES,
+	MESH_CACHE_SECTION_DEPENDENCIES,		// '\n' separated paths of the other files the mesh was built from
+	MESH_CACHE_SECTION_MESHLETS,			// The meshlet sections are optional and stay empty unless a writer fills them
+	MESH_CACHE_SECTION_MESHLET_VERTICES,
+	MESH_CACHE_SECTION_MESHLET_PRIMITIVES,
+	MESH_CACHE_SECTION_SUBMESHES,
+	NUM_MESH_CACHE_SECTIONS
+};
+
+enum MeshCacheFlags : uint32_t
+{
+	MESH_CACHE_FLAG_HAS_NORMALS		= 1 << 0,
+	MESH_CACHE_FLAG_HAS_UVS			= 1 << 1
+};
+
+struct MeshCacheSectionInfo
+{
+	uint64_t				m_offset			= 0;
+	uint32_t				m_elementSize		= 0;
+	uint32_t				m_numOfElements		= 0;
+};
+
+struct MeshCacheHeader
+{
+	uint32_t				m_magic				= MESH_CACHE_MAGIC;
+	uint32_t				m_version			= MESH_CACHE_VERSION;
+	uint64_t				m_sourceHash		= 0;
+	uint64_t				m_dependencyHash	= 0;
+	uint32_t				m_vertexLayout		= 0;
+	uint32_t				m_flags				= 0;
+	float					m_boundsMins[3]		= {};
+	float					m_boundsMaxs[3]		= {};
+	MeshCacheSectionInfo	m_sections[NUM_MESH_CACHE_SECTIONS];
+};
+
+// Binary copy of a loaded mesh, written next to its source file. A cache is only used while its version, vertex layout and the
+// content hashes of the source and of every dependency still match; the data is then copied straight out of a file mapping.
+class MeshCache
+{
+public:
+						MeshCache() {}
+						~MeshCache() {}
+
+	static std::string	GetCacheFileName(std::string const& sourceFileName);
+
+	static uint64_t		HashBytes(void const* data, size_t size, uint64_t seed);
+	// Covers everything the loader's output depends on besides the dependency files
+	static uint64_t		ComputeSourceHash(void const* sourceData, size_t sourceSize, Mat44 const& transform);
+
+	static bool			Read(std::string const& cacheFileName, uint64_t sourceHash, std::vector<Vertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices, std::vector<ObjSubmesh>& outSubmeshes, std::vector<std::string>& outDependencies, bool& outHasNormals, bool& outHasUVs, MeshCacheHeader* outHeader = nullptr);
+	// Returns false and logs when the file can't be written, leaving no partial cache behind
+	static bool			Write(std::string const& cacheFileName, uint64_t sourceHash, std::vector<std::string> const& dependencies, std::vector<Vertex_PCUTBN> const& vertices, std::vector<unsigned int> const& indices, std::vector<ObjSubmesh> const& submeshes, bool hasNormals, bool hasUVs);
+};
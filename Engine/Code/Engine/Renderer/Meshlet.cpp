@@ -0,0 +1,596 @@
+#include "Engine/Renderer/Meshlet.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+
+constexpr float MESHLET_REUSE_WEIGHT = 0.5f;
+constexpr float MESHLET_LOCATION_WEIGHT = 0.5f;
+constexpr float MESHLET_ORIENTATION_WEIGHT = 0.25f;
+// Weight of the triangles still left around a candidate's vertices. Taking the triangles with the fewest unplaced neighbours
+// first keeps meshlets from leaving slivers behind that later end up in their own half-empty meshlet.
+constexpr float MESHLET_OPEN_NEIGHBOR_WEIGHT = 2.0f;
+constexpr float MESHLET_OPEN_NEIGHBOR_SCALE = 1.0f / 18.0f;
+// When a meshlet runs out of connected candidates, the next seed only joins it if the seed lies within this many bounding
+// radii of its center; seeds further away would turn it into a meshlet spanning the mesh, which no cull test rejects
+constexpr float MESHLET_RESEED_MAX_DISTANCE = 2.0f;
+
+// Candidate triangle for the meshlet being built. Every push gets a new stamp; an entry whose stamp is no longer the latest
+// one for its triangle is a stale duplicate, and one stamped before the last added triangle gets rescored when it reaches
+// the top of the heap.
+struct MeshletCandidate
+{
+	uint32_t	m_triangle	= 0;
+	float		m_score		= 0.0f;
+	uint32_t	m_stamp		= 0;
+};
+
+// Orders the heap so the lowest score, the best fit, is on top
+static bool IsWorseMeshletCandidate(MeshletCandidate const& a, MeshletCandidate const& b)
+{
+	if (a.m_score != b.m_score)
+		return a.m_score > b.m_score;
+
+	return a.m_triangle > b.m_triangle;
+}
+
+static bool IsBitSet(std::vector<uint64_t> const& bits, uint32_t index)
+{
+	return (bits[index >> 6] >> (index & 63)) & 1;
+}
+
+static void SetBit(std::vector<uint64_t>& bits, uint32_t index)
+{
+	bits[index >> 6] |= 1ULL << (index & 63);
+}
+
+static void ClearBit(std::vector<uint64_t>& bits, uint32_t index)
+{
+	bits[index >> 6] &= ~(1ULL << (index & 63));
+}
+
+BoundingSphere MeshletBuilder::ComputeMinimumBoundingSphere(std::vector<Vec3> const& verts, size_t count)
+{
+	uint32_t minAxis[3] = {0, 0, 0};
+	uint32_t maxAxis[3] = {0, 0, 0};
+
+	float min = FLT_MAX;
+	float max = 0.0f;
+
+	int minIndex = INT_MAX;
+	int maxIndex = 0;
+
+	// X-AXIS MIN MAX VERTEX
+
+	for (int i = 0; i < count; i++)
+	{
+		if (min > verts[i].x)
+		{
+			min = verts[i].x;
+			minIndex = i;
+		}
+
+		if (max < verts[i].x)
+		{
+			max = verts[i].x;
+			maxIndex = i;
+		}
+	}
+
+	minAxis[0] = minIndex;
+	maxAxis[0] = maxIndex;
+
+	// Y-AXIS MIN MAX VERTEX
+
+	min = FLT_MAX;
+	max = 0.0f;
+
+	minIndex = INT_MAX;
+	maxIndex = 0;
+
+	for (int i = 0; i < count; i++)
+	{
+		if (min > verts[i].y)
+		{
+			min = verts[i].y;
+			minIndex = i;
+		}
+
+		if (max < verts[i].y)
+		{
+			max = verts[i].y;
+			maxIndex = i;
+		}
+	}
+
+	minAxis[1] = minIndex;
+	maxAxis[1] = maxIndex;
+
+	// Z-AXIS MIN MAX VERTEX
+
+	min = FLT_MAX;
+	max = 0.0f;
+
+	minIndex = INT_MAX;
+	maxIndex = 0;
+
+	for (int i = 0; i < count; i++)
+	{
+		if (min > verts[i].z)
+		{
+			min = verts[i].z;
+			minIndex = i;
+		}
+
+		if (max < verts[i].z)
+		{
+			max = verts[i].z;
+			maxIndex = i;
+		}
+	}
+
+	minAxis[2] = minIndex;
+	maxAxis[2] = maxIndex;
+
+	int maxDistAxis = 0;
+	float maxDistSquared = 0.0f;
+
+	for (int i = 0; i < 3; i++)
+	{
+		minIndex = minAxis[i];
+		maxIndex = maxAxis[i];
+
+		float distSquared = GetDistanceSquared3D(verts[minIndex], verts[maxIndex]);
+
+		if (distSquared > maxDistSquared)
+		{
+			maxDistSquared = distSquared;
+			maxDistAxis = i;
+		}
+	}
+
+	Vec3 p1 = verts[minAxis[maxDistAxis]];
+	Vec3 p2 = verts[maxAxis[maxDistAxis]];
+
+	Vec3 currentCenter = (p1 + p2) * 0.5f;
+
+	float currentRadius = GetDistance3D(p2, p1) * 0.5f;
+	float radiusSq = currentRadius * currentRadius;
+
+	for (int i = 0; i < count; i++)
+	{
+		Vec3 point = verts[i];
+
+		float distSq = GetDistanceSquared3D(point, currentCenter);
+
+		if (distSq > radiusSq)
+		{
+			float dist = sqrtf(distSq);
+			float k = (currentRadius / dist) * 0.5f + 0.5f;
+
+			currentCenter = currentCenter * k + point * (1 - k);
+			currentRadius = (currentRadius + dist) * 0.5f;
+		}
+	}
+
+	return BoundingSphere(currentCenter, currentRadius);
+}
+
+void MeshletBuilder::GrowBoundingSphere(BoundingSphere& sphere, Vec3 const& point)
+{
+	float distSq = GetDistanceSquared3D(point, sphere.m_center);
+
+	if (distSq > sphere.m_radius * sphere.m_radius)
+	{
+		float dist = sqrtf(distSq);
+		float k = (sphere.m_radius / dist) * 0.5f + 0.5f;
+
+		sphere.m_center = sphere.m_center * k + point * (1 - k);
+		sphere.m_radius = (sphere.m_radius + dist) * 0.5f;
+	}
+}
+
+// Edges are sorted by their vertex pair instead of hashed, so the whole build is two flat arrays
+void MeshletBuilder::BuildAdjacencyList(const uint32_t* indices, uint32_t indexCount, std::vector<uint32_t>& adjacency)
+{
+	uint32_t triangleCount = indexCount / 3;
+
+	adjacency.assign(triangleCount * 3, UINT32_MAX);
+
+	std::vector<std::pair<uint64_t, uint32_t>> edges(triangleCount * 3);
+
+	for (uint32_t corner = 0; corner < triangleCount * 3; corner++)
+	{
+		uint32_t triangleStart = corner - corner % 3;
+
+		Edge edge = Edge(indices[corner], indices[triangleStart + (corner + 1) % 3]);
+		edges[corner] = std::make_pair(((uint64_t)edge.m_startVert << 32) | edge.m_endVert, corner);
+	}
+
+	std::sort(edges.begin(), edges.end());
+
+	for (size_t edgeIndex = 0; edgeIndex < edges.size();)
+	{
+		size_t edgeEnd = edgeIndex + 1;
+
+		while (edgeEnd < edges.size() && edges[edgeEnd].first == edges[edgeIndex].first)
+		{
+			edgeEnd++;
+		}
+
+		if (edgeEnd - edgeIndex == 2)
+		{
+			uint32_t cornerA = edges[edgeIndex].second;
+			uint32_t cornerB = edges[edgeIndex + 1].second;
+
+			adjacency[cornerA] = cornerB / 3;
+			adjacency[cornerB] = cornerA / 3;
+		}
+
+		edgeIndex = edgeEnd;
+	}
+}
+
+bool MeshletBuilder::IsMeshletFull(InlineMeshlet const& meshlet)
+{
+	return (meshlet.m_uniqueVertexIndices.size() == MAX_VERTICES_PER_MESHLET || meshlet.m_primitiveIndices.size() == MAX_TRIANGLES_PER_MESHLET);
+}
+
+bool MeshletBuilder::AddToMeshlet(InlineMeshlet& meshlet, uint32_t(&tri)[3])
+{
+	if (meshlet.m_uniqueVertexIndices.size() == MAX_VERTICES_PER_MESHLET)
+		return false;
+
+	if (meshlet.m_primitiveIndices.size() == MAX_TRIANGLES_PER_MESHLET)
+		return false;
+
+	int newCount = 3;
+	uint32_t newVertsToAdd[3] = { UINT32_MAX, UINT32_MAX, UINT32_MAX };
+
+	// A degenerate triangle repeats a vertex, which still only takes one slot
+	for (int j = 0; j < 3; j++)
+	{
+		bool isRepeated = (j > 0 && tri[j] == tri[0]) || (j > 1 && tri[j] == tri[1]);
+
+		if (isRepeated || std::find(meshlet.m_uniqueVertexIndices.begin(), meshlet.m_uniqueVertexIndices.end(), tri[j]) != meshlet.m_uniqueVertexIndices.end())
+		{
+			newCount--;
+		}
+		else
+		{
+			newVertsToAdd[j] = tri[j];
+		}
+	}
+
+	if (meshlet.m_uniqueVertexIndices.size() + newCount > MAX_VERTICES_PER_MESHLET)
+		return false;
+
+	for (int i = 0; i < 3; i++)
+	{
+		if (newVertsToAdd[i] != UINT32_MAX)
+		{
+			meshlet.m_uniqueVertexIndices.push_back(newVertsToAdd[i]);
+		}
+	}
+
+	meshlet.m_primitiveIndices.push_back(PackedPrimitive(tri[0], tri[1], tri[2]));
+
+	return true;
+}
+
+int MeshletBuilder::ComputeReuseScore(InlineMeshlet const& meshlet, uint32_t (&triIndices)[3])
+{
+	int count = 0;
+
+	for (int i = 0; i < meshlet.m_uniqueVertexIndices.size(); i++)
+	{
+		for (int j = 0; j < 3; j++)
+		{
+			if (meshlet.m_uniqueVertexIndices[i] == triIndices[j])
+			{
+				count++;
+			}
+		}
+	}
+
+	return count;
+}
+
+Vec3 MeshletBuilder::ComputeNormals(Vec3* triVerts)
+{
+	Vec3 p0 = triVerts[0];
+	Vec3 p1 = triVerts[1];
+	Vec3 p2 = triVerts[2];
+
+	Vec3 e1 = p1 - p0;
+	Vec3 e2 = p2 - p0;
+
+	Vec3 normal = CrossProduct3D(e1, e2).GetNormalized();
+
+	return normal;
+}
+
+float MeshletBuilder::ComputeScore(InlineMeshlet const& meshlet, BoundingSphere const& sphere, BoundingSphere const& normal, uint32_t(&triIndices)[3], Vec3* triVerts)
+{
+	// Vertex reuse
+	uint32_t reuse = ComputeReuseScore(meshlet, triIndices);
+	float reuseScore = 1 - ((float(reuse)) / 3.0f);
+
+	// Distance from center point
+	float maxSq = 0.0f;
+	for (uint32_t i = 0; i < 3u; ++i)
+	{
+		Vec3 v = sphere.m_center - triVerts[i];
+		maxSq = std::max(maxSq, DotProduct3D(v, v));
+	}
+	float r = sphere.m_radius;
+	float r2 = r * r;
+	float locScore = std::log2(maxSq / r2 + 1);
+
+	Vec3 triNormal = ComputeNormals(triVerts);
+	float dotValue = DotProduct3D(triNormal, normal.m_center);
+	float oriScore = (1.0f - dotValue) * 0.5f;
+
+	return (MESHLET_REUSE_WEIGHT * reuseScore) + (MESHLET_LOCATION_WEIGHT * locScore) + (MESHLET_ORIENTATION_WEIGHT * oriScore);
+}
+
+// Greedily grows each meshlet from a seed triangle, always adding the best scoring triangle that shares an edge with it.
+// Candidates sit in a binary heap: the ones sharing a vertex with each added triangle are rescored right away since their
+// reuse just changed, the rest only when they reach the top. The position sphere and the normal sphere behind the normal
+// cone grow with every added triangle instead of being rebuilt from all of the meshlet's points.
+void MeshletBuilder::Meshletize(std::vector<InlineMeshlet>& output, const uint32_t* indices, uint32_t indexCount, std::vector<MeshVertex_PCUTBN> const& vertices, uint32_t vertexCount)
+{
+	const uint32_t triCount = indexCount / 3;
+
+	std::vector<uint32_t> adjacency;
+	BuildAdjacencyList(indices, indexCount, adjacency);
+
+	// Triangles around each vertex, as offsets into one flat array
+	std::vector<uint32_t> vertexTriangleStarts(vertexCount + 1, 0);
+	std::vector<uint32_t> vertexTriangles(triCount * 3);
+
+	for (uint32_t corner = 0; corner < triCount * 3; corner++)
+	{
+		assert(indices[corner] < vertexCount);
+		vertexTriangleStarts[indices[corner] + 1]++;
+	}
+
+	for (uint32_t vertex = 0; vertex < vertexCount; vertex++)
+	{
+		vertexTriangleStarts[vertex + 1] += vertexTriangleStarts[vertex];
+	}
+
+	std::vector<uint32_t> openTriangleCounts(vertexCount);
+
+	for (uint32_t vertex = 0; vertex < vertexCount; vertex++)
+	{
+		openTriangleCounts[vertex] = vertexTriangleStarts[vertex + 1] - vertexTriangleStarts[vertex];
+	}
+
+	{
+		std::vector<uint32_t> cursors(vertexTriangleStarts.begin(), vertexTriangleStarts.end() - 1);
+
+		for (uint32_t corner = 0; corner < triCount * 3; corner++)
+		{
+			vertexTriangles[cursors[indices[corner]]++] = corner / 3;
+		}
+	}
+
+	output.clear();
+	output.emplace_back();
+	InlineMeshlet* curr = &output.back();
+
+	// Flat bitsets of the triangles already in a meshlet, and of the ones queued as candidates for the current meshlet
+	std::vector<uint64_t> addedTriangles((triCount + 63) / 64, 0);
+	std::vector<uint64_t> candidateTriangles((triCount + 63) / 64, 0);
+	std::vector<uint32_t> latestStamps(triCount, 0);
+
+	std::vector<MeshletCandidate> candidates;
+	std::vector<uint32_t> queuedTriangles;
+
+	uint32_t nextStamp = 1;
+	uint32_t lastAddStamp = 0;
+
+	BoundingSphere psphere;
+	BoundingSphere nsphere;
+	BoundingSphere normal;
+
+	auto getTriangleVerts = [&](uint32_t triangle, uint32_t (&triIndices)[3], Vec3 (&triVerts)[3])
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			triIndices[i] = indices[triangle * 3 + i];
+			triVerts[i] = vertices[triIndices[i]].m_position;
+		}
+	};
+
+	auto pushScoredCandidate = [&](uint32_t triangle)
+	{
+		MeshletCandidate candidate;
+		candidate.m_triangle = triangle;
+
+		if (!curr->m_primitiveIndices.empty())
+		{
+			uint32_t triIndices[3];
+			Vec3 triVerts[3];
+			getTriangleVerts(triangle, triIndices, triVerts);
+
+			float numOfOpenNeighbors = (float)(openTriangleCounts[triIndices[0]] + openTriangleCounts[triIndices[1]] + openTriangleCounts[triIndices[2]]);
+
+			candidate.m_score = ComputeScore(*curr, psphere, normal, triIndices, triVerts);
+			candidate.m_score += MESHLET_OPEN_NEIGHBOR_WEIGHT * numOfOpenNeighbors * MESHLET_OPEN_NEIGHBOR_SCALE;
+		}
+
+		candidate.m_stamp = nextStamp;
+		latestStamps[triangle] = nextStamp++;
+
+		candidates.push_back(candidate);
+		std::push_heap(candidates.begin(), candidates.end(), &IsWorseMeshletCandidate);
+	};
+
+	auto queueCandidate = [&](uint32_t triangle)
+	{
+		SetBit(candidateTriangles, triangle);
+		queuedTriangles.push_back(triangle);
+		pushScoredCandidate(triangle);
+	};
+
+	auto startNewMeshlet = [&]()
+	{
+		for (uint32_t triangle : queuedTriangles)
+		{
+			ClearBit(candidateTriangles, triangle);
+		}
+
+		queuedTriangles.clear();
+		candidates.clear();
+
+		output.emplace_back();
+		curr = &output.back();
+	};
+
+	// Seeds come from the lowest triangle not placed yet, which follows the vertex cache order of the index buffer
+	uint32_t triIndex = 0;
+
+	for (;;)
+	{
+		if (candidates.empty())
+		{
+			while (triIndex < triCount && IsBitSet(addedTriangles, triIndex))
+				++triIndex;
+
+			if (triIndex == triCount)
+				break;
+
+			if (!curr->m_primitiveIndices.empty())
+			{
+				uint32_t seedIndices[3];
+				Vec3 seedVerts[3];
+				getTriangleVerts(triIndex, seedIndices, seedVerts);
+
+				float maxDistSq = MESHLET_RESEED_MAX_DISTANCE * MESHLET_RESEED_MAX_DISTANCE * psphere.m_radius * psphere.m_radius;
+
+				for (int i = 0; i < 3; i++)
+				{
+					if (GetDistanceSquared3D(seedVerts[i], psphere.m_center) > maxDistSq)
+					{
+						startNewMeshlet();
+						break;
+					}
+				}
+			}
+
+			queueCandidate(triIndex);
+		}
+
+		std::pop_heap(candidates.begin(), candidates.end(), &IsWorseMeshletCandidate);
+		MeshletCandidate candidate = candidates.back();
+		candidates.pop_back();
+
+		if (latestStamps[candidate.m_triangle] != candidate.m_stamp || IsBitSet(addedTriangles, candidate.m_triangle))
+			continue;
+
+		if (candidate.m_stamp < lastAddStamp)
+		{
+			pushScoredCandidate(candidate.m_triangle);
+			continue;
+		}
+
+		uint32_t index = candidate.m_triangle;
+		uint32_t tri[3];
+		Vec3 points[3];
+		getTriangleVerts(index, tri, points);
+
+		if (AddToMeshlet(*curr, tri))
+		{
+			SetBit(addedTriangles, index);
+			lastAddStamp = nextStamp;
+
+			for (int i = 0; i < 3; i++)
+			{
+				openTriangleCounts[tri[i]]--;
+			}
+
+			Vec3 triNormal = ComputeNormals(points);
+
+			if (curr->m_primitiveIndices.size() == 1)
+			{
+				std::vector<Vec3> firstPoints(points, points + 3);
+
+				psphere = ComputeMinimumBoundingSphere(firstPoints, 3);
+				nsphere = BoundingSphere(triNormal, 0.0f);
+			}
+			else
+			{
+				GrowBoundingSphere(psphere, points[0]);
+				GrowBoundingSphere(psphere, points[1]);
+				GrowBoundingSphere(psphere, points[2]);
+				GrowBoundingSphere(nsphere, triNormal);
+			}
+
+			normal.m_center = nsphere.m_center.GetNormalized();
+			normal.m_radius = nsphere.m_radius;
+
+			if (IsMeshletFull(*curr))
+			{
+				// The best remaining candidate seeds the next meshlet, the rest are left for later seeds
+				uint32_t nextSeed = UINT32_MAX;
+
+				for (MeshletCandidate const& remaining : candidates)
+				{
+					if (latestStamps[remaining.m_triangle] == remaining.m_stamp && !IsBitSet(addedTriangles, remaining.m_triangle))
+					{
+						nextSeed = remaining.m_triangle;
+						break;
+					}
+				}
+
+				startNewMeshlet();
+
+				if (nextSeed != UINT32_MAX)
+				{
+					queueCandidate(nextSeed);
+				}
+			}
+			else
+			{
+				for (uint32_t i = 0; i < 3u; ++i)
+				{
+					for (uint32_t around = vertexTriangleStarts[tri[i]]; around < vertexTriangleStarts[tri[i] + 1]; around++)
+					{
+						uint32_t neighbor = vertexTriangles[around];
+
+						if (IsBitSet(candidateTriangles, neighbor) && !IsBitSet(addedTriangles, neighbor) && latestStamps[neighbor] < lastAddStamp)
+						{
+							pushScoredCandidate(neighbor);
+						}
+					}
+				}
+
+				for (uint32_t i = 0; i < 3u; ++i)
+				{
+					uint32_t adj = adjacency[index * 3 + i];
+
+					if (adj == UINT32_MAX || IsBitSet(addedTriangles, adj) || IsBitSet(candidateTriangles, adj))
+						continue;
+
+					queueCandidate(adj);
+				}
+			}
+		}
+		else if (candidates.empty())
+		{
+			startNewMeshlet();
+		}
+	}
+
+	// The last meshlet may have never had any primitives added to it - in which case we want to remove it.
+	if (output.back().m_primitiveIndices.empty())
+	{
+		output.pop_back();
+	}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/MeshVertex_PCU.hpp"
+
+#include <vector>
+#include <cstdint>
+
+constexpr int MAX_VERTICES_PER_MESHLET = 64;
+constexpr int MAX_TRIANGLES_PER_MESHLET = 42;
+
+struct PackedPrimitive
+{
+	uint32_t m_i0;
+	uint32_t m_i1;
+	uint32_t m_i2;
+
+	PackedPrimitive() = default;
+	PackedPrimitive(uint32_t i0, uint32_t i1, uint32_t i2) : m_i0(i0), m_i1(i1), m_i2(i2) {}
+};
+
+struct BoundingSphere
+{
+	Vec3 m_center;
+	float m_radius;
+
+	BoundingSphere() = default;
+	BoundingSphere(Vec3 center, float radius) : m_center(center), m_radius(radius) {};
+};
+
+struct InlineMeshlet
+{
+	std::vector<uint32_t>				m_uniqueVertexIndices;
+	std::vector<PackedPrimitive>		m_primitiveIndices;
+	Rgba8								m_color;
+};
+
+struct Edge
+{
+	uint32_t m_startVert;
+	uint32_t m_endVert;
+
+	Edge(uint32_t v1, uint32_t v2) : m_startVert(v1 < v2 ? v1 : v2), m_endVert(v1 < v2 ? v2 : v1) {};
+};
+
+// CPU side of the mesh shader path: splits an index buffer into meshlets of at most MAX_VERTICES_PER_MESHLET vertices and
+// MAX_TRIANGLES_PER_MESHLET triangles. Kept apart from Model so it builds and runs without the DX12 renderer.
+class MeshletBuilder
+{
+public:
+	static BoundingSphere	ComputeMinimumBoundingSphere(std::vector<Vec3> const& verts, size_t count);
+	// Grows the sphere just enough to hold the point, with the growth step ComputeMinimumBoundingSphere uses
+	static void				GrowBoundingSphere(BoundingSphere& sphere, Vec3 const& point);
+
+	// Three slots per triangle holding the triangle across each edge, or UINT32_MAX when the edge is open or non-manifold
+	static void				BuildAdjacencyList(const uint32_t* indices, uint32_t indexCount, std::vector<uint32_t>& adjacency);
+
+	static bool				IsMeshletFull(InlineMeshlet const& meshlet);
+	static bool				AddToMeshlet(InlineMeshlet& meshlet, uint32_t (&tri)[3]);
+	static int				ComputeReuseScore(InlineMeshlet const& meshlet, uint32_t (&triIndices)[3]);
+	static Vec3				ComputeNormals(Vec3* triVerts);
+	// Lower is better: favours triangles that reuse the meshlet's vertices and stay close to its bounding sphere and normal cone
+	static float			ComputeScore(InlineMeshlet const& meshlet, BoundingSphere const& sphere, BoundingSphere const& normal, uint32_t (&triIndices)[3], Vec3* triVerts);
+
+	// Triangles keep their winding; the primitives hold mesh vertex indices, not meshlet-local ones
+	static void				Meshletize(std::vector<InlineMeshlet>& output, const uint32_t* indices, uint32_t indexCount, std::vector<MeshVertex_PCUTBN> const& vertices, uint32_t vertexCount);
+};
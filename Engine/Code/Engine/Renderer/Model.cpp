@@ -19,7 +19,6 @@
 #include <memory>
 #include <cassert>
 #include <algorithm>
-#include <unordered_set>
 
 struct RealtimeData
 {
@@ -465,273 +464,6 @@ void Model::SetFrustumConstants(Frustum* frustum, Vec3 cullCamPosition)
 	g_theRenderer->m_DX12Renderer->BindConstantBuffer(5, m_FrustumCBO, RootSig::MESH_SHADER_PIPELINE);
 }
 
-int Mesh::ComputeReuseScore(const InlineMeshlet& meshlet, uint32_t (&triIndices)[3])
-{
-	int count = 0;
-
-	for (int i = 0; i < meshlet.m_uniqueVertexIndices.size(); i++)
-	{
-		for (int j = 0; j < 3; j++)
-		{
-			if (meshlet.m_uniqueVertexIndices[i] == triIndices[j])
-			{
-				count++;
-			}
-		}
-	}
-
-	return count;
-}
-
-Vec3 Mesh::ComputeNormals(Vec3* triVerts)
-{
-	Vec3 p0 = triVerts[0];
-	Vec3 p1 = triVerts[1];
-	Vec3 p2 = triVerts[2];
-
-	Vec3 e1 = p1 - p0;
-	Vec3 e2 = p2 - p0;
-
-	Vec3 normal = CrossProduct3D(e1, e2).GetNormalized();
-
-	return normal;
-}
-
-BoundingSphere Mesh::ComputeMinimumBoundingSphere(std::vector<Vec3> verts, size_t count)
-{
-	uint32_t minAxis[3] = {0, 0, 0};
-	uint32_t maxAxis[3] = {0, 0, 0};
-
-	float min = FLT_MAX;
-	float max = 0.0f;
-
-	int minIndex = INT_MAX;
-	int maxIndex = 0;
-
-	// X-AXIS MIN MAX VERTEX
-
-	for (int i = 0; i < count; i++)
-	{
-		if (min > verts[i].x)
-		{
-			min = verts[i].x;
-			minIndex = i;
-		}
-
-		if (max < verts[i].x)
-		{				  
-			max = verts[i].x;
-			maxIndex = i;
-		}
-	}
-
-	minAxis[0] = minIndex;
-	maxAxis[0] = maxIndex;
-
-	// Y-AXIS MIN MAX VERTEX
-
-	min = FLT_MAX;
-	max = 0.0f;
-
-	minIndex = INT_MAX;
-	maxIndex = 0;
-
-	for (int i = 0; i < count; i++)
-	{
-		if (min > verts[i].y)
-		{
-			min = verts[i].y;
-			minIndex = i;
-		}
-
-		if (max < verts[i].y)
-		{
-			max = verts[i].y;
-			maxIndex = i;
-		}
-	}
-
-	minAxis[1] = minIndex;
-	maxAxis[1] = maxIndex;
-
-	// Z-AXIS MIN MAX VERTEX
-
-	min = FLT_MAX;
-	max = 0.0f;
-
-	minIndex = INT_MAX;
-	maxIndex = 0;
-
-	for (int i = 0; i < count; i++)
-	{
-		if (min > verts[i].z)
-		{
-			min = verts[i].z;
-			minIndex = i;
-		}
-
-		if (max < verts[i].z)
-		{
-			max = verts[i].z;
-			maxIndex = i;
-		}
-	}
-
-	minAxis[2] = minIndex;
-	maxAxis[2] = maxIndex;
-
-	int maxDistAxis = 0;
-	float maxDistSquared = 0.0f;
-
-	for (int i = 0; i < 3; i++)
-	{
-		minIndex = minAxis[i];
-		maxIndex = maxAxis[i];
-
-		float distSquared = GetDistanceSquared3D(verts[minIndex], verts[maxIndex]);
-
-		if (distSquared > maxDistSquared)
-		{
-			maxDistSquared = distSquared;
-			maxDistAxis = i;
-		}
-	}
-
-	Vec3 p1 = verts[minAxis[maxDistAxis]];
-	Vec3 p2 = verts[maxAxis[maxDistAxis]];
-
-	Vec3 currentCenter = (p1 + p2) * 0.5f;
-
-	float currentRadius = GetDistance3D(p2, p1) * 0.5f;
-	float radiusSq = currentRadius * currentRadius;
-
-	for (int i = 0; i < count; i++)
-	{
-		Vec3 point = verts[i];
-
-		float distSq = GetDistanceSquared3D(point, currentCenter);
-
-		if (distSq > radiusSq)
-		{
-			float dist = sqrtf(distSq);
-			float k = (currentRadius / dist) * 0.5f + 0.5f;
-
-			currentCenter = currentCenter * k + point * (1 - k);
-			currentRadius = (currentRadius + dist) * 0.5f;
-		}
-	}
-
-	return BoundingSphere(currentCenter, currentRadius);
-}
-
-bool Mesh::AddToMeshlet(InlineMeshlet& meshlet, uint32_t(&tri)[3])
-{
-	if (meshlet.m_uniqueVertexIndices.size() == MAX_VERTICES_PER_MESHLET)
-		return false;
-
-	if (meshlet.m_primitiveIndices.size() == MAX_TRIANGLES_PER_MESHLET)
-		return false;
-
-	if (meshlet.m_uniqueVertexIndices.size() == 0)
-	{
-		meshlet.m_uniqueVertexIndices.push_back(tri[0]);
-		meshlet.m_uniqueVertexIndices.push_back(tri[1]);
-		meshlet.m_uniqueVertexIndices.push_back(tri[2]);
-
-		PackedPrimitive newTriangle;
-
-		newTriangle.m_i0 = tri[0];
-		newTriangle.m_i1 = tri[1];
-		newTriangle.m_i2 = tri[2];
-
-		meshlet.m_primitiveIndices.push_back(newTriangle);
-	}
-	else
-	{
-		int newCount = 3;
-		std::vector<uint32_t> newVertsToAdd(3, (uint32_t)-1);
-
-		for (int j = 0; j < 3; j++)
-		{
-			if (std::find(meshlet.m_uniqueVertexIndices.begin(), meshlet.m_uniqueVertexIndices.end(), tri[j]) != meshlet.m_uniqueVertexIndices.end())
-			{
-				newCount--;
-			}
-			else
-			{
-				newVertsToAdd[j] = tri[j];
-			}
-		}
-
-		if(meshlet.m_uniqueVertexIndices.size() + newCount > MAX_VERTICES_PER_MESHLET)
-			return false;
-
-		for (int i = 0; i < 3; i++)
-		{
-			if (newVertsToAdd[i] != (uint32_t)-1)
-			{
-				meshlet.m_uniqueVertexIndices.push_back(newVertsToAdd[i]);
-			}
-		}
-
-		if(meshlet.m_primitiveIndices.size() + 1 > MAX_TRIANGLES_PER_MESHLET)
-			return false;
-
-		PackedPrimitive newTriangle;
-
-		newTriangle.m_i0 = tri[0];
-		newTriangle.m_i1 = tri[1];
-		newTriangle.m_i2 = tri[2];
-
-		meshlet.m_primitiveIndices.push_back(newTriangle);
-	}
-
-	return true;
-}
-
-void Mesh::BuildAdjacencyList( const uint32_t* indices, uint32_t indexCount, std::vector<uint32_t>& adjacency )
-{
-	std::unordered_map<Edge, std::vector<uint32_t>, EdgeHash, EdgeEqual> edgeToTriangles;
-
-	int triangleCount = indexCount / 3;
-
-	for (int i = 0; i < triangleCount; i++)
-	{
-		uint32_t i0 = indices[i * 3 + 0];
-		uint32_t i1 = indices[i * 3 + 1];
-		uint32_t i2 = indices[i * 3 + 2];
-
-		Edge e0 = Edge(i0, i1);
-		Edge e1 = Edge(i1, i2);
-		Edge e2 = Edge(i0, i2);
-
-		edgeToTriangles[e0].push_back(i);
-		edgeToTriangles[e1].push_back(i);
-		edgeToTriangles[e2].push_back(i);
-	}
-
-	for (auto edge : edgeToTriangles)
-	{
-		size_t numOfSharedTrianglesOnEdge = edge.second.size();
-
-		if (numOfSharedTrianglesOnEdge == 2)
-		{
-			adjacency.push_back(edge.second[0]);
-			adjacency.push_back(edge.second[1]);
-		}
-	}
-}
-
-bool Mesh::IsMeshletFull(InlineMeshlet& meshlet)
-{
-	return (meshlet.m_uniqueVertexIndices.size() == MAX_VERTICES_PER_MESHLET || meshlet.m_primitiveIndices.size() == MAX_TRIANGLES_PER_MESHLET);
-}
-
-bool CompareTestScores(const std::pair<uint32_t, float>& a, const std::pair<uint32_t, float>& b)
-{
-	return a.second > b.second;
-}
-
 Vec4 QuantizeSNorm(Vec4 value)
 {
 	Vec4 quantized;
@@ -756,235 +488,13 @@ Vec4 QuantizeUNorm(Vec4 value)
 	return quantized;
 }
 
-float Mesh::ComputeScore(const InlineMeshlet& meshlet, BoundingSphere sphere, BoundingSphere normal, uint32_t(&triIndices)[3], Vec3* triVerts)
-{
-	const float reuseWeight = 0.33f;
-	const float locWeight = 0.33f;
-	const float oriWeight = 0.33f;
-
-	// Vertex reuse
-	uint32_t reuse = ComputeReuseScore(meshlet, triIndices);
-	float reuseScore = 1 - ((float(reuse)) / 3.0f);
-
-	// Distance from center point
-	float maxSq = 0.0f;
-	for (uint32_t i = 0; i < 3u; ++i)
-	{
-		Vec3 v = sphere.m_center - triVerts[i];
-		maxSq = std::max(maxSq, DotProduct3D(v, v));
-	}
-	float r = sphere.m_radius;
-	float r2 = r * r;
-	float locScore = std::log2(maxSq / r2 + 1);
-
-	Vec3 triNormal = ComputeNormals(triVerts);
-	float dotValue = DotProduct3D(triNormal, normal.m_center);
-	float oriScore = (1.0f - dotValue) * 0.5f;
-
-	float b = (reuseWeight * reuseScore) + (locWeight * locScore) + (oriWeight * oriScore);
-
-	return b;
-}
-
-void Mesh::Meshletize(std::vector<InlineMeshlet>& output, const uint32_t* indices, uint32_t indexCount, const std::vector<MeshVertex_PCUTBN> positions, uint32_t vertexCount)
-{
-	UNUSED(vertexCount);
-
-	const uint32_t triCount = indexCount / 3;
-
-	// Build a primitive adjacency list
-	std::vector<uint32_t> adjacency;
-	adjacency.resize(indexCount);
-
-	BuildAdjacencyList(indices, indexCount, adjacency);
-
-	// Rest our outputs
-	output.clear();
-	output.emplace_back();
-	auto* curr = &output.back();
-
-	// Bitmask of all triangles in mesh to determine whether a specific one has been added.
-	std::vector<bool> checklist;
-	checklist.resize(triCount);
-
-	std::vector<Vec3> m_positions;
-	std::vector<Vec3> m_normals;
-	std::vector<std::pair<uint32_t, float>> candidates;
-	std::unordered_set<uint32_t> candidateCheck;
-
-	BoundingSphere psphere;
-	BoundingSphere normal;
-
-	// Arbitrarily start at triangle zero.
-	uint32_t triIndex = 0;
-	candidates.push_back(std::make_pair(triIndex, 0.0f));
-	candidateCheck.insert(triIndex);
-
-	// Continue adding triangles until 
-	while (!candidates.empty())
-	{
-		uint32_t index = candidates.back().first;
-		candidates.pop_back();
-
-		uint32_t tri[3] =
-		{
-			indices[index * 3],
-			indices[index * 3 + 1],
-			indices[index * 3 + 2],
-		};
-
-		assert(tri[0] < vertexCount);
-		assert(tri[1] < vertexCount);
-		assert(tri[2] < vertexCount);
-
-		// Try to add triangle to meshlet
-		if (AddToMeshlet(*curr, tri))
-		{
-			// Success! Mark as added.
-			checklist[index] = true;
-
-			// Add m_positions & normal to list
-			Vec3 points[3] =
-			{
-				positions[tri[0]].m_position,
-				positions[tri[1]].m_position,
-				positions[tri[2]].m_position,
-			};
-
-			m_positions.push_back(points[0]);
-			m_positions.push_back(points[1]);
-			m_positions.push_back(points[2]);
-
-			Vec3 triNormal;
-			triNormal = ComputeNormals(points);
-			m_normals.push_back(triNormal);
-
-			// Compute new bounding sphere & normal axis
-			psphere = ComputeMinimumBoundingSphere(m_positions, static_cast<uint32_t>(m_positions.size()));
-
-			BoundingSphere nsphere = ComputeMinimumBoundingSphere(m_normals, static_cast<UINT32>(m_normals.size()));
-
-			normal.m_center = nsphere.m_center.GetNormalized();
-			normal.m_radius = nsphere.m_radius;
-
-			// Find and add all applicable adjacent triangles to candidate list
-			const uint32_t adjIndex = index * 3;
-
-			uint32_t adj[3] =
-			{
-				adjacency[adjIndex],
-				adjacency[adjIndex + 1],
-				adjacency[adjIndex + 2],
-			};
-
-			for (uint32_t i = 0; i < 3u; ++i)
-			{
-				// Invalid triangle in adjacency slot
-				if (adj[i] == -1)
-					continue;
-
-				// Already processed triangle
-				if (checklist[adj[i]])
-					continue;
-
-				// Triangle already in the candidate list
-				if (candidateCheck.count(adj[i]))
-					continue;
-
-				candidates.push_back(std::make_pair(adj[i], FLT_MAX));
-				candidateCheck.insert(adj[i]);
-			}
-
-			// Re-score remaining candidate triangles
-			for (uint32_t i = 0; i < static_cast<uint32_t>(candidates.size()); ++i)
-			{
-				uint32_t candidate = candidates[i].first;
-
-				uint32_t triIndices[3] =
-				{
-					indices[candidate * 3],
-					indices[candidate * 3 + 1],
-					indices[candidate * 3 + 2],
-				};
-
-				assert(triIndices[0] < vertexCount);
-				assert(triIndices[1] < vertexCount);
-				assert(triIndices[2] < vertexCount);
-
-				Vec3 triVerts[3] =
-				{
-					positions[triIndices[0]].m_position,
-					positions[triIndices[1]].m_position,
-					positions[triIndices[2]].m_position,
-				};
-
-				candidates[i].second = ComputeScore(*curr, psphere, normal, triIndices, triVerts);
-			}
-
-			// Determine whether we need to move to the next meshlet.
-			if (IsMeshletFull(*curr))
-			{
-				m_positions.clear();
-				m_normals.clear();
-				candidateCheck.clear();
-
-				// Use one of our existing candidates as the next meshlet seed.
-				if (!candidates.empty())
-				{
-					candidates[0] = candidates.back();
-					candidates.resize(1);
-					candidateCheck.insert(candidates[0].first);
-				}
-
-				output.emplace_back();
-				curr = &output.back();
-			}
-			else
-			{
-				std::sort(candidates.begin(), candidates.end(), &CompareTestScores);
-			}
-		}
-		else
-		{
-			if (candidates.empty())
-			{
-				m_positions.clear();
-				m_normals.clear();
-				candidateCheck.clear();
-
-				output.emplace_back();
-				curr = &output.back();
-			}
-		}
-
-		// Ran out of candidates; add a new seed candidate to start the next meshlet.
-		if (candidates.empty())
-		{
-			while (triIndex < triCount && checklist[triIndex])
-				++triIndex;
-
-			if (triIndex == triCount)
-				break;
-
-			candidates.push_back(std::make_pair(triIndex, 0.0f));
-			candidateCheck.insert(triIndex);
-		}
-	}
-
-	// The last meshlet may have never had any primitives added to it - in which case we want to remove it.
-	if (output.back().m_primitiveIndices.empty())
-	{
-		output.pop_back();
-	}
-}
-
 void Mesh::ComputeMeshlets()
 {
 	std::vector<uint32_t> optimizedIndices(m_indices.size(), UINT32_MAX);
 
 	meshopt_optimizeVertexCache(optimizedIndices.data(), m_indices.data(), m_indices.size(), m_meshVertices.size());
 
-	Meshletize(m_inlineMeshlets, optimizedIndices.data(), (uint32_t)optimizedIndices.size(), m_meshVertices, (uint32_t)m_meshVertices.size());
+	MeshletBuilder::Meshletize(m_inlineMeshlets, optimizedIndices.data(), (uint32_t)optimizedIndices.size(), m_meshVertices, (uint32_t)m_meshVertices.size());
 
 	Rgba8 colors[] = 
 	{
@@ -1262,11 +772,11 @@ ConeData Mesh::ComputeNormalConeData()
 		}
 	
 		// Calculate spatial bounds
-		BoundingSphere positionBounds = ComputeMinimumBoundingSphere(vertices, m.m_vertexCount);
+		BoundingSphere positionBounds = MeshletBuilder::ComputeMinimumBoundingSphere(vertices, m.m_vertexCount);
 	
 		// Calculate the normal cone
 		// 1. Normalized center point of minimum bounding sphere of unit normals == conic axis
-		BoundingSphere normalBounds = ComputeMinimumBoundingSphere(normals, m.m_primitiveCount);
+		BoundingSphere normalBounds = MeshletBuilder::ComputeMinimumBoundingSphere(normals, m.m_primitiveCount);
 	
 		// 2. Calculate dot product of all normals to conic axis, selecting minimum
 	
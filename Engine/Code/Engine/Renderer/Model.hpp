@@ -11,10 +11,10 @@
 #include "Engine/Math/AABB3.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
 #include "Engine/Renderer/DX12Renderer.hpp"
+#include "Engine/Renderer/Meshlet.hpp"
 
 #include <vector>
 #include <iostream>
-#include <unordered_map>
 
 struct ID3D12DescriptorHeap;
 
@@ -26,58 +26,8 @@ class IndexBuffer;
 class VertexBuffer;
 class ConstantBuffer;
 
-constexpr int MAX_VERTICES_PER_MESHLET = 64;
-constexpr int MAX_TRIANGLES_PER_MESHLET = 42;
-
 typedef std::vector<std::pair<uint8_t[4], float>> ConeData;
 
-struct Edge
-{
-	uint32_t m_startVert;
-	uint32_t m_endVert;
-
-	Edge(uint32_t v1, uint32_t v2) : m_startVert(std::min(v1, v2)), m_endVert(std::max(v1, v2)) {};
-};
-
-struct EdgeHash {
-	size_t operator()(const Edge& edge) const {
-
-		return std::hash<int>()(edge.m_startVert) ^ (std::hash<int>()(edge.m_endVert) << 1);
-	}
-};
-
-struct EdgeEqual {
-	bool operator()(const Edge& lhs, const Edge& rhs) const {
-		return lhs.m_startVert == rhs.m_startVert && lhs.m_endVert == rhs.m_endVert;
-	}
-};
-
-struct PackedPrimitive
-{
-	uint32_t m_i0;
-	uint32_t m_i1;
-	uint32_t m_i2;
-
-	PackedPrimitive() = default;
-	PackedPrimitive(uint32_t i0, uint32_t i1, uint32_t i2) : m_i0(i0), m_i1(i1), m_i2(i2) {}
-};
-
-struct BoundingSphere
-{
-	Vec3 m_center;
-	float m_radius;
-
-	BoundingSphere() = default;
-	BoundingSphere(Vec3 center, float radius) : m_center(center), m_radius(radius) {};
-};
-
-struct InlineMeshlet
-{
-	std::vector<uint32_t>				m_uniqueVertexIndices;
-	std::vector<PackedPrimitive>		m_primitiveIndices;
-	Rgba8								m_color;
-};
-
 struct Meshlet
 {
 	uint32_t							m_vertexOffset;
@@ -119,15 +69,6 @@ struct Mesh
 									Mesh() = default;
 									~Mesh() {};
 
-	void							BuildAdjacencyList( const uint32_t* indices, uint32_t indexCount, std::vector<uint32_t>& adjacency );
-	bool							IsMeshletFull(InlineMeshlet& meshlet);
-	int								ComputeReuseScore(const InlineMeshlet& meshlet, uint32_t (&triIndices)[3]);
-	Vec3							ComputeNormals(Vec3* triVerts);
-	BoundingSphere					ComputeMinimumBoundingSphere(std::vector<Vec3> verts, size_t count);
-	float							ComputeScore(const InlineMeshlet& meshlet, BoundingSphere sphere, BoundingSphere normal, uint32_t (&triIndices)[3], Vec3* triVerts);
-	bool							AddToMeshlet(InlineMeshlet& meshlet, uint32_t (&tri)[3]);
-	void							Meshletize(std::vector<InlineMeshlet>& output, const uint32_t* indices, uint32_t indexCount, const std::vector<MeshVertex_PCUTBN> positions, uint32_t vertexCount);
-	
 	void							ComputeMeshlets();
 	std::vector<CullData>			ComputeMeshletCullData();
 	std::vector<BoundingSphere>		ComputeBoundSphereData();
@@ -190,8 +131,6 @@ public:
 	void							SetFrustumConstants(Frustum* frustum, Vec3 cullCamPosition);
 };
 
-bool								CompareTestScores(const std::pair<uint32_t, float>& a, const std::pair<uint32_t, float>& b);
-
 Vec4								QuantizeSNorm(Vec4 value);
 Vec4								QuantizeUNorm(Vec4 value);
 
@@ -6,315 +6,433 @@
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ParallelFor.hpp"
+#include "Engine/Renderer/MeshCache.hpp"
 
 #include <filesystem>
+#include <charconv>
+#include <string.h>
 
-bool ObjLoader::Load(std::string const& fileName, Mat44 const& transform, std::vector<Vertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices, bool& outHasNormals, bool& outHasUVs)
+// Faces from m_firstFace up to the next usemtl line use the named material
+struct ObjMaterialRun
 {
-	std::vector<Vec3> posArr;
-	std::vector<Vec2> uvArr;
-	std::vector<Vec3> normArr;
-	std::vector<Face> faceArr;
-	std::unordered_map<std::string, Rgba8> materialLibrary;
+	int			m_firstFace		= 0;
+	bool		m_hasMaterial	= false;
+	std::string	m_materialName;
+};
+
+constexpr size_t OBJ_PARSE_CHUNK_SIZE = 1 << 20;
 
-	std::string strr;
-	std::string filePath = fileName;
+// One line-aligned slice of an OBJ file. The base counts are the positions, uvs and normals defined by earlier chunks,
+// which turn relative (negative) face indices into absolute ones.
+struct ObjChunk
+{
+	std::string_view				m_text;
+	ObjData							m_data;
+	std::vector<ObjMaterialRun>		m_materialRuns;
+	std::vector<std::string_view>	m_materialLibraries;
 
-	FileReadToString(strr, filePath);
+	int								m_numOfPositions	= 0;
+	int								m_numOfUVs			= 0;
+	int								m_numOfNormals		= 0;
 
-	Strings st;
+	int								m_basePositions		= 0;
+	int								m_baseUVs			= 0;
+	int								m_baseNormals		= 0;
+};
 
-	std::string currentFaceMaterial;
+static bool IsObjWhitespace(char character)
+{
+	return character == ' ' || character == '\t' || character == '\r';
+}
 
-	int w = SplitStringOnDelimiter(st, strr, "\r\n");
+// Pops the next line off the front of text, handling both \n and \r\n endings
+static std::string_view GetNextObjLine(std::string_view& text)
+{
+	size_t lineEnd = text.find('\n');
 
-	if (w == 1)
+	std::string_view line = text.substr(0, lineEnd);
+	text.remove_prefix(lineEnd == std::string_view::npos ? text.size() : lineEnd + 1);
+
+	if (!line.empty() && line.back() == '\r')
 	{
-		for (int i = 0; i < (int)st.size(); i++)
-		{
-			ParsingMaterialFile(st[i], materialLibrary);
-		}
+		line.remove_suffix(1);
 	}
-	else
+
+	return line;
+}
+
+// Pops the next whitespace separated token off the front of line, or returns an empty view at the end of the line
+static std::string_view GetNextObjToken(std::string_view& line)
+{
+	size_t tokenStart = 0;
+
+	while (tokenStart < line.size() && IsObjWhitespace(line[tokenStart]))
 	{
-		w = SplitStringOnDelimiter(st, strr, "\n");
+		tokenStart++;
+	}
 
-		if (w == 1)
-		{
-			for (int i = 0; i < (int)st.size(); i++)
-			{
-				ParsingMaterialFile(st[i], materialLibrary);
-			}
-		}
+	size_t tokenEnd = tokenStart;
+
+	while (tokenEnd < line.size() && !IsObjWhitespace(line[tokenEnd]))
+	{
+		tokenEnd++;
 	}
 
-	if (w == 1)
+	std::string_view token = line.substr(tokenStart, tokenEnd - tokenStart);
+	line.remove_prefix(tokenEnd);
+
+	return token;
+}
+
+// Parses as double and narrows like the std::atof calls it replaced, so every value rounds the same way.
+// Unparseable tokens give 0, also like atof.
+static float ParseObjFloat(std::string_view token)
+{
+	if (!token.empty() && token[0] == '+')
 	{
-		Strings faceMaterialInfo;
+		token.remove_prefix(1);
+	}
 
-		for (int i = 0; i < (int)st.size(); i++)
-		{
-			ParsingVertexPos(st[i], posArr);
-			ParsingVertexUVs(st[i], uvArr, outHasUVs);
-			ParsingVertexNormals(st[i], normArr, outHasNormals);
+	double value = 0.0;
+	std::from_chars(token.data(), token.data() + token.size(), value);
 
-			if (st[i].substr(0, 6) == "usemtl")
-			{
-				faceMaterialInfo = SplitStringOnDelimiter(st[i], ' ');
-			}
+	return static_cast<float>(value);
+}
 
-			if (faceMaterialInfo.size() == 2)
-			{
-				ParsingFaces(st[i], faceArr, materialLibrary[faceMaterialInfo[1]]);
-			}
-			else
-			{
-				ParsingFaces(st[i], faceArr);
-			}
-		}
+static int ParseObjIndex(std::string_view token)
+{
+	if (!token.empty() && token[0] == '+')
+	{
+		token.remove_prefix(1);
 	}
-	else
+
+	int value = 0;
+	std::from_chars(token.data(), token.data() + token.size(), value);
+
+	return value;
+}
+
+static int ResolveObjIndex(int index, int numOfElements)
+{
+	return index < 0 ? numOfElements + index + 1 : index;
+}
+
+static void CountObjChunkElements(ObjChunk& chunk)
+{
+	std::string_view text = chunk.m_text;
+
+	while (!text.empty())
 	{
-		w = SplitStringOnDelimiter(st, strr, "\n");
+		std::string_view line = GetNextObjLine(text);
+		std::string_view keyword = GetNextObjToken(line);
 
-		if (w == 1)
+		if (keyword == "v")
 		{
-			Strings faceMaterialInfo;
+			chunk.m_numOfPositions++;
+		}
+		else if (keyword == "vt")
+		{
+			chunk.m_numOfUVs++;
+		}
+		else if (keyword == "vn")
+		{
+			chunk.m_numOfNormals++;
+		}
+	}
+}
 
-			for (int i = 0; i < (int)st.size(); i++)
-			{
-				ParsingVertexPos(st[i], posArr);
-				ParsingVertexUVs(st[i], uvArr, outHasUVs);
-				ParsingVertexNormals(st[i], normArr, outHasNormals);
+static void ParseObjChunk(ObjChunk& chunk)
+{
+	std::string_view text = chunk.m_text;
+	ObjData& data = chunk.m_data;
 
-				if (st[i].substr(0, 6) == "usemtl")
-				{
-					faceMaterialInfo = SplitStringOnDelimiter(st[i], ' ');
-				}
+	while (!text.empty())
+	{
+		std::string_view line = GetNextObjLine(text);
+		std::string_view keyword = GetNextObjToken(line);
 
-				if (faceMaterialInfo.size() == 2)
-				{
-					ParsingFaces(st[i], faceArr, materialLibrary[faceMaterialInfo[1]]);
-				}
-				else
-				{
-					ParsingFaces(st[i], faceArr);
-				}
-			}
+		if (keyword == "v")
+		{
+			ObjLoader::ParsingVertexPos(line, data.m_positions);
 		}
-	}
+		else if (keyword == "vt")
+		{
+			ObjLoader::ParsingVertexUVs(line, data.m_uvs, data.m_hasUVs);
+		}
+		else if (keyword == "vn")
+		{
+			ObjLoader::ParsingVertexNormals(line, data.m_normals, data.m_hasNormals);
+		}
+		else if (keyword == "f")
+		{
+			int numOfPositions = chunk.m_basePositions + (int)data.m_positions.size();
+			int numOfUVs = chunk.m_baseUVs + (int)data.m_uvs.size();
+			int numOfNormals = chunk.m_baseNormals + (int)data.m_normals.size();
 
-	GenerateVerticesAndIndices(faceArr, posArr, uvArr, normArr, outVertices, outIndices);
+			ObjLoader::ParsingFaces(line, data.m_faces, data.m_faceVertices, numOfPositions, numOfUVs, numOfNormals);
+		}
+		else if (keyword == "usemtl")
+		{
+			ObjMaterialRun materialRun;
+			materialRun.m_firstFace = (int)data.m_faces.size();
 
-	TransformVertexArray3D(outVertices, transform, outHasNormals);
+			// Anything but a single material name leaves the faces white
+			std::string_view materialName = GetNextObjToken(line);
 
-	return true;
+			if (!materialName.empty() && GetNextObjToken(line).empty())
+			{
+				materialRun.m_hasMaterial = true;
+				materialRun.m_materialName = std::string(materialName);
+			}
+
+			chunk.m_materialRuns.push_back(materialRun);
+		}
+		else if (keyword == "mtllib")
+		{
+			chunk.m_materialLibraries.push_back(line);
+		}
+	}
 }
 
-#if DX12_RENDERER
+constexpr int OBJ_DEDUP_NUM_OF_SHARDS = 16;
+constexpr int OBJ_DEDUP_PARALLEL_MIN_VERTICES = 1 << 16;
+constexpr unsigned int OBJ_DEDUP_EMPTY_SLOT = 0xFFFFFFFF;
 
-bool ObjLoader::Load(std::string const& fileName, Mat44 const& transform, std::vector<MeshVertex_PCU>& outVertices, std::vector<unsigned int>& outIndices, bool& outHasNormals, bool& outHasUVs)
+// Sets outFirstVertices[i] to the index of the first vertex identical to vertex i, which is i itself for first occurrences.
+// Vertices are split into shards by the top bits of their hash, and every shard probes its own open addressing table in
+// ascending vertex order, so filling the shards in parallel finds exactly the same first occurrences as one serial pass.
+static void FindFirstIdenticalVertices(std::vector<Vertex_PCUTBN> const& vertices, std::vector<unsigned int>& outFirstVertices)
 {
-	UNUSED(transform);
+	int numOfVertices = (int)vertices.size();
+
+	std::vector<uint64_t> hashes(numOfVertices);
+
+	ParallelFor(0, numOfVertices, 0, [&](int vertexIndex)
+	{
+		hashes[vertexIndex] = MeshCache::HashBytes(&vertices[vertexIndex], sizeof(Vertex_PCUTBN), 0);
+	});
 
-	std::vector<Vec3> posArr;
-	std::vector<Vec2> uvArr;
-	std::vector<Vec3> normArr;
-	std::vector<Face> faceArr;
-	std::unordered_map<std::string, Rgba8> materialLibrary;
+	bool isParallel = CanRunInParallel(g_theJobSystem) && numOfVertices >= OBJ_DEDUP_PARALLEL_MIN_VERTICES;
+	int numOfShards = isParallel ? OBJ_DEDUP_NUM_OF_SHARDS : 1;
 
-	std::string strr;
-	std::string filePath = fileName;
+	// Counting sort of the vertex indices by shard keeps each shard's vertices in ascending order
+	std::vector<int> shardStarts(numOfShards + 1, 0);
+	std::vector<unsigned int> shardVertices(numOfVertices);
 
-	FileReadToString(strr, filePath);
+	auto getShard = [&](int vertexIndex) { return (int)((hashes[vertexIndex] >> 32) % (uint64_t)numOfShards); };
 
-	Strings st;
+	for (int vertexIndex = 0; vertexIndex < numOfVertices; vertexIndex++)
+	{
+		shardStarts[getShard(vertexIndex) + 1]++;
+	}
 
-	std::string currentFaceMaterial;
+	for (int shardIndex = 0; shardIndex < numOfShards; shardIndex++)
+	{
+		shardStarts[shardIndex + 1] += shardStarts[shardIndex];
+	}
 
-	int w = SplitStringOnDelimiter(st, strr, "\r\n");
+	std::vector<int> shardCursors(shardStarts.begin(), shardStarts.end() - 1);
 
-	if (w == 1)
+	for (int vertexIndex = 0; vertexIndex < numOfVertices; vertexIndex++)
 	{
-		for (int i = 0; i < st.size(); i++)
-		{
-			ParsingMaterialFile(st[i], materialLibrary);
-		}
+		shardVertices[shardCursors[getShard(vertexIndex)]++] = vertexIndex;
 	}
-	else
+
+	outFirstVertices.resize(numOfVertices);
+
+	ParallelFor(0, numOfShards, 1, [&](int shardIndex)
 	{
-		w = SplitStringOnDelimiter(st, strr, "\n");
+		int shardSize = shardStarts[shardIndex + 1] - shardStarts[shardIndex];
 
-		if (w == 1)
+		// At most half full, so probe runs stay short
+		size_t tableSize = 16;
+
+		while (tableSize < 2 * (size_t)shardSize)
 		{
-			for (int i = 0; i < st.size(); i++)
-			{
-				ParsingMaterialFile(st[i], materialLibrary);
-			}
+			tableSize *= 2;
 		}
-	}
 
-	if (w == 1)
-	{
-		Strings faceMaterialInfo;
+		std::vector<unsigned int> table(tableSize, OBJ_DEDUP_EMPTY_SLOT);
+		size_t tableMask = tableSize - 1;
 
-		for (int i = 0; i < st.size(); i++)
+		for (int shardVertexIndex = shardStarts[shardIndex]; shardVertexIndex < shardStarts[shardIndex + 1]; shardVertexIndex++)
 		{
-			ParsingVertexPos(st[i], posArr);
-			ParsingVertexUVs(st[i], uvArr, outHasUVs);
-			ParsingVertexNormals(st[i], normArr, outHasNormals);
+			unsigned int vertexIndex = shardVertices[shardVertexIndex];
+			uint64_t hash = hashes[vertexIndex];
+			size_t slot = (size_t)hash & tableMask;
 
-			if (st[i].substr(0, 6) == "usemtl")
-			{
-				faceMaterialInfo = SplitStringOnDelimiter(st[i], ' ');
-			}
+			outFirstVertices[vertexIndex] = vertexIndex;
 
-			if (faceMaterialInfo.size() == 2)
+			while (table[slot] != OBJ_DEDUP_EMPTY_SLOT)
 			{
-				ParsingFaces(st[i], faceArr, materialLibrary[faceMaterialInfo[1]]);
+				unsigned int otherIndex = table[slot];
+
+				if (hashes[otherIndex] == hash && memcmp(&vertices[otherIndex], &vertices[vertexIndex], sizeof(Vertex_PCUTBN)) == 0)
+				{
+					outFirstVertices[vertexIndex] = otherIndex;
+					break;
+				}
+
+				slot = (slot + 1) & tableMask;
 			}
-			else
+
+			if (table[slot] == OBJ_DEDUP_EMPTY_SLOT)
 			{
-				ParsingFaces(st[i], faceArr);
+				table[slot] = vertexIndex;
 			}
 		}
-	}
-	else
-	{
-		w = SplitStringOnDelimiter(st, strr, "\n");
-
-		if (w == 1)
-		{
-			Strings faceMaterialInfo;
+	});
+}
 
-			for (int i = 0; i < st.size(); i++)
-			{
-				ParsingVertexPos(st[i], posArr);
-				ParsingVertexUVs(st[i], uvArr, outHasUVs);
-				ParsingVertexNormals(st[i], normArr, outHasNormals);
+// Merges byte-identical vertices and remaps the indices to them. Unique vertices keep their relative order.
+static void DeduplicateVertices(std::vector<Vertex_PCUTBN>& vertices, std::vector<unsigned int>& indices)
+{
+	std::vector<unsigned int> remap;
+	FindFirstIdenticalVertices(vertices, remap);
 
-				if (st[i].substr(0, 6) == "usemtl")
-				{
-					faceMaterialInfo = SplitStringOnDelimiter(st[i], ' ');
-				}
+	unsigned int numOfUniqueVertices = 0;
 
-				if (faceMaterialInfo.size() == 2)
-				{
-					ParsingFaces(st[i], faceArr, materialLibrary[faceMaterialInfo[1]]);
-				}
-				else
-				{
-					ParsingFaces(st[i], faceArr);
-				}
-			}
+	for (unsigned int vertexIndex = 0; vertexIndex < (unsigned int)vertices.size(); vertexIndex++)
+	{
+		if (remap[vertexIndex] == vertexIndex)
+		{
+			vertices[numOfUniqueVertices] = vertices[vertexIndex];
+			remap[vertexIndex] = numOfUniqueVertices++;
+		}
+		else
+		{
+			remap[vertexIndex] = remap[remap[vertexIndex]];
 		}
 	}
 
-	GenerateVerticesAndIndices(faceArr, posArr, uvArr, normArr, outVertices, outIndices);
-
-	TransformVertexArray3D(outVertices, transform, outHasNormals);
+	vertices.resize(numOfUniqueVertices);
 
-	return true;
+	ParallelFor(0, (int)indices.size(), 0, [&](int index)
+	{
+		indices[index] = remap[indices[index]];
+	});
 }
 
-bool ObjLoader::Load(std::string const& fileName, Mat44 const& transform, std::vector<MeshVertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices, bool& outHasNormals, bool& outHasUVs)
+bool ObjLoader::Load(std::string const& fileName, Mat44 const& transform, std::vector<Vertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices, bool& outHasNormals, bool& outHasUVs)
 {
-	UNUSED(transform);
+	std::vector<ObjMaterial> materials;
+	std::vector<ObjSubmesh> submeshes;
 
-	std::vector<Vec3> posArr;
-	std::vector<Vec2> uvArr;
-	std::vector<Vec3> normArr;
-	std::vector<Face> faceArr;
-	std::unordered_map<std::string, Rgba8> materialLibrary;
+	return Load(fileName, transform, outVertices, outIndices, materials, submeshes, outHasNormals, outHasUVs);
+}
 
-	std::string strr;
-	std::string filePath = fileName;
+bool ObjLoader::Load(std::string const& fileName, Mat44 const& transform, std::vector<Vertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices, std::vector<ObjMaterial>& outMaterials, std::vector<ObjSubmesh>& outSubmeshes, bool& outHasNormals, bool& outHasUVs)
+{
+	MappedFile sourceFile;
+	bool isSourceMapped = FileMapReadOnly(sourceFile, fileName);
 
-	FileReadToString(strr, filePath);
+	std::string cacheFileName = MeshCache::GetCacheFileName(fileName);
+	uint64_t sourceHash = 0;
 
-	Strings st;
+	// The cache only ever holds this call's output, so it is skipped when the caller passes in a non-empty mesh
+	bool canUseCache = isSourceMapped && outVertices.empty() && outIndices.empty() && outMaterials.empty() && outSubmeshes.empty();
 
-	std::string currentFaceMaterial;
+	if (canUseCache)
+	{
+		sourceHash = MeshCache::ComputeSourceHash(sourceFile.m_data, sourceFile.m_size, transform);
 
-	int w = SplitStringOnDelimiter(st, strr, "\r\n");
+		std::vector<std::string> materialLibraryFiles;
 
-	if (w == 1)
-	{
-		for (int i = 0; i < st.size(); i++)
+		if (MeshCache::Read(cacheFileName, sourceHash, outVertices, outIndices, outSubmeshes, materialLibraryFiles, outHasNormals, outHasUVs))
 		{
-			ParsingMaterialFile(st[i], materialLibrary);
-		}
-	}
-	else
-	{
-		w = SplitStringOnDelimiter(st, strr, "\n");
+			FileUnmap(sourceFile);
 
-		if (w == 1)
-		{
-			for (int i = 0; i < st.size(); i++)
+			// Material IDs are handed out in library order, so re-reading the same libraries reproduces the cached IDs
+			std::unordered_map<std::string, int> materialIDs;
+
+			for (std::string const& materialLibraryFile : materialLibraryFiles)
 			{
-				ParsingMaterialFile(st[i], materialLibrary);
+				ParsingMaterialFile(materialLibraryFile, outMaterials, materialIDs);
 			}
+
+			return true;
 		}
 	}
 
-	if (w == 1)
+	ObjData objData;
+
+	if (isSourceMapped)
 	{
-		Strings faceMaterialInfo;
+		ParseText(std::string_view(reinterpret_cast<char const*>(sourceFile.m_data), sourceFile.m_size), objData);
+		FileUnmap(sourceFile);
+	}
 
-		for (int i = 0; i < st.size(); i++)
-		{
-			ParsingVertexPos(st[i], posArr);
-			ParsingVertexUVs(st[i], uvArr, outHasUVs);
-			ParsingVertexNormals(st[i], normArr, outHasNormals);
+	if (objData.m_hasNormals)
+	{
+		outHasNormals = true;
+	}
 
-			if (st[i].substr(0, 6) == "usemtl")
-			{
-				faceMaterialInfo = SplitStringOnDelimiter(st[i], ' ');
-			}
+	if (objData.m_hasUVs)
+	{
+		outHasUVs = true;
+	}
 
-			if (faceMaterialInfo.size() == 2)
-			{
-				ParsingFaces(st[i], faceArr, materialLibrary[faceMaterialInfo[1]]);
-			}
-			else
-			{
-				ParsingFaces(st[i], faceArr);
-			}
-		}
+	GenerateVerticesAndIndices(objData.m_faces, objData.m_faceVertices, objData.m_positions, objData.m_uvs, objData.m_normals, outVertices, outIndices, outSubmeshes);
+
+	TransformVertexArray3D(outVertices, transform, outHasNormals);
+
+	outMaterials.insert(outMaterials.end(), objData.m_materials.begin(), objData.m_materials.end());
+
+	if (canUseCache && !outVertices.empty())
+	{
+		MeshCache::Write(cacheFileName, sourceHash, objData.m_materialLibraryFiles, outVertices, outIndices, outSubmeshes, objData.m_hasNormals, objData.m_hasUVs);
+	}
+
+	return true;
+}
+
+#if DX12_RENDERER
+
+bool ObjLoader::Load(std::string const& fileName, Mat44 const& transform, std::vector<MeshVertex_PCU>& outVertices, std::vector<unsigned int>& outIndices, bool& outHasNormals, bool& outHasUVs)
+{
+	UNUSED(transform);
+
+	ObjData objData;
+
+	ParseFile(fileName, objData);
+
+	if (objData.m_hasNormals)
+	{
+		outHasNormals = true;
 	}
-	else
+
+	if (objData.m_hasUVs)
 	{
-		w = SplitStringOnDelimiter(st, strr, "\n");
+		outHasUVs = true;
+	}
 
-		if (w == 1)
-		{
-			Strings faceMaterialInfo;
+	GenerateVerticesAndIndices(objData.m_faces, objData.m_faceVertices, objData.m_positions, objData.m_uvs, objData.m_normals, outVertices, outIndices);
 
-			for (int i = 0; i < st.size(); i++)
-			{
-				ParsingVertexPos(st[i], posArr);
-				ParsingVertexUVs(st[i], uvArr, outHasUVs);
-				ParsingVertexNormals(st[i], normArr, outHasNormals);
+	TransformVertexArray3D(outVertices, transform, outHasNormals);
 
-				if (st[i].substr(0, 6) == "usemtl")
-				{
-					faceMaterialInfo = SplitStringOnDelimiter(st[i], ' ');
-				}
+	return true;
+}
 
-				if (faceMaterialInfo.size() == 2)
-				{
-					ParsingFaces(st[i], faceArr, materialLibrary[faceMaterialInfo[1]]);
-				}
-				else
-				{
-					ParsingFaces(st[i], faceArr);
-				}
-			}
-		}
+bool ObjLoader::Load(std::string const& fileName, Mat44 const& transform, std::vector<MeshVertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices, bool& outHasNormals, bool& outHasUVs)
+{
+	UNUSED(transform);
+
+	ObjData objData;
+
+	ParseFile(fileName, objData);
+
+	if (objData.m_hasNormals)
+	{
+		outHasNormals = true;
 	}
 
-	GenerateVerticesAndIndices(faceArr, posArr, uvArr, normArr, outVertices, outIndices);
+	if (objData.m_hasUVs)
+	{
+		outHasUVs = true;
+	}
+
+	GenerateVerticesAndIndices(objData.m_faces, objData.m_faceVertices, objData.m_positions, objData.m_uvs, objData.m_normals, outVertices, outIndices);
 
 	//TransformVertexArray3D(outVertices, transform, outHasNormals);
 
@@ -393,296 +511,334 @@ bool ObjLoader::LoadXML(std::string const& fileName, Mat44 const& transform, std
 }
 #endif
 
-void ObjLoader::ParsingVertexPos(std::string line, std::vector<Vec3>& positions)
+void ObjLoader::ParseFile(std::string const& fileName, ObjData& outData)
 {
-	if (line[0] == 'v' && line[1] == ' ')
-	{
-		Strings positionStrings;
+	MappedFile sourceFile;
 
-		std::string sug = line;
+	if (!FileMapReadOnly(sourceFile, fileName))
+		return;
 
-		int d = SplitStringOnDelimiter(positionStrings, sug, "  ");
+	ParseText(std::string_view(reinterpret_cast<char const*>(sourceFile.m_data), sourceFile.m_size), outData);
 
-		if (d == 1)
-		{
-			int c = SplitStringOnDelimiter(positionStrings, sug, "   ");
+	FileUnmap(sourceFile);
+}
 
-			if (c == 1)
-			{
-				positionStrings = SplitStringOnDelimiter(sug, ' ');
+// Parses the text in line-aligned chunks on the JobSystem, then appends the chunks in file order. A cheap first pass
+// counts the v, vt and vn lines of every chunk so relative face indices can be made absolute while chunks parse in parallel.
+// usemtl names are only resolved to material IDs once every mtllib has been read, so a library listed after its first use still applies.
+void ObjLoader::ParseText(std::string_view text, ObjData& outData)
+{
+	std::vector<ObjChunk> chunks;
 
-				float x = (float)std::atof(positionStrings[3].c_str());
-				float y = (float)std::atof(positionStrings[4].c_str());
-				float z = (float)std::atof(positionStrings[5].c_str());
+	while (!text.empty())
+	{
+		size_t chunkEnd = text.size();
 
-				positions.push_back(Vec3(x, y, z));
-			}
-			else
-			{
-				positionStrings = SplitStringOnDelimiter(sug, ' ');
+		if (text.size() > OBJ_PARSE_CHUNK_SIZE)
+		{
+			size_t lineEnd = text.find('\n', OBJ_PARSE_CHUNK_SIZE);
+			chunkEnd = lineEnd == std::string_view::npos ? text.size() : lineEnd + 1;
+		}
 
-				float x = (float)std::atof(positionStrings[2].c_str());
-				float y = (float)std::atof(positionStrings[3].c_str());
-				float z = (float)std::atof(positionStrings[4].c_str());
+		ObjChunk chunk;
+		chunk.m_text = text.substr(0, chunkEnd);
+		chunks.push_back(chunk);
 
-				positions.push_back(Vec3(x, y, z));
-			}
-		}
-		else
+		text.remove_prefix(chunkEnd);
+	}
+
+	int numOfChunks = (int)chunks.size();
+
+	if (numOfChunks > 1)
+	{
+		ParallelFor(0, numOfChunks, 1, [&](int chunkIndex)
 		{
-			positionStrings = SplitStringOnDelimiter(sug, ' ');
+			CountObjChunkElements(chunks[chunkIndex]);
+		});
 
-			float x = (float)std::atof(positionStrings[1].c_str());
-			float y = (float)std::atof(positionStrings[2].c_str());
-			float z = (float)std::atof(positionStrings[3].c_str());
+		for (int chunkIndex = 1; chunkIndex < numOfChunks; chunkIndex++)
+		{
+			ObjChunk const& previousChunk = chunks[chunkIndex - 1];
 
-			positions.push_back(Vec3(x, y, z));
+			chunks[chunkIndex].m_basePositions = previousChunk.m_basePositions + previousChunk.m_numOfPositions;
+			chunks[chunkIndex].m_baseUVs = previousChunk.m_baseUVs + previousChunk.m_numOfUVs;
+			chunks[chunkIndex].m_baseNormals = previousChunk.m_baseNormals + previousChunk.m_numOfNormals;
 		}
 	}
-}
 
-void ObjLoader::ParsingVertexUVs(std::string line, std::vector<Vec2>& uvs, bool& outHasUVs)
-{
-	if (line[0] == 'v' && line[1] == 't')
+	ParallelFor(0, numOfChunks, 1, [&](int chunkIndex)
 	{
-		outHasUVs = true;
+		ParseObjChunk(chunks[chunkIndex]);
+	});
 
-		Strings uv;
+	size_t numOfPositions = 0;
+	size_t numOfUVs = 0;
+	size_t numOfNormals = 0;
+	size_t numOfFaces = 0;
+	size_t numOfFaceVertices = 0;
 
-		std::string sug = line;
+	for (ObjChunk const& chunk : chunks)
+	{
+		numOfPositions += chunk.m_data.m_positions.size();
+		numOfUVs += chunk.m_data.m_uvs.size();
+		numOfNormals += chunk.m_data.m_normals.size();
+		numOfFaces += chunk.m_data.m_faces.size();
+		numOfFaceVertices += chunk.m_data.m_faceVertices.size();
+	}
 
-		int d = SplitStringOnDelimiter(uv, sug, "  ");
-		int c = SplitStringOnDelimiter(uv, sug, "   ");
+	outData.m_positions.reserve(numOfPositions);
+	outData.m_uvs.reserve(numOfUVs);
+	outData.m_normals.reserve(numOfNormals);
+	outData.m_faces.reserve(numOfFaces);
+	outData.m_faceVertices.reserve(numOfFaceVertices);
 
-		if (d == 1)
-		{
-			uv = SplitStringOnDelimiter(sug, ' ');
+	std::unordered_map<std::string, int> materialIDs;
+	std::vector<ObjMaterialRun> materialRuns;
 
-			float u = (float)std::atof(uv[1].c_str());
-			float v = (float)std::atof(uv[2].c_str());
+	for (int chunkIndex = 0; chunkIndex < numOfChunks; chunkIndex++)
+	{
+		ObjData& chunkData = chunks[chunkIndex].m_data;
 
-			uvs.push_back(Vec2(u, v));
-		}
-		else if(c == 1)
-		{
-			uv = SplitStringOnDelimiter(sug, ' ');
+		int firstFace = (int)outData.m_faces.size();
+		int firstFaceVertex = (int)outData.m_faceVertices.size();
 
-			float u = (float)std::atof(uv[1].c_str());
-			float v = (float)std::atof(uv[2].c_str());
+		outData.m_positions.insert(outData.m_positions.end(), chunkData.m_positions.begin(), chunkData.m_positions.end());
+		outData.m_uvs.insert(outData.m_uvs.end(), chunkData.m_uvs.begin(), chunkData.m_uvs.end());
+		outData.m_normals.insert(outData.m_normals.end(), chunkData.m_normals.begin(), chunkData.m_normals.end());
+		outData.m_faceVertices.insert(outData.m_faceVertices.end(), chunkData.m_faceVertices.begin(), chunkData.m_faceVertices.end());
 
-			uvs.push_back(Vec2(u, v));
-		}
-		else
+		for (Face face : chunkData.m_faces)
 		{
-			uv = SplitStringOnDelimiter(sug, ' ');
-
-			float u = (float)std::atof(uv[1].c_str());
-			float v = (float)std::atof(uv[2].c_str());
-
-			uvs.push_back(Vec2(u, v));
+			face.m_firstVertex += firstFaceVertex;
+			outData.m_faces.push_back(face);
 		}
-	}
-}
 
-void ObjLoader::ParsingVertexNormals(std::string line, std::vector<Vec3>& normals, bool& outHasNormals)
-{
-	if (line[0] == 'v' && line[1] == 'n')
-	{
-		outHasNormals = true;
+		for (ObjMaterialRun materialRun : chunks[chunkIndex].m_materialRuns)
+		{
+			materialRun.m_firstFace += firstFace;
+			materialRuns.push_back(materialRun);
+		}
 
-		Strings normal;
+		for (std::string_view materialLibraryLine : chunks[chunkIndex].m_materialLibraries)
+		{
+			std::string_view materialFileName = GetNextObjToken(materialLibraryLine);
 
-		std::string sug = line;
+			if (materialFileName.empty())
+				continue;
 
-		int d = SplitStringOnDelimiter(normal, sug, "  ");
-		int c = SplitStringOnDelimiter(normal, sug, "   ");
+			outData.m_materialLibraryFiles.push_back(GetMaterialFilePath(materialFileName));
+			ParsingMaterialFile(outData.m_materialLibraryFiles.back(), outData.m_materials, materialIDs);
+		}
 
-		if (d == 1)
-		{
-			normal = SplitStringOnDelimiter(sug, ' ');
+		outData.m_hasNormals = outData.m_hasNormals || chunkData.m_hasNormals;
+		outData.m_hasUVs = outData.m_hasUVs || chunkData.m_hasUVs;
 
-			float normX = (float)std::atof(normal[1].c_str());
-			float normY = (float)std::atof(normal[2].c_str());
-			float normZ = (float)std::atof(normal[3].c_str());
+		chunkData = ObjData();
+	}
 
-			normals.push_back(Vec3(normX, normY, normZ));
-		}
-		else if(c == 1)
-		{
-			normal = SplitStringOnDelimiter(sug, ' ');
+	for (int runIndex = 0; runIndex < (int)materialRuns.size(); runIndex++)
+	{
+		if (!materialRuns[runIndex].m_hasMaterial)
+			continue;
 
-			float normX = (float)std::atof(normal[1].c_str());
-			float normY = (float)std::atof(normal[2].c_str());
-			float normZ = (float)std::atof(normal[3].c_str());
+		// Names missing from every library stay white, as before materials had IDs
+		auto materialIter = materialIDs.find(materialRuns[runIndex].m_materialName);
 
-			normals.push_back(Vec3(normX, normY, normZ));
-		}
-		else
-		{
-			normal = SplitStringOnDelimiter(sug, ' ');
+		int materialID = materialIter == materialIDs.end() ? -1 : materialIter->second;
+		Rgba8 faceColor = materialID == -1 ? Rgba8::WHITE : outData.m_materials[materialID].m_diffuseColor;
 
-			float normX = (float)std::atof(normal[1].c_str());
-			float normY = (float)std::atof(normal[2].c_str());
-			float normZ = (float)std::atof(normal[3].c_str());
+		int endFace = runIndex + 1 < (int)materialRuns.size() ? materialRuns[runIndex + 1].m_firstFace : (int)outData.m_faces.size();
 
-			normals.push_back(Vec3(normX, normY, normZ));
+		for (int faceIndex = materialRuns[runIndex].m_firstFace; faceIndex < endFace; faceIndex++)
+		{
+			outData.m_faces[faceIndex].m_color = faceColor;
+			outData.m_faces[faceIndex].m_materialID = materialID;
 		}
 	}
 }
 
-void ObjLoader::ParsingFaces(std::string line, std::vector<Face>& outFaces, Rgba8 faceColor)
+void ObjLoader::ParsingVertexPos(std::string_view line, std::vector<Vec3>& positions)
 {
-	if (line[0] == 'f')
-	{
-		Strings faces;
-
-		std::string sug = line;
+	float x = ParseObjFloat(GetNextObjToken(line));
+	float y = ParseObjFloat(GetNextObjToken(line));
+	float z = ParseObjFloat(GetNextObjToken(line));
 
-		faces = SplitStringOnDelimiter(sug, ' ');
+	positions.push_back(Vec3(x, y, z));
+}
 
-		Face face;
+void ObjLoader::ParsingVertexUVs(std::string_view line, std::vector<Vec2>& uvs, bool& outHasUVs)
+{
+	outHasUVs = true;
 
-		for (int j = 1; j < (int)faces.size(); j++)
-		{
-			Strings faceInfo;
+	float u = ParseObjFloat(GetNextObjToken(line));
+	float v = ParseObjFloat(GetNextObjToken(line));
 
-			int d = SplitStringOnDelimiter(faceInfo, faces[j], "//");
+	uvs.push_back(Vec2(u, v));
+}
 
-			if (d == 1)
-			{
-				Vertex vert;
+void ObjLoader::ParsingVertexNormals(std::string_view line, std::vector<Vec3>& normals, bool& outHasNormals)
+{
+	outHasNormals = true;
 
-				if (faceInfo.size() == 2)
-				{
-					vert.m_v = std::atoi(faceInfo[0].c_str());
-					vert.m_vt = -1;
-					vert.m_vn = std::atoi(faceInfo[1].c_str());
+	float normX = ParseObjFloat(GetNextObjToken(line));
+	float normY = ParseObjFloat(GetNextObjToken(line));
+	float normZ = ParseObjFloat(GetNextObjToken(line));
 
-					face.m_vertices.push_back(vert);
-					continue;
-				}
-				else if (faceInfo.size() == 1)
-				{
-					vert.m_v = std::atoi(faceInfo[0].c_str());
-					vert.m_vt = -1;
-					vert.m_vn = -1;
+	normals.push_back(Vec3(normX, normY, normZ));
+}
 
-					face.m_vertices.push_back(vert);
-					continue;
-				}
-			}
+void ObjLoader::ParsingFaces(std::string_view line, std::vector<Face>& outFaces, std::vector<Vertex>& outFaceVertices, int numOfPositions, int numOfUVs, int numOfNormals, Rgba8 faceColor)
+{
+	Face face;
 
-			faceInfo = SplitStringOnDelimiter(faces[j], '/');
+	face.m_firstVertex = (int)outFaceVertices.size();
+	face.m_color = faceColor;
 
-			if (faceInfo.size() == 1)
-			{
-				Vertex vert;
+	// Corners are v, v/vt, v//vn or v/vt/vn; negative indices count back from the last element defined before the face
+	for (std::string_view corner = GetNextObjToken(line); !corner.empty(); corner = GetNextObjToken(line))
+	{
+		Vertex vert;
 
-				vert.m_v = std::atoi(faceInfo[0].c_str());
-				vert.m_vt = -1;
-				vert.m_vn = -1;
+		size_t firstSlash = corner.find('/');
+		vert.m_v = ResolveObjIndex(ParseObjIndex(corner.substr(0, firstSlash)), numOfPositions);
 
-				face.m_vertices.push_back(vert);
-				continue;
-			}
-			else if (faceInfo.size() == 2)
-			{
-				Vertex vert;
+		if (firstSlash != std::string_view::npos)
+		{
+			std::string_view textureAndNormal = corner.substr(firstSlash + 1);
+			size_t secondSlash = textureAndNormal.find('/');
 
-				vert.m_v = std::atoi(faceInfo[0].c_str());
-				vert.m_vt = std::atoi(faceInfo[1].c_str());
-				vert.m_vn = -1;
+			std::string_view texture = textureAndNormal.substr(0, secondSlash);
 
-				face.m_vertices.push_back(vert);
-				continue;
-			}
-			else if (faceInfo.size() == 3)
+			if (!texture.empty())
 			{
-				Vertex vert;
-
-				vert.m_v = std::atoi(faceInfo[0].c_str());
-				vert.m_vt = std::atoi(faceInfo[1].c_str());
-				vert.m_vn = std::atoi(faceInfo[2].c_str());
+				vert.m_vt = ResolveObjIndex(ParseObjIndex(texture), numOfUVs);
+			}
 
-				face.m_vertices.push_back(vert);
-				continue;
+			if (secondSlash != std::string_view::npos && secondSlash + 1 < textureAndNormal.size())
+			{
+				vert.m_vn = ResolveObjIndex(ParseObjIndex(textureAndNormal.substr(secondSlash + 1)), numOfNormals);
 			}
 		}
 
-		face.m_color = faceColor;
-
-		outFaces.push_back(face);
+		outFaceVertices.push_back(vert);
 	}
-}
 
-void ObjLoader::ParsingMaterialFile(std::string line, std::unordered_map<std::string, Rgba8>& outMaterialLib)
-{
-	std::string matrialFile = line.substr(0, 6);
+	face.m_numOfVertices = (int)outFaceVertices.size() - face.m_firstVertex;
 
-	if (matrialFile == "mtllib")
-	{
-		Strings materialInfo;
+	outFaces.push_back(face);
+}
 
-		std::string sug = line;
+void ObjLoader::ParsingMaterialFile(std::string const& materialFilePath, std::vector<ObjMaterial>& outMaterials, std::unordered_map<std::string, int>& outMaterialIDs)
+{
+	std::string materialString;
+	std::string filePath = materialFilePath;
 
-		materialInfo = SplitStringOnDelimiter(sug, ' ');
+	FileReadToString(materialString, filePath);
 
-		Strings materialStrings;
+	// FileReadToString appends a '\0', which would otherwise end up in the last token of a final line without a newline
+	std::string_view materialText = materialString;
 
-		std::string materialString;
-		std::string materialFilePath = "Data/Models/" + materialInfo[1];
+	if (!materialText.empty() && materialText.back() == '\0')
+	{
+		materialText.remove_suffix(1);
+	}
 
-		FileReadToString(materialString, materialFilePath);
+	int materialID = -1;
 
-		int materialSplit = SplitStringOnDelimiter(materialStrings, materialString, "\n");
+	while (!materialText.empty())
+	{
+		std::string_view materialLine = GetNextObjLine(materialText);
+		std::string_view keyword = GetNextObjToken(materialLine);
 
-		if (materialSplit == 1)
+		if (keyword == "newmtl")
 		{
-			std::string materialName;
+			std::string materialName = std::string(GetNextObjToken(materialLine));
+			auto materialIter = outMaterialIDs.find(materialName);
 
-			for (int j = 0; j < (int)materialStrings.size(); j++)
+			if (materialIter != outMaterialIDs.end())
 			{
-				if (materialStrings[j].substr(0, 6) == "newmtl")
-				{
-					Strings newMaterial;
+				materialID = materialIter->second;
+				continue;
+			}
 
-					newMaterial = SplitStringOnDelimiter(materialStrings[j], ' ');
+			materialID = (int)outMaterials.size();
+			outMaterialIDs[materialName] = materialID;
 
-					materialName = newMaterial[1];
-				}
+			ObjMaterial material;
+			material.m_name = materialName;
+			outMaterials.push_back(material);
 
-				if (materialStrings[j].substr(0, 2) == "Kd")
-				{
-					Strings materialDiffuseColor;
+			continue;
+		}
 
-					materialDiffuseColor = SplitStringOnDelimiter(materialStrings[j], ' ');
+		// Statements before the first newmtl have no material to apply to
+		if (materialID == -1)
+			continue;
 
-					Rgba8 color;
+		ObjMaterial& material = outMaterials[materialID];
 
-					float r = (float)std::atof(materialDiffuseColor[1].c_str());
-					float g = (float)std::atof(materialDiffuseColor[2].c_str());
-					float b = (float)std::atof(materialDiffuseColor[3].c_str());
+		if (keyword == "Kd" || keyword == "Ks")
+		{
+			float r = ParseObjFloat(GetNextObjToken(materialLine));
+			float g = ParseObjFloat(GetNextObjToken(materialLine));
+			float b = ParseObjFloat(GetNextObjToken(materialLine));
 
-					color.r  = unsigned char(r * 255);
-					color.g  = unsigned char(g * 255);
-					color.b  = unsigned char(b * 255);
+			Rgba8& color = keyword == "Kd" ? material.m_diffuseColor : material.m_specularColor;
 
-					outMaterialLib[materialName] = color;
-				}
+			color.r  = static_cast<unsigned char>(r * 255);
+			color.g  = static_cast<unsigned char>(g * 255);
+			color.b  = static_cast<unsigned char>(b * 255);
+		}
+		else if (keyword == "Ns")
+		{
+			material.m_specularExponent = ParseObjFloat(GetNextObjToken(materialLine));
+		}
+		else if (keyword == "map_Kd" || keyword == "map_Bump" || keyword == "map_bump" || keyword == "bump")
+		{
+			// Map options such as -s or -bm come before the file name, which is always the last token
+			std::string_view mapFileName;
+
+			for (std::string_view token = GetNextObjToken(materialLine); !token.empty(); token = GetNextObjToken(materialLine))
+			{
+				mapFileName = token;
 			}
+
+			if (mapFileName.empty())
+				continue;
+
+			std::string& mapFilePath = keyword == "map_Kd" ? material.m_diffuseMapFilePath : material.m_bumpMapFilePath;
+			mapFilePath = GetMaterialFilePath(mapFileName);
 		}
 	}
 }
 
-void ObjLoader::GenerateVerticesAndIndices(std::vector<Face> inFaces, std::vector<Vec3> positions, std::vector<Vec2> uvs, std::vector<Vec3> normals, std::vector<Vertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices)
+std::string ObjLoader::GetMaterialFilePath(std::string_view materialFileName)
+{
+	return "Data/Models/" + std::string(materialFileName);
+}
+
+void ObjLoader::GenerateVerticesAndIndices(std::vector<Face> const& inFaces, std::vector<Vertex> const& faceVertices, std::vector<Vec3> const& positions, std::vector<Vec2> const& uvs, std::vector<Vec3> const& normals, std::vector<Vertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices, std::vector<ObjSubmesh>& outSubmeshes)
 {
 	int index = 0;
+	size_t numOfTriangles = 0;
+	int numOfMaterials = 0;
+
+	for (Face const& face : inFaces)
+	{
+		numOfTriangles += face.m_numOfVertices > 2 ? face.m_numOfVertices - 2 : 0;
+		numOfMaterials = face.m_materialID >= numOfMaterials ? face.m_materialID + 1 : numOfMaterials;
+	}
+
+	outVertices.reserve(outVertices.size() + faceVertices.size());
+	outIndices.reserve(outIndices.size() + 3 * numOfTriangles);
+
+	std::vector<int> faceFirstVertices(inFaces.size());
 
 	for (int i = 0; i < (int)inFaces.size(); i++)
 	{
-		for (int j = 0; j < (int)inFaces[i].m_vertices.size(); j++)
+		for (int j = 0; j < inFaces[i].m_numOfVertices; j++)
 		{
-			Vertex faceVertex = inFaces[i].m_vertices[j];
+			Vertex faceVertex = faceVertices[inFaces[i].m_firstVertex + j];
 			Rgba8 faceColor = inFaces[i].m_color;
 
 			Vertex_PCUTBN vertex;
@@ -725,28 +881,72 @@ void ObjLoader::GenerateVerticesAndIndices(std::vector<Face> inFaces, std::vecto
 			outVertices.push_back(vertex);
 		}
 
-		for (int j = 0; j < (int)inFaces[i].m_vertices.size() - 2; j++)
+		faceFirstVertices[i] = index;
+		index += inFaces[i].m_numOfVertices;
+	}
+
+	// Counting sort of the faces by material, so every material's triangles are contiguous and keep their file order.
+	// Slot 0 holds the faces without a material.
+	std::vector<int> materialStarts(numOfMaterials + 2, 0);
+	std::vector<int> sortedFaces(inFaces.size());
+
+	for (Face const& face : inFaces)
+	{
+		materialStarts[face.m_materialID + 2]++;
+	}
+
+	for (int materialSlot = 0; materialSlot <= numOfMaterials; materialSlot++)
+	{
+		materialStarts[materialSlot + 1] += materialStarts[materialSlot];
+	}
+
+	std::vector<int> materialCursors(materialStarts.begin(), materialStarts.end() - 1);
+
+	for (int i = 0; i < (int)inFaces.size(); i++)
+	{
+		sortedFaces[materialCursors[inFaces[i].m_materialID + 1]++] = i;
+	}
+
+	for (int materialSlot = 0; materialSlot <= numOfMaterials; materialSlot++)
+	{
+		ObjSubmesh submesh;
+		submesh.m_materialID = materialSlot - 1;
+		submesh.m_firstIndex = (unsigned int)outIndices.size();
+
+		for (int sortedIndex = materialStarts[materialSlot]; sortedIndex < materialStarts[materialSlot + 1]; sortedIndex++)
 		{
-			unsigned int i0 = index + 0;
-			unsigned int i1 = index + j + 1;
-			unsigned int i2 = index + j + 2;
+			Face const& face = inFaces[sortedFaces[sortedIndex]];
+			unsigned int firstVertex = (unsigned int)faceFirstVertices[sortedFaces[sortedIndex]];
 
-			outIndices.push_back(i0);
-			outIndices.push_back(i1);
-			outIndices.push_back(i2);
+			for (int j = 0; j < face.m_numOfVertices - 2; j++)
+			{
+				unsigned int i0 = firstVertex + 0;
+				unsigned int i1 = firstVertex + j + 1;
+				unsigned int i2 = firstVertex + j + 2;
+
+				outIndices.push_back(i0);
+				outIndices.push_back(i1);
+				outIndices.push_back(i2);
+			}
 		}
 
-		index += (int)inFaces[i].m_vertices.size();
-	}
+		submesh.m_numOfIndices = (unsigned int)outIndices.size() - submesh.m_firstIndex;
 
-	
+		if (submesh.m_numOfIndices > 0)
+		{
+			outSubmeshes.push_back(submesh);
+		}
+	}
 
 	CalculateTangentSpaceBasisVectors(outVertices, outIndices, true, true);
+
+	// Normals are rebuilt per triangle above, so only vertices that came out identical are merged and shading is unchanged
+	DeduplicateVertices(outVertices, outIndices);
 }
 
 #if DX12_RENDERER
 
-void ObjLoader::GenerateVerticesAndIndices(std::vector<Face> inFaces, std::vector<Vec3> positions, std::vector<Vec2> uvs, std::vector<Vec3> normals, std::vector<MeshVertex_PCU>& outVertices, std::vector<unsigned int>& outIndices)
+void ObjLoader::GenerateVerticesAndIndices(std::vector<Face> const& inFaces, std::vector<Vertex> const& faceVertices, std::vector<Vec3> const& positions, std::vector<Vec2> const& uvs, std::vector<Vec3> const& normals, std::vector<MeshVertex_PCU>& outVertices, std::vector<unsigned int>& outIndices)
 {
 	Rgba8 color = Rgba8::WHITE;
 
@@ -766,9 +966,9 @@ void ObjLoader::GenerateVerticesAndIndices(std::vector<Face> inFaces, std::vecto
 
 	for (int i = 0; i < inFaces.size(); i++)
 	{
-		for (int j = 0; j < inFaces[i].m_vertices.size(); j++)
+		for (int j = 0; j < inFaces[i].m_numOfVertices; j++)
 		{
-			Vertex faceVertex = inFaces[i].m_vertices[j];
+			Vertex faceVertex = faceVertices[inFaces[i].m_firstVertex + j];
 			Rgba8 faceColor = inFaces[i].m_color;
 
 			MeshVertex_PCU vertex;
@@ -795,11 +995,11 @@ void ObjLoader::GenerateVerticesAndIndices(std::vector<Face> inFaces, std::vecto
 			outVertices.push_back(vertex);
 		}
 
-		for (int j = 0; j < inFaces[i].m_vertices.size() - 2; j++)
+		for (int j = 0; j < inFaces[i].m_numOfVertices - 2; j++)
 		{
-			unsigned int i0 = inFaces[i].m_vertices[0    ].m_v - 1;
-			unsigned int i1 = inFaces[i].m_vertices[j + 1].m_v - 1;
-			unsigned int i2 = inFaces[i].m_vertices[j + 2].m_v - 1;
+			unsigned int i0 = faceVertices[inFaces[i].m_firstVertex        ].m_v - 1;
+			unsigned int i1 = faceVertices[inFaces[i].m_firstVertex + j + 1].m_v - 1;
+			unsigned int i2 = faceVertices[inFaces[i].m_firstVertex + j + 2].m_v - 1;
 
 			outIndices.push_back(i0);
 			outIndices.push_back(i1);
@@ -808,7 +1008,7 @@ void ObjLoader::GenerateVerticesAndIndices(std::vector<Face> inFaces, std::vecto
 	}
 }
 
-void ObjLoader::GenerateVerticesAndIndices(std::vector<Face> inFaces, std::vector<Vec3> positions, std::vector<Vec2> uvs, std::vector<Vec3> normals, std::vector<MeshVertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices)
+void ObjLoader::GenerateVerticesAndIndices(std::vector<Face> const& inFaces, std::vector<Vertex> const& faceVertices, std::vector<Vec3> const& positions, std::vector<Vec2> const& uvs, std::vector<Vec3> const& normals, std::vector<MeshVertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices)
 {
 	Rgba8 color = Rgba8::WHITE;
 
@@ -828,9 +1028,9 @@ void ObjLoader::GenerateVerticesAndIndices(std::vector<Face> inFaces, std::vecto
 
 	for (int i = 0; i < inFaces.size(); i++)
 	{
-		for (int j = 0; j < inFaces[i].m_vertices.size(); j++)
+		for (int j = 0; j < inFaces[i].m_numOfVertices; j++)
 		{
-			Vertex faceVertex = inFaces[i].m_vertices[j];
+			Vertex faceVertex = faceVertices[inFaces[i].m_firstVertex + j];
 			Rgba8 faceColor = inFaces[i].m_color;
 
 			MeshVertex_PCUTBN vertex;
@@ -873,11 +1073,11 @@ void ObjLoader::GenerateVerticesAndIndices(std::vector<Face> inFaces, std::vecto
 			outVertices.push_back(vertex);
 		}
 
-		for (int j = 0; j < inFaces[i].m_vertices.size() - 2; j++)
+		for (int j = 0; j < inFaces[i].m_numOfVertices - 2; j++)
 		{
-			unsigned int i0 = inFaces[i].m_vertices[0    ].m_v - 1;
-			unsigned int i1 = inFaces[i].m_vertices[j + 1].m_v - 1;
-			unsigned int i2 = inFaces[i].m_vertices[j + 2].m_v - 1;
+			unsigned int i0 = faceVertices[inFaces[i].m_firstVertex        ].m_v - 1;
+			unsigned int i1 = faceVertices[inFaces[i].m_firstVertex + j + 1].m_v - 1;
+			unsigned int i2 = faceVertices[inFaces[i].m_firstVertex + j + 2].m_v - 1;
 
 			outIndices.push_back(i0);
 			outIndices.push_back(i1);
@@ -10,6 +10,7 @@
 #include "Engine/Renderer/Model.hpp"
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 #include <map>
@@ -38,8 +39,43 @@ struct VertexEqual {
 
 struct Face
 {
-	std::vector<Vertex> m_vertices;
+	int m_firstVertex = 0;		// Index of the face's first corner in ObjData::m_faceVertices
+	int m_numOfVertices = 0;
 	Rgba8 m_color;
+	int m_materialID = -1;		// Index into ObjData::m_materials, -1 without a known usemtl
+};
+
+// One newmtl block of an MTL file. Texture paths are resolved like mtllib paths; the renderer loads them through its texture cache.
+struct ObjMaterial
+{
+	std::string m_name;
+	Rgba8 m_diffuseColor;							// Kd
+	Rgba8 m_specularColor = Rgba8::BLACK;			// Ks
+	float m_specularExponent = 0.0f;				// Ns
+	std::string m_diffuseMapFilePath;				// map_Kd
+	std::string m_bumpMapFilePath;					// map_Bump or bump
+};
+
+// Range of the index buffer that draws with one material
+struct ObjSubmesh
+{
+	int m_materialID = -1;
+	unsigned int m_firstIndex = 0;
+	unsigned int m_numOfIndices = 0;
+};
+
+// Everything parsed from one OBJ file. Face corners are packed into a single array so parsing never allocates per face.
+struct ObjData
+{
+	std::vector<Vec3> m_positions;
+	std::vector<Vec2> m_uvs;
+	std::vector<Vec3> m_normals;
+	std::vector<Vertex> m_faceVertices;
+	std::vector<Face> m_faces;
+	std::vector<ObjMaterial> m_materials;
+	std::vector<std::string> m_materialLibraryFiles;	// Paths of every mtllib read, in file order
+	bool m_hasNormals = false;
+	bool m_hasUVs = false;
 };
 
 struct Triangle
@@ -73,21 +109,30 @@ public:
 	~ObjLoader() = default;
 
 	static bool Load(std::string const& fileName, Mat44 const& transform, std::vector<Vertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices, bool& outHasNormals, bool& outHasUVs);
+	// Indices come out grouped by material, with one submesh per material that has faces
+	static bool Load(std::string const& fileName, Mat44 const& transform, std::vector<Vertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices, std::vector<ObjMaterial>& outMaterials, std::vector<ObjSubmesh>& outSubmeshes, bool& outHasNormals, bool& outHasUVs);
+
+	static void ParseFile(std::string const& fileName, ObjData& outData);
+	static void ParseText(std::string_view text, ObjData& outData);
+
+	// Each Parsing function takes the rest of a line after its keyword
+	static void ParsingVertexPos(std::string_view line, std::vector<Vec3>& positions);
+	static void ParsingVertexUVs(std::string_view line, std::vector<Vec2>& uvs, bool& outHasUVs);
+	static void ParsingVertexNormals(std::string_view line, std::vector<Vec3>& normals, bool& outHasNormals);
+	static void ParsingFaces(std::string_view line, std::vector<Face>& outFaces, std::vector<Vertex>& outFaceVertices, int numOfPositions, int numOfUVs, int numOfNormals, Rgba8 faceColor = Rgba8::WHITE);
 
-	static void ParsingVertexPos(std::string line, std::vector<Vec3>& positions);
-	static void ParsingVertexUVs(std::string line, std::vector<Vec2>& uvs, bool& outHasUVs);
-	static void ParsingVertexNormals(std::string line, std::vector<Vec3>& normals, bool& outHasNormals);
-	static void ParsingFaces(std::string line, std::vector<Face>& outFaces, Rgba8 faceColor = Rgba8::WHITE);
-	static void ParsingMaterialFile(std::string line, std::unordered_map<std::string, Rgba8>& outMaterialLib);
-	static void GenerateVerticesAndIndices(std::vector<Face> inFaces, std::vector<Vec3> positions, std::vector<Vec2> uvs, std::vector<Vec3> normals, std::vector<Vertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices);
+	// Appends the file's materials; a newmtl name that is already in outMaterialIDs updates that material instead
+	static void ParsingMaterialFile(std::string const& materialFilePath, std::vector<ObjMaterial>& outMaterials, std::unordered_map<std::string, int>& outMaterialIDs);
+	static std::string GetMaterialFilePath(std::string_view materialFileName);
+	static void GenerateVerticesAndIndices(std::vector<Face> const& inFaces, std::vector<Vertex> const& faceVertices, std::vector<Vec3> const& positions, std::vector<Vec2> const& uvs, std::vector<Vec3> const& normals, std::vector<Vertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices, std::vector<ObjSubmesh>& outSubmeshes);
 
 #if DX12_RENDERER
 
 	static bool Load(std::string const& fileName, Mat44 const& transform, std::vector<MeshVertex_PCU>& outVertices, std::vector<unsigned int>& outIndices, bool& outHasNormals, bool& outHasUVs);
 	static bool Load(std::string const& fileName, Mat44 const& transform, std::vector<MeshVertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices, bool& outHasNormals, bool& outHasUVs);
 	static bool LoadXML(std::string const& fileName, Mat44 const& transform, std::vector<MeshVertex_PCU>& outVertices, std::vector<unsigned int>& outIndices, bool& outHasNormals, bool& outHasUVs);
-	static void GenerateVerticesAndIndices(std::vector<Face> inFaces, std::vector<Vec3> positions, std::vector<Vec2> uvs, std::vector<Vec3> normals, std::vector<MeshVertex_PCU>& outVertices, std::vector<unsigned int>& outIndices);
-	static void GenerateVerticesAndIndices(std::vector<Face> inFaces, std::vector<Vec3> positions, std::vector<Vec2> uvs, std::vector<Vec3> normals, std::vector<MeshVertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices);
+	static void GenerateVerticesAndIndices(std::vector<Face> const& inFaces, std::vector<Vertex> const& faceVertices, std::vector<Vec3> const& positions, std::vector<Vec2> const& uvs, std::vector<Vec3> const& normals, std::vector<MeshVertex_PCU>& outVertices, std::vector<unsigned int>& outIndices);
+	static void GenerateVerticesAndIndices(std::vector<Face> const& inFaces, std::vector<Vertex> const& faceVertices, std::vector<Vec3> const& positions, std::vector<Vec2> const& uvs, std::vector<Vec3> const& normals, std::vector<MeshVertex_PCUTBN>& outVertices, std::vector<unsigned int>& outIndices);
 
 
 #endif
@@ -84,8 +84,7 @@ Mat44 Particle::GetModelMatrix() const
 Emitter::Emitter(std::string name, Vec3 position, float timer, unsigned int seed)
 	: m_position(position), m_lifeTime(timer), m_name(name)
 {
-	UNUSED(seed);
-	m_rng = RandomNumberGenerator();
+	m_rng = RandomNumberGenerator(seed);
 	m_timer = m_lifeTime;
 }
 
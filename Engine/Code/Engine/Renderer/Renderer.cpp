@@ -60,6 +60,9 @@ void Renderer::StartUp()
 
 void Renderer::BeginFrame()
 {
+	m_lastFrameStats = m_frameStats;
+	m_frameStats = RenderFrameStats();
+
 #if DX11_RENDERER
 	m_DX11Renderer->BeginFrame();
 #elif DX12_RENDERER
@@ -85,6 +88,16 @@ void Renderer::ShutDown()
 #endif
 }
 
+RenderFrameStats const& Renderer::GetFrameStats() const
+{
+	return m_frameStats;
+}
+
+RenderFrameStats const& Renderer::GetLastFrameStats() const
+{
+	return m_lastFrameStats;
+}
+
 Model* Renderer::LoadModel(char const* filePath, RootSig pipelineMode)
 {
 #if DX11_RENDERER
@@ -198,6 +211,8 @@ VertexBuffer* Renderer::CreateVertexBuffer(size_t const size, std::wstring buffe
 
 void Renderer::CopyCPUToGPU(void const* data, size_t size, VertexBuffer*& vbo)
 {
+	m_frameStats.m_numOfUploadedBytes += size;
+
 #if DX11_RENDERER
 	m_DX11Renderer->CopyCPUToGPU(data, size, vbo);
 #elif DX12_RENDERER
@@ -226,6 +241,8 @@ IndexBuffer* Renderer::CreateIndexBuffer(size_t const size)
 
 void Renderer::CopyCPUToGPU(void const* data, size_t size, IndexBuffer*& ibo)
 {
+	m_frameStats.m_numOfUploadedBytes += size;
+
 #if DX11_RENDERER
 	m_DX11Renderer->CopyCPUToGPU(data, size, ibo);
 #elif DX12_RENDERER
@@ -254,6 +271,8 @@ MeshBuffer* Renderer::CreateMeshBuffer(size_t const size, std::wstring bufferDeb
 
 void Renderer::CopyCPUToGPU(void const* data, size_t size, MeshBuffer*& mbo)
 {
+	m_frameStats.m_numOfUploadedBytes += size;
+
 	UNUSED(data);
 	UNUSED(size);
 	UNUSED(mbo);
@@ -281,6 +300,8 @@ ConstantBuffer* Renderer::CreateConstantBuffer(size_t const size, std::wstring b
 
 void Renderer::CopyCPUToGPU(void const* data, size_t size, ConstantBuffer* cbo)
 {
+	m_frameStats.m_numOfUploadedBytes += size;
+
 #if DX11_RENDERER
 	m_DX11Renderer->CopyCPUToGPU(data, size, cbo);
 #elif DX12_RENDERER
@@ -493,6 +514,8 @@ void Renderer::EndCamera(Camera const& camera)
 
 void Renderer::DrawVertexBuffer(VertexBuffer* vbo, int vertexCount, int vertexStride, int vertexOffset, PrimitiveType type)
 {
+	m_frameStats.m_numOfDrawCalls++;
+
 #if DX11_RENDERER
 	m_DX11Renderer->DrawVertexBuffer(vbo, vertexCount, vertexStride, vertexOffset, type);
 #elif DX12_RENDERER
@@ -503,6 +526,8 @@ void Renderer::DrawVertexBuffer(VertexBuffer* vbo, int vertexCount, int vertexSt
 
 void Renderer::DrawVertexBufferIndexed(VertexBuffer* vbo, IndexBuffer* ibo, int vertexStride, PrimitiveType type)
 {
+	m_frameStats.m_numOfDrawCalls++;
+
 #if DX11_RENDERER
 	m_DX11Renderer->DrawVertexBufferIndexed(vbo, ibo, vertexStride, type);
 #elif DX12_RENDERER
@@ -511,8 +536,24 @@ void Renderer::DrawVertexBufferIndexed(VertexBuffer* vbo, IndexBuffer* ibo, int
 #endif
 }
 
+void Renderer::DrawVertexBufferIndexedRange(VertexBuffer* vbo, IndexBuffer* ibo, int indexCount, int startIndex, int vertexStride, PrimitiveType type)
+{
+	m_frameStats.m_numOfDrawCalls++;
+
+#if DX11_RENDERER
+	m_DX11Renderer->DrawVertexBufferIndexedRange(vbo, ibo, indexCount, startIndex, vertexStride, type);
+#elif DX12_RENDERER
+	UNUSED(type);
+	return m_DX12Renderer->DrawVertexBufferIndexedRange(vbo, ibo, indexCount, startIndex, vertexStride);
+#endif
+}
+
 void Renderer::DrawVertexArray(int numVertexes, Vertex_PCU const* vertexes)
 {
+	// Immediate draws upload their verts into a scratch buffer first
+	m_frameStats.m_numOfDrawCalls++;
+	m_frameStats.m_numOfUploadedBytes += numVertexes * sizeof(Vertex_PCU);
+
 #if DX11_RENDERER
 	m_DX11Renderer->DrawVertexArray(numVertexes, vertexes);
 #elif DX12_RENDERER
@@ -522,6 +563,9 @@ void Renderer::DrawVertexArray(int numVertexes, Vertex_PCU const* vertexes)
 
 void Renderer::DrawVertexArrayIndexed(int numVertexes, Vertex_PCU const* vertexes, std::vector<unsigned int> const& indices)
 {
+	m_frameStats.m_numOfDrawCalls++;
+	m_frameStats.m_numOfUploadedBytes += numVertexes * sizeof(Vertex_PCU) + indices.size() * sizeof(unsigned int);
+
 #if DX11_RENDERER
 	m_DX11Renderer->DrawVertexArrayIndexed(numVertexes, vertexes, indices);
 #elif DX12_RENDERER
@@ -531,6 +575,9 @@ void Renderer::DrawVertexArrayIndexed(int numVertexes, Vertex_PCU const* vertexe
 
 void Renderer::DrawVertexArray(int numVertexes, Vertex_PCUTBN const* vertexes)
 {
+	m_frameStats.m_numOfDrawCalls++;
+	m_frameStats.m_numOfUploadedBytes += numVertexes * sizeof(Vertex_PCUTBN);
+
 #if DX11_RENDERER
 	m_DX11Renderer->DrawVertexArray(numVertexes, vertexes);
 #elif DX12_RENDERER
@@ -540,6 +587,9 @@ void Renderer::DrawVertexArray(int numVertexes, Vertex_PCUTBN const* vertexes)
 
 void Renderer::DrawVertexArrayIndexed(int numVertexes, Vertex_PCUTBN const* vertexes, std::vector<unsigned int> const& indices)
 {
+	m_frameStats.m_numOfDrawCalls++;
+	m_frameStats.m_numOfUploadedBytes += numVertexes * sizeof(Vertex_PCUTBN) + indices.size() * sizeof(unsigned int);
+
 #if DX11_RENDERER
 	m_DX11Renderer->DrawVertexArrayIndexed(numVertexes, vertexes, indices);
 #elif DX12_RENDERER
@@ -548,6 +598,8 @@ void Renderer::DrawVertexArrayIndexed(int numVertexes, Vertex_PCUTBN const* vert
 }
 void Renderer::DrawMesh(int numOfMeshlets, uint32_t isSecondPass)
 {
+	m_frameStats.m_numOfDrawCalls++;
+
 	UNUSED(numOfMeshlets);
 	UNUSED(isSecondPass);
 #if DX11_RENDERER
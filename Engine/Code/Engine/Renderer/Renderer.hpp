@@ -114,6 +114,13 @@ struct RenderConfig
 	Window* m_window = nullptr;
 };
 
+// Draw calls and bytes copied into vertex/index/mesh/constant buffers through the Renderer in one frame
+struct RenderFrameStats
+{
+	int		m_numOfDrawCalls		= 0;
+	size_t	m_numOfUploadedBytes	= 0;
+};
+
 class Renderer
 {
 public:
@@ -121,6 +128,8 @@ public:
 	DX12Renderer*				m_DX12Renderer			= nullptr;
 
 	RenderConfig				m_config;
+	RenderFrameStats			m_frameStats;
+	RenderFrameStats			m_lastFrameStats;
 public:
 	Renderer(RenderConfig const& config);
 	~Renderer();
@@ -130,6 +139,9 @@ public:
 	void			EndFrame();
 	void			ShutDown();
 
+	RenderFrameStats const&	GetFrameStats() const;
+	RenderFrameStats const&	GetLastFrameStats() const;
+
 	Model*			LoadModel(char const* filePath, RootSig pipelineMode);
 
 	BitmapFont*		CreateOrGetBitmapFont( const char* bitmapFontFilePathWithNoExtension );
@@ -188,6 +200,7 @@ public:
 	void			EndCamera(Camera const& camera);
 	void			DrawVertexBuffer(VertexBuffer* vbo, int vertexCount, int vertexStride = 0, int vertexOffset = 0, PrimitiveType type = PrimitiveType::TRIANGLE_LIST);
 	void			DrawVertexBufferIndexed(VertexBuffer* vbo, IndexBuffer* ibo, int vertexStride = 0, PrimitiveType type = PrimitiveType::TRIANGLE_LIST);
+	void			DrawVertexBufferIndexedRange(VertexBuffer* vbo, IndexBuffer* ibo, int indexCount, int startIndex, int vertexStride = 0, PrimitiveType type = PrimitiveType::TRIANGLE_LIST);
 	void			DrawVertexArray(int numVertexes, Vertex_PCU const* vertexes);
 	void			DrawVertexArrayIndexed(int numVertexes, Vertex_PCU const* vertexes, std::vector<unsigned int> const& indices);
 	void			DrawVertexArray(int numVertexes, Vertex_PCUTBN const* vertexes);
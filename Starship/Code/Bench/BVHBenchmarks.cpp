@@ -0,0 +1,207 @@
+#include "Bench/BenchFramework.hpp"
+
+#include "Engine/Math/BVH3D.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/ParallelFor.hpp"
+#include "Engine/Core/Time.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+constexpr int	BVH_BENCH_NUM_OF_PRIMITIVES		= 100000;
+constexpr int	BVH_BENCH_NUM_OF_RAYS			= 1000000;
+constexpr int	BVH_BENCH_NUM_OF_BRUTE_RAYS		= 200;
+constexpr float	BVH_BENCH_WORLD_SIZE			= 1000.0f;
+constexpr float	BVH_BENCH_RAY_LENGTH			= 400.0f;
+
+struct BenchRay
+{
+	Vec3	m_startPos;
+	Vec3	m_fwdNormal;
+};
+
+static float RollFloat(std::mt19937& rng, float minValue, float maxValue)
+{
+	return std::uniform_real_distribution<float>(minValue, maxValue)(rng);
+}
+
+static Vec3 RollPosition(std::mt19937& rng)
+{
+	return Vec3(RollFloat(rng, 0.0f, BVH_BENCH_WORLD_SIZE), RollFloat(rng, 0.0f, BVH_BENCH_WORLD_SIZE), RollFloat(rng, 0.0f, BVH_BENCH_WORLD_SIZE));
+}
+
+static Vec3 RollDirection(std::mt19937& rng)
+{
+	Vec3 direction;
+
+	do
+	{
+		direction = Vec3(RollFloat(rng, -1.0f, 1.0f), RollFloat(rng, -1.0f, 1.0f), RollFloat(rng, -1.0f, 1.0f));
+	}
+	while (direction.GetLengthSquared() < 0.01f || direction.GetLengthSquared() > 1.0f);
+
+	return direction.GetNormalized();
+}
+
+// An even mix of every primitive type, scattered through a cube with sizes of a few units
+static void AddRandomPrimitives(std::mt19937& rng, BVH3D& bvh)
+{
+	for (int id = 0; id < BVH_BENCH_NUM_OF_PRIMITIVES; id++)
+	{
+		Vec3 center = RollPosition(rng);
+		float size = RollFloat(rng, 1.0f, 6.0f);
+
+		switch (id % 5)
+		{
+		case 0:
+			bvh.AddAABB3(id, AABB3(center.x - size, center.y - size, center.z - size, center.x + size, center.y + size, center.z + size * 0.5f));
+			break;
+		case 1:
+			bvh.AddOBB3(id, OBB3(center, RollDirection(rng), Vec3(size, size * 0.5f, size * 0.75f)));
+			break;
+		case 2:
+			bvh.AddSphere(id, center, size);
+			break;
+		case 3:
+			bvh.AddZCylinder(id, center, size * 2.0f, size * 0.5f);
+			break;
+		default:
+			bvh.AddTriangle(id, center, center + RollDirection(rng) * size * 2.0f, center + RollDirection(rng) * size * 2.0f);
+			break;
+		}
+	}
+}
+
+// What every query did before the BVH: test every primitive and keep the nearest
+static int RaycastBruteForce(BVH3D const& bvh, BenchRay const& ray, float& outImpactDist)
+{
+	int hitHandle = -1;
+	outImpactDist = BVH_BENCH_RAY_LENGTH;
+
+	for (int handle = 0; handle < bvh.GetNumOfPrimitives(); handle++)
+	{
+		RaycastResult3D result = bvh.RaycastPrimitive(handle, ray.m_startPos, ray.m_fwdNormal, BVH_BENCH_RAY_LENGTH);
+
+		if (result.m_didImpact && result.m_impactDist < outImpactDist)
+		{
+			outImpactDist = result.m_impactDist;
+			hitHandle = handle;
+		}
+	}
+
+	return hitHandle;
+}
+
+BENCHMARK(BVH_1MRaysVs100KPrimitives)
+{
+	UNUSED(argc);
+	UNUSED(argv);
+
+	std::mt19937 rng(17);
+	BVH3D bvh;
+
+	AddRandomPrimitives(rng, bvh);
+
+	std::vector<BenchRay> rays(BVH_BENCH_NUM_OF_RAYS);
+
+	for (BenchRay& ray : rays)
+	{
+		ray.m_startPos = RollPosition(rng);
+		ray.m_fwdNormal = RollDirection(rng);
+	}
+
+	double buildStartTime = GetCurrentTimeSeconds();
+	bvh.Build();
+	double buildSeconds = GetCurrentTimeSeconds() - buildStartTime;
+
+	printf("Build:            %8.1f ms for %d primitives, %d nodes\n", buildSeconds * 1000.0, bvh.GetNumOfPrimitives(), bvh.GetNumOfNodes());
+
+	// Closest hit, one thread
+	int numOfHits = 0;
+	double closestStartTime = GetCurrentTimeSeconds();
+
+	for (BenchRay const& ray : rays)
+	{
+		int hitID;
+		bvh.RaycastClosest(ray.m_startPos, ray.m_fwdNormal, BVH_BENCH_RAY_LENGTH, hitID);
+
+		numOfHits += hitID >= 0 ? 1 : 0;
+	}
+
+	double closestSeconds = GetCurrentTimeSeconds() - closestStartTime;
+
+	printf("Closest, 1 thread:%8.2f Mrays/s (%d of %d rays hit)\n", BVH_BENCH_NUM_OF_RAYS / closestSeconds * 1e-6, numOfHits, BVH_BENCH_NUM_OF_RAYS);
+
+	// Any hit, one thread
+	int numOfAnyHits = 0;
+	double anyStartTime = GetCurrentTimeSeconds();
+
+	for (BenchRay const& ray : rays)
+	{
+		numOfAnyHits += bvh.RaycastAny(ray.m_startPos, ray.m_fwdNormal, BVH_BENCH_RAY_LENGTH) ? 1 : 0;
+	}
+
+	double anySeconds = GetCurrentTimeSeconds() - anyStartTime;
+
+	printf("Any, 1 thread:    %8.2f Mrays/s\n", BVH_BENCH_NUM_OF_RAYS / anySeconds * 1e-6);
+
+	// Closest hit spread across every core
+	JobSystemConfig config;
+	config.m_numOfWorkerThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+
+	JobSystem jobSystem(config);
+	jobSystem.StartUp();
+
+	std::atomic<int> numOfParallelHits = 0;
+	double parallelStartTime = GetCurrentTimeSeconds();
+
+	ParallelFor(0, BVH_BENCH_NUM_OF_RAYS, 1024, [&](int rayIndex)
+	{
+		int hitID;
+		bvh.RaycastClosest(rays[rayIndex].m_startPos, rays[rayIndex].m_fwdNormal, BVH_BENCH_RAY_LENGTH, hitID);
+
+		if (hitID >= 0)
+		{
+			numOfParallelHits++;
+		}
+	}, &jobSystem);
+
+	double parallelSeconds = GetCurrentTimeSeconds() - parallelStartTime;
+
+	jobSystem.ShutDown();
+
+	printf("Closest, %2d threads:%6.2f Mrays/s\n", config.m_numOfWorkerThreads + 1, BVH_BENCH_NUM_OF_RAYS / parallelSeconds * 1e-6);
+
+	// Brute force on a sample of the rays, to check the hits and extrapolate the speedup
+	int numOfMismatches = 0;
+	double bruteStartTime = GetCurrentTimeSeconds();
+
+	for (int rayIndex = 0; rayIndex < BVH_BENCH_NUM_OF_BRUTE_RAYS; rayIndex++)
+	{
+		BenchRay const& ray = rays[rayIndex];
+
+		float bruteDist;
+		int bruteHandle = RaycastBruteForce(bvh, ray, bruteDist);
+
+		int hitID;
+		RaycastResult3D result = bvh.RaycastClosest(ray.m_startPos, ray.m_fwdNormal, BVH_BENCH_RAY_LENGTH, hitID);
+
+		// Handles and ids match because primitives were added with ids 0..N-1
+		if (hitID != bruteHandle || (hitID >= 0 && result.m_impactDist != bruteDist))
+		{
+			numOfMismatches++;
+		}
+	}
+
+	double bruteSeconds = (GetCurrentTimeSeconds() - bruteStartTime) / BVH_BENCH_NUM_OF_BRUTE_RAYS * BVH_BENCH_NUM_OF_RAYS;
+
+	printf("Brute force:      %8.4f Mrays/s (sampled on %d rays), BVH is %.0fx faster\n", BVH_BENCH_NUM_OF_RAYS / bruteSeconds * 1e-6, BVH_BENCH_NUM_OF_BRUTE_RAYS, bruteSeconds / closestSeconds);
+	printf("Mismatches against brute force: %d\n", numOfMismatches);
+
+	DoNotOptimizeAway(numOfHits + numOfAnyHits + numOfParallelHits);
+}
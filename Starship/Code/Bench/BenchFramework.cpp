@@ -0,0 +1,72 @@
+#include "Bench/BenchFramework.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+struct Benchmark
+{
+	char const*			m_name		= nullptr;
+	BenchmarkFunction	m_function	= nullptr;
+};
+
+// Function-local so registration from other translation units never runs before the list exists
+static std::vector<Benchmark>& GetBenchmarks()
+{
+	static std::vector<Benchmark> s_benchmarks;
+	return s_benchmarks;
+}
+
+static void const* volatile s_sinkPointer = nullptr;
+static int volatile s_sinkValue = 0;
+
+BenchmarkRegistrar::BenchmarkRegistrar(char const* name, BenchmarkFunction function)
+{
+	Benchmark benchmark;
+	benchmark.m_name = name;
+	benchmark.m_function = function;
+
+	GetBenchmarks().push_back(benchmark);
+}
+
+void DoNotOptimizeAway(void const* value)
+{
+	s_sinkPointer = value;
+}
+
+void DoNotOptimizeAway(int value)
+{
+	s_sinkValue = s_sinkValue + value;
+}
+
+// Usage: Bench [filter] [arguments for the benchmark...]. With no filter every benchmark runs.
+int main(int argc, char* argv[])
+{
+	char const* filter = argc > 1 ? argv[1] : nullptr;
+	int numOfBenchmarkArgs = argc > 2 ? argc - 2 : 0;
+	char** benchmarkArgs = argv + 2;
+
+	int numOfRunBenchmarks = 0;
+
+	for (Benchmark const& benchmark : GetBenchmarks())
+	{
+		if (filter && !strstr(benchmark.m_name, filter))
+			continue;
+
+		printf("== %s\n", benchmark.m_name);
+		fflush(stdout);
+
+		benchmark.m_function(numOfBenchmarkArgs, benchmarkArgs);
+		numOfRunBenchmarks++;
+
+		printf("\n");
+	}
+
+	if (numOfRunBenchmarks == 0)
+	{
+		printf("No benchmark matches \"%s\"\n", filter ? filter : "");
+		return 1;
+	}
+
+	return 0;
+}
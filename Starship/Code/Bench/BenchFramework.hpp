@@ -0,0 +1,21 @@
+#pragma once
+
+// Minimal self-registering benchmark runner, the counterpart of the Tests project. BENCHMARK defines a function that main
+// runs once when its name contains the filter argument; each benchmark times its own phases and prints them.
+typedef void (*BenchmarkFunction)(int argc, char* argv[]);
+
+class BenchmarkRegistrar
+{
+public:
+	BenchmarkRegistrar(char const* name, BenchmarkFunction function);
+};
+
+// Extra command line arguments after the filter are passed through, e.g. model paths
+#define BENCHMARK(name) \
+	static void name(int argc, char* argv[]); \
+	static BenchmarkRegistrar s_##name##Registrar(#name, &name); \
+	static void name(int argc, char* argv[])
+
+// Keeps a computed value alive so the optimizer cannot drop the work that produced it
+void DoNotOptimizeAway(void const* value);
+void DoNotOptimizeAway(int value);
@@ -0,0 +1,112 @@
+#include "Bench/BenchModels.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
+constexpr int BENCH_GRID_SIZE = 1000;
+
+// A flat grid with its own uv and normal per point, drawn as quads, so every corner carries a full v/vt/vn triple. Being
+// flat, the rebuilt per-triangle normals all agree and dedup folds the 6M triangle corners back onto the 1M grid points.
+static bool WriteGridModel(std::string const& fileName)
+{
+	FILE* file = nullptr;
+	fopen_s(&file, fileName.c_str(), "wb");
+
+	if (!file)
+		return false;
+
+	fprintf(file, "# Generated by the Bench project\n");
+
+	for (int y = 0; y < BENCH_GRID_SIZE; y++)
+	{
+		for (int x = 0; x < BENCH_GRID_SIZE; x++)
+		{
+			fprintf(file, "v %.6f %.6f %.6f\n", x * 0.01f, y * 0.01f, 0.0f);
+		}
+	}
+
+	for (int y = 0; y < BENCH_GRID_SIZE; y++)
+	{
+		for (int x = 0; x < BENCH_GRID_SIZE; x++)
+		{
+			fprintf(file, "vt %.6f %.6f\n", (float)x / BENCH_GRID_SIZE, (float)y / BENCH_GRID_SIZE);
+		}
+	}
+
+	for (int pointIndex = 0; pointIndex < BENCH_GRID_SIZE * BENCH_GRID_SIZE; pointIndex++)
+	{
+		fprintf(file, "vn %.6f %.6f %.6f\n", 0.0f, 0.0f, 1.0f);
+	}
+
+	for (int y = 0; y < BENCH_GRID_SIZE - 1; y++)
+	{
+		for (int x = 0; x < BENCH_GRID_SIZE - 1; x++)
+		{
+			int a = y * BENCH_GRID_SIZE + x + 1;
+			int b = a + 1;
+			int c = a + BENCH_GRID_SIZE + 1;
+			int d = a + BENCH_GRID_SIZE;
+
+			fprintf(file, "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n", a, a, a, b, b, b, c, c, c, d, d, d);
+		}
+	}
+
+	fclose(file);
+
+	return true;
+}
+
+std::vector<std::string> GetBenchModelFiles(int argc, char* argv[])
+{
+	std::vector<std::string> fileNames;
+
+	for (int argIndex = 0; argIndex < argc; argIndex++)
+	{
+		fileNames.push_back(argv[argIndex]);
+	}
+
+	if (!fileNames.empty())
+		return fileNames;
+
+	std::error_code error;
+
+	for (std::filesystem::directory_entry const& entry : std::filesystem::directory_iterator("Data/Models", error))
+	{
+		if (entry.is_regular_file() && entry.path().extension() == ".obj")
+		{
+			fileNames.push_back(entry.path().string());
+		}
+	}
+
+	if (!fileNames.empty())
+	{
+		std::sort(fileNames.begin(), fileNames.end());
+		return fileNames;
+	}
+
+	std::string gridFileName = (std::filesystem::temp_directory_path() / "BenchGrid.obj").string();
+
+	if (!std::filesystem::exists(gridFileName))
+	{
+		printf("No models in Data/Models, generating %s\n", gridFileName.c_str());
+
+		if (!WriteGridModel(gridFileName))
+		{
+			printf("Couldn't write %s\n", gridFileName.c_str());
+			return fileNames;
+		}
+	}
+
+	fileNames.push_back(gridFileName);
+
+	return fileNames;
+}
+
+double GetFileSizeMB(std::string const& fileName)
+{
+	std::error_code error;
+	uintmax_t fileSize = std::filesystem::file_size(fileName, error);
+
+	return error ? 0.0 : (double)fileSize / (1024.0 * 1024.0);
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// OBJ files for the loader benchmarks: the paths after the filter on the command line, else every .obj in Data/Models,
+// else a generated grid mesh of about 160MB and 6M triangle corners, written once to the temp folder and reused
+std::vector<std::string> GetBenchModelFiles(int argc, char* argv[]);
+double GetFileSizeMB(std::string const& fileName);
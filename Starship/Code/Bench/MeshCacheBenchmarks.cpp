@@ -0,0 +1,145 @@
+#include "Bench/BenchFramework.hpp"
+#include "Bench/BenchModels.hpp"
+
+#include "Engine/Renderer/MeshCache.hpp"
+#include "Engine/Renderer/ObjLoader.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/Time.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+template <typename T>
+static bool AreBytesEqual(std::vector<T> const& a, std::vector<T> const& b)
+{
+	return a.size() == b.size() && (a.empty() || memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+}
+
+// A cold Load that parses the OBJ and writes the .meshcache next to it, then a warm Load from the cache. The cache is
+// mapped back and compared byte for byte with the parsed mesh, section by section, along with its bounds.
+BENCHMARK(MeshCache_RoundTrip)
+{
+	std::vector<std::string> fileNames = GetBenchModelFiles(argc, argv);
+
+	for (std::string& fileName : fileNames)
+	{
+		std::string cacheFileName = MeshCache::GetCacheFileName(fileName);
+		remove(cacheFileName.c_str());
+
+		std::vector<Vertex_PCUTBN> coldVertices;
+		std::vector<unsigned int> coldIndices;
+		std::vector<ObjMaterial> coldMaterials;
+		std::vector<ObjSubmesh> coldSubmeshes;
+		bool coldHasNormals = false;
+		bool coldHasUVs = false;
+
+		double coldStartTime = GetCurrentTimeSeconds();
+		ObjLoader::Load(fileName, Mat44(), coldVertices, coldIndices, coldMaterials, coldSubmeshes, coldHasNormals, coldHasUVs);
+		double coldSeconds = GetCurrentTimeSeconds() - coldStartTime;
+
+		double warmSeconds = 1e30;
+		std::vector<Vertex_PCUTBN> warmVertices;
+		std::vector<unsigned int> warmIndices;
+		std::vector<ObjSubmesh> warmSubmeshes;
+		bool warmHasNormals = false;
+		bool warmHasUVs = false;
+
+		for (int runIndex = 0; runIndex < 3; runIndex++)
+		{
+			warmVertices.clear();
+			warmIndices.clear();
+			warmSubmeshes.clear();
+			std::vector<ObjMaterial> warmMaterials;
+			warmHasNormals = false;
+			warmHasUVs = false;
+
+			double warmStartTime = GetCurrentTimeSeconds();
+			ObjLoader::Load(fileName, Mat44(), warmVertices, warmIndices, warmMaterials, warmSubmeshes, warmHasNormals, warmHasUVs);
+			warmSeconds = std::min(warmSeconds, GetCurrentTimeSeconds() - warmStartTime);
+		}
+
+		// Load never caches an empty mesh, so there is nothing to round trip
+		if (coldVertices.empty())
+		{
+			printf("%s: empty mesh, not cached\n", fileName.c_str());
+			continue;
+		}
+
+		printf("%s: %d vertices, %d indices, %.1f MB cache\n", fileName.c_str(), (int)coldVertices.size(), (int)coldIndices.size(), GetFileSizeMB(cacheFileName));
+		printf("  Cold load, parse and write: %8.1f ms\n", coldSeconds * 1000.0);
+		printf("  Warm load from cache:       %8.1f ms %6.1fx\n", warmSeconds * 1000.0, coldSeconds / warmSeconds);
+
+		std::vector<Vertex_PCUTBN> readVertices;
+		std::vector<unsigned int> readIndices;
+		std::vector<ObjSubmesh> readSubmeshes;
+		std::vector<std::string> readDependencies;
+		bool readHasNormals = false;
+		bool readHasUVs = false;
+		MeshCacheHeader header;
+
+		MappedFile sourceFile;
+		uint64_t sourceHash = 0;
+
+		if (FileMapReadOnly(sourceFile, fileName))
+		{
+			sourceHash = MeshCache::ComputeSourceHash(sourceFile.m_data, sourceFile.m_size, Mat44());
+			FileUnmap(sourceFile);
+		}
+
+		if (!MeshCache::Read(cacheFileName, sourceHash, readVertices, readIndices, readSubmeshes, readDependencies, readHasNormals, readHasUVs, &header))
+		{
+			printf("  MISMATCH: %s wasn't written or doesn't read back\n", cacheFileName.c_str());
+			continue;
+		}
+
+		bool isVertexMatch = AreBytesEqual(readVertices, coldVertices) && AreBytesEqual(warmVertices, coldVertices);
+		bool isIndexMatch = AreBytesEqual(readIndices, coldIndices) && AreBytesEqual(warmIndices, coldIndices);
+		bool isSubmeshMatch = AreBytesEqual(readSubmeshes, coldSubmeshes) && AreBytesEqual(warmSubmeshes, coldSubmeshes);
+		bool isFlagMatch = readHasNormals == coldHasNormals && readHasUVs == coldHasUVs && warmHasNormals == coldHasNormals && warmHasUVs == coldHasUVs;
+
+		Vec3 mins = coldVertices[0].m_position;
+		Vec3 maxs = coldVertices[0].m_position;
+
+		for (Vertex_PCUTBN const& vertex : coldVertices)
+		{
+			mins = Vec3(std::min(mins.x, vertex.m_position.x), std::min(mins.y, vertex.m_position.y), std::min(mins.z, vertex.m_position.z));
+			maxs = Vec3(std::max(maxs.x, vertex.m_position.x), std::max(maxs.y, vertex.m_position.y), std::max(maxs.z, vertex.m_position.z));
+		}
+
+		bool isBoundsMatch = header.m_boundsMins[0] == mins.x && header.m_boundsMins[1] == mins.y && header.m_boundsMins[2] == mins.z
+			&& header.m_boundsMaxs[0] == maxs.x && header.m_boundsMaxs[1] == maxs.y && header.m_boundsMaxs[2] == maxs.z;
+
+		// The sections are read in place from the mapped file, so compare them there too rather than only through Read
+		bool isMappedMatch = false;
+		MappedFile cacheFile;
+
+		if (FileMapReadOnly(cacheFile, cacheFileName))
+		{
+			MeshCacheSectionInfo const& vertexSection = header.m_sections[MESH_CACHE_SECTION_VERTICES];
+			MeshCacheSectionInfo const& indexSection = header.m_sections[MESH_CACHE_SECTION_INDICES];
+
+			isMappedMatch = true;
+
+			for (MeshCacheSectionInfo const& section : header.m_sections)
+			{
+				isMappedMatch = isMappedMatch && section.m_offset + (uint64_t)section.m_elementSize * section.m_numOfElements <= cacheFile.m_size;
+			}
+
+			isMappedMatch = isMappedMatch && vertexSection.m_numOfElements == coldVertices.size() && indexSection.m_numOfElements == coldIndices.size()
+				&& memcmp(cacheFile.m_data + vertexSection.m_offset, coldVertices.data(), coldVertices.size() * sizeof(Vertex_PCUTBN)) == 0
+				&& (coldIndices.empty() || memcmp(cacheFile.m_data + indexSection.m_offset, coldIndices.data(), coldIndices.size() * sizeof(unsigned int)) == 0);
+
+			FileUnmap(cacheFile);
+		}
+
+		bool isMeshletSectionEmpty = header.m_sections[MESH_CACHE_SECTION_MESHLETS].m_numOfElements == 0
+			&& header.m_sections[MESH_CACHE_SECTION_MESHLET_VERTICES].m_numOfElements == 0
+			&& header.m_sections[MESH_CACHE_SECTION_MESHLET_PRIMITIVES].m_numOfElements == 0;
+
+		printf("  Round trip: vertices %s, indices %s, submeshes %s, flags %s, bounds %s, mapped sections %s, meshlet sections %s\n",
+			isVertexMatch ? "match" : "MISMATCH", isIndexMatch ? "match" : "MISMATCH", isSubmeshMatch ? "match" : "MISMATCH", isFlagMatch ? "match" : "MISMATCH",
+			isBoundsMatch ? "match" : "MISMATCH", isMappedMatch ? "match" : "MISMATCH", isMeshletSectionEmpty ? "empty" : "NOT EMPTY");
+	}
+}
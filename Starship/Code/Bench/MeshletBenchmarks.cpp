@@ -0,0 +1,267 @@
+#include "Bench/BenchFramework.hpp"
+
+#include "Engine/Renderer/Meshlet.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Core/Time.hpp"
+
+#include "ThirdParty/Meshoptimizer/src/meshoptimizer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+
+constexpr int MESHLET_BENCH_NUM_OF_RUNS = 3;
+
+struct MeshletBenchMesh
+{
+	char const*						m_name = "";
+	std::vector<MeshVertex_PCUTBN>	m_vertices;
+	std::vector<uint32_t>			m_indices;
+};
+
+static void OptimizeVertexCache(MeshletBenchMesh& mesh)
+{
+	std::vector<uint32_t> optimizedIndices(mesh.m_indices.size());
+	meshopt_optimizeVertexCache(optimizedIndices.data(), mesh.m_indices.data(), mesh.m_indices.size(), mesh.m_vertices.size());
+	mesh.m_indices.swap(optimizedIndices);
+}
+
+// A slightly bumpy latitude/longitude sphere of 2 * size * size triangles, with its quads in row order
+static MeshletBenchMesh MakeSphereGrid(int size, std::mt19937& rng)
+{
+	MeshletBenchMesh mesh;
+	mesh.m_name = "Sphere grid";
+
+	std::uniform_real_distribution<float> bump(-0.02f, 0.02f);
+
+	for (int y = 0; y <= size; y++)
+	{
+		for (int x = 0; x <= size; x++)
+		{
+			float theta = 3.14159265f * y / size;
+			float phi = 6.28318531f * x / size;
+			float radius = 1.0f + bump(rng);
+
+			MeshVertex_PCUTBN vertex;
+			vertex.m_position = Vec3(radius * sinf(theta) * cosf(phi), radius * sinf(theta) * sinf(phi), radius * cosf(theta));
+			mesh.m_vertices.push_back(vertex);
+		}
+	}
+
+	for (int y = 0; y < size; y++)
+	{
+		for (int x = 0; x < size; x++)
+		{
+			uint32_t a = y * (size + 1) + x;
+			uint32_t b = a + 1;
+			uint32_t c = a + size + 2;
+			uint32_t d = a + size + 1;
+
+			mesh.m_indices.insert(mesh.m_indices.end(), { a, b, c, a, c, d });
+		}
+	}
+
+	OptimizeVertexCache(mesh);
+
+	return mesh;
+}
+
+// A subdivided icosahedron of 20 * 4^numOfSubdivisions triangles in shuffled order, the way an unsorted export arrives
+static MeshletBenchMesh MakeIcosphere(int numOfSubdivisions, std::mt19937& rng)
+{
+	MeshletBenchMesh mesh;
+	mesh.m_name = "Shuffled icosphere";
+
+	float t = (1.0f + sqrtf(5.0f)) * 0.5f;
+
+	std::vector<Vec3> positions =
+	{
+		Vec3(-1, t, 0), Vec3(1, t, 0), Vec3(-1, -t, 0), Vec3(1, -t, 0),
+		Vec3(0, -1, t), Vec3(0, 1, t), Vec3(0, -1, -t), Vec3(0, 1, -t),
+		Vec3(t, 0, -1), Vec3(t, 0, 1), Vec3(-t, 0, -1), Vec3(-t, 0, 1)
+	};
+
+	for (Vec3& position : positions)
+	{
+		position = position.GetNormalized();
+	}
+
+	std::vector<uint32_t> indices =
+	{
+		0, 11, 5,	0, 5, 1,	0, 1, 7,	0, 7, 10,	0, 10, 11,
+		1, 5, 9,	5, 11, 4,	11, 10, 2,	10, 7, 6,	7, 1, 8,
+		3, 9, 4,	3, 4, 2,	3, 2, 6,	3, 6, 8,	3, 8, 9,
+		4, 9, 5,	2, 4, 11,	6, 2, 10,	8, 6, 7,	9, 8, 1
+	};
+
+	for (int level = 0; level < numOfSubdivisions; level++)
+	{
+		std::unordered_map<uint64_t, uint32_t> midpoints;
+
+		auto getMidpoint = [&](uint32_t a, uint32_t b)
+		{
+			uint64_t key = ((uint64_t)std::min(a, b) << 32) | std::max(a, b);
+			auto found = midpoints.find(key);
+
+			if (found != midpoints.end())
+				return found->second;
+
+			positions.push_back(((positions[a] + positions[b]) * 0.5f).GetNormalized());
+			return midpoints[key] = (uint32_t)positions.size() - 1;
+		};
+
+		std::vector<uint32_t> subdividedIndices;
+
+		for (size_t corner = 0; corner < indices.size(); corner += 3)
+		{
+			uint32_t a = indices[corner];
+			uint32_t b = indices[corner + 1];
+			uint32_t c = indices[corner + 2];
+			uint32_t ab = getMidpoint(a, b);
+			uint32_t bc = getMidpoint(b, c);
+			uint32_t ca = getMidpoint(c, a);
+
+			subdividedIndices.insert(subdividedIndices.end(), { a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca });
+		}
+
+		indices.swap(subdividedIndices);
+	}
+
+	std::uniform_real_distribution<float> bump(-0.02f, 0.02f);
+
+	for (Vec3 const& position : positions)
+	{
+		MeshVertex_PCUTBN vertex;
+		vertex.m_position = position * (1.0f + bump(rng));
+		mesh.m_vertices.push_back(vertex);
+	}
+
+	std::vector<uint32_t> triangleOrder(indices.size() / 3);
+
+	for (uint32_t triangle = 0; triangle < (uint32_t)triangleOrder.size(); triangle++)
+	{
+		triangleOrder[triangle] = triangle;
+	}
+
+	std::shuffle(triangleOrder.begin(), triangleOrder.end(), rng);
+
+	for (uint32_t triangle : triangleOrder)
+	{
+		mesh.m_indices.insert(mesh.m_indices.end(), { indices[triangle * 3], indices[triangle * 3 + 1], indices[triangle * 3 + 2] });
+	}
+
+	OptimizeVertexCache(mesh);
+
+	return mesh;
+}
+
+static void PackInIndexOrder(std::vector<uint32_t> const& indices, std::vector<InlineMeshlet>& outMeshlets)
+{
+	outMeshlets.clear();
+	outMeshlets.emplace_back();
+
+	for (size_t corner = 0; corner < indices.size(); corner += 3)
+	{
+		uint32_t tri[3] = { indices[corner], indices[corner + 1], indices[corner + 2] };
+
+		if (!MeshletBuilder::AddToMeshlet(outMeshlets.back(), tri))
+		{
+			outMeshlets.emplace_back();
+			MeshletBuilder::AddToMeshlet(outMeshlets.back(), tri);
+		}
+	}
+}
+
+// Average unique vertices, bounding radius around the box center and normal cone half angle in degrees, per meshlet
+static void PrintMeshletStats(char const* label, double seconds, std::vector<InlineMeshlet> const& meshlets, std::vector<MeshVertex_PCUTBN> const& vertices)
+{
+	double totalVertices = 0.0;
+	double totalRadius = 0.0;
+	double totalConeDegrees = 0.0;
+
+	for (InlineMeshlet const& meshlet : meshlets)
+	{
+		Vec3 mins = vertices[meshlet.m_uniqueVertexIndices[0]].m_position;
+		Vec3 maxs = mins;
+
+		for (uint32_t vertexIndex : meshlet.m_uniqueVertexIndices)
+		{
+			Vec3 const& position = vertices[vertexIndex].m_position;
+			mins = Vec3(std::min(mins.x, position.x), std::min(mins.y, position.y), std::min(mins.z, position.z));
+			maxs = Vec3(std::max(maxs.x, position.x), std::max(maxs.y, position.y), std::max(maxs.z, position.z));
+		}
+
+		Vec3 center = (mins + maxs) * 0.5f;
+		float radiusSq = 0.0f;
+
+		for (uint32_t vertexIndex : meshlet.m_uniqueVertexIndices)
+		{
+			radiusSq = std::max(radiusSq, GetDistanceSquared3D(vertices[vertexIndex].m_position, center));
+		}
+
+		std::vector<Vec3> normals;
+		Vec3 axis;
+
+		for (PackedPrimitive const& primitive : meshlet.m_primitiveIndices)
+		{
+			Vec3 p0 = vertices[primitive.m_i0].m_position;
+			Vec3 normal = CrossProduct3D(vertices[primitive.m_i1].m_position - p0, vertices[primitive.m_i2].m_position - p0).GetNormalized();
+
+			normals.push_back(normal);
+			axis += normal;
+		}
+
+		axis = axis.GetNormalized();
+		float minDot = 1.0f;
+
+		for (Vec3 const& normal : normals)
+		{
+			minDot = std::min(minDot, DotProduct3D(normal, axis));
+		}
+
+		totalVertices += (double)meshlet.m_uniqueVertexIndices.size();
+		totalRadius += sqrtf(radiusSq);
+		totalConeDegrees += ConvertRadiansToDegrees(acosf(GetClamped(minDot, -1.0f, 1.0f)));
+	}
+
+	double numOfMeshlets = (double)std::max((size_t)1, meshlets.size());
+
+	printf("  %-22s %8.1f ms %7d meshlets %6.2f verts %8.5f radius %6.1f deg cone\n", label, seconds * 1000.0, (int)meshlets.size(),
+		totalVertices / numOfMeshlets, totalRadius / numOfMeshlets, totalConeDegrees / numOfMeshlets);
+}
+
+// MeshletBuilder::Meshletize on about a million triangles, next to packing the same vertex cache order as it comes, which is
+// what MeshletTests holds its quality against
+BENCHMARK(Meshlet_Meshletize1MTriangles)
+{
+	std::mt19937 rng(25);
+
+	std::vector<MeshletBenchMesh> meshes;
+	meshes.push_back(MakeSphereGrid(707, rng));
+	meshes.push_back(MakeIcosphere(8, rng));
+
+	for (MeshletBenchMesh const& mesh : meshes)
+	{
+		printf("%s: %d triangles, %d vertices\n", mesh.m_name, (int)mesh.m_indices.size() / 3, (int)mesh.m_vertices.size());
+
+		std::vector<InlineMeshlet> packedMeshlets;
+		std::vector<InlineMeshlet> meshlets;
+		double packSeconds = 1e30;
+		double meshletizeSeconds = 1e30;
+
+		for (int runIndex = 0; runIndex < MESHLET_BENCH_NUM_OF_RUNS; runIndex++)
+		{
+			double packStartTime = GetCurrentTimeSeconds();
+			PackInIndexOrder(mesh.m_indices, packedMeshlets);
+			packSeconds = std::min(packSeconds, GetCurrentTimeSeconds() - packStartTime);
+
+			double meshletizeStartTime = GetCurrentTimeSeconds();
+			MeshletBuilder::Meshletize(meshlets, mesh.m_indices.data(), (uint32_t)mesh.m_indices.size(), mesh.m_vertices, (uint32_t)mesh.m_vertices.size());
+			meshletizeSeconds = std::min(meshletizeSeconds, GetCurrentTimeSeconds() - meshletizeStartTime);
+		}
+
+		PrintMeshletStats("Index order packing:", packSeconds, packedMeshlets, mesh.m_vertices);
+		PrintMeshletStats("Meshletize:", meshletizeSeconds, meshlets, mesh.m_vertices);
+	}
+}
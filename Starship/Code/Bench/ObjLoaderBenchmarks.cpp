@@ -0,0 +1,205 @@
+#include "Bench/BenchFramework.hpp"
+#include "Bench/BenchModels.hpp"
+
+#include "Engine/Renderer/ObjLoader.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/Time.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+constexpr int OBJ_BENCH_NUM_OF_RUNS = 3;
+
+// Single-threaded parse speed, against reading the file to a string and splitting it into lines, which is where the
+// old loader started before it split every line again
+BENCHMARK(ObjLoader_ParseMBPerSecond)
+{
+	std::vector<std::string> fileNames = GetBenchModelFiles(argc, argv);
+
+	JobSystem* previousJobSystem = g_theJobSystem;
+	g_theJobSystem = nullptr;
+
+	for (std::string& fileName : fileNames)
+	{
+		double fileSizeMB = GetFileSizeMB(fileName);
+		double splitSeconds = 1e30;
+		double parseSeconds = 1e30;
+
+		ObjData objData;
+
+		for (int runIndex = 0; runIndex < OBJ_BENCH_NUM_OF_RUNS; runIndex++)
+		{
+			double splitStartTime = GetCurrentTimeSeconds();
+
+			std::string fileText;
+			FileReadToString(fileText, fileName);
+
+			Strings lines;
+			SplitStringOnDelimiter(lines, fileText, "\n");
+			DoNotOptimizeAway((int)lines.size());
+
+			splitSeconds = std::min(splitSeconds, GetCurrentTimeSeconds() - splitStartTime);
+
+			objData = ObjData();
+			double parseStartTime = GetCurrentTimeSeconds();
+
+			ObjLoader::ParseFile(fileName, objData);
+
+			parseSeconds = std::min(parseSeconds, GetCurrentTimeSeconds() - parseStartTime);
+		}
+
+		printf("%s: %.1f MB, %d positions, %d faces, %d corners\n", fileName.c_str(), fileSizeMB, (int)objData.m_positions.size(), (int)objData.m_faces.size(), (int)objData.m_faceVertices.size());
+		printf("  Read and split lines: %8.1f ms %8.1f MB/s\n", splitSeconds * 1000.0, fileSizeMB / splitSeconds);
+		printf("  ParseFile, 1 thread:  %8.1f ms %8.1f MB/s\n", parseSeconds * 1000.0, fileSizeMB / parseSeconds);
+	}
+
+	g_theJobSystem = previousJobSystem;
+}
+
+// ParseFile with JobSystems of growing size, checked against the single-threaded parse
+BENCHMARK(ObjLoader_ParseThreadScaling)
+{
+	std::vector<std::string> fileNames = GetBenchModelFiles(argc, argv);
+
+	int maxNumOfThreads = std::max(2, static_cast<int>(std::thread::hardware_concurrency()));
+	std::vector<int> threadCounts;
+
+	for (int numOfThreads = 1; numOfThreads < maxNumOfThreads; numOfThreads *= 2)
+	{
+		threadCounts.push_back(numOfThreads);
+	}
+
+	threadCounts.push_back(maxNumOfThreads);
+
+	JobSystem* previousJobSystem = g_theJobSystem;
+
+	for (std::string& fileName : fileNames)
+	{
+		double fileSizeMB = GetFileSizeMB(fileName);
+		double singleThreadSeconds = 0.0;
+
+		ObjData serialData;
+
+		printf("%s: %.1f MB\n", fileName.c_str(), fileSizeMB);
+
+		for (int numOfThreads : threadCounts)
+		{
+			JobSystemConfig config;
+			config.m_numOfWorkerThreads = numOfThreads - 1;
+
+			JobSystem jobSystem(config);
+			jobSystem.StartUp();
+			g_theJobSystem = numOfThreads > 1 ? &jobSystem : nullptr;
+
+			double parseSeconds = 1e30;
+			ObjData objData;
+
+			for (int runIndex = 0; runIndex < OBJ_BENCH_NUM_OF_RUNS; runIndex++)
+			{
+				objData = ObjData();
+				double parseStartTime = GetCurrentTimeSeconds();
+
+				ObjLoader::ParseFile(fileName, objData);
+
+				parseSeconds = std::min(parseSeconds, GetCurrentTimeSeconds() - parseStartTime);
+			}
+
+			g_theJobSystem = previousJobSystem;
+			jobSystem.ShutDown();
+
+			if (numOfThreads == 1)
+			{
+				singleThreadSeconds = parseSeconds;
+				serialData = std::move(objData);
+			}
+
+			bool isSameAsSerial = objData.m_positions.size() == serialData.m_positions.size() && objData.m_uvs.size() == serialData.m_uvs.size()
+				&& objData.m_normals.size() == serialData.m_normals.size() && objData.m_faces.size() == serialData.m_faces.size()
+				&& objData.m_faceVertices.size() == serialData.m_faceVertices.size()
+				&& memcmp(objData.m_faceVertices.data(), serialData.m_faceVertices.data(), objData.m_faceVertices.size() * sizeof(Vertex)) == 0;
+
+			printf("  %2d threads: %8.1f ms %8.1f MB/s %5.2fx%s\n", numOfThreads, parseSeconds * 1000.0, fileSizeMB / parseSeconds, singleThreadSeconds / parseSeconds,
+				numOfThreads == 1 || isSameAsSerial ? "" : "  MISMATCH against 1 thread");
+		}
+	}
+}
+
+// GenerateVerticesAndIndices, which builds, triangulates and dedups the vertices, on one and on every thread. For scale, a
+// std::unordered_map with VertexHash over the v/vt/vn triples does only the lookup half of that work.
+BENCHMARK(ObjLoader_DedupVertices)
+{
+	std::vector<std::string> fileNames = GetBenchModelFiles(argc, argv);
+
+	JobSystemConfig config;
+	config.m_numOfWorkerThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+
+	JobSystem jobSystem(config);
+	jobSystem.StartUp();
+
+	JobSystem* previousJobSystem = g_theJobSystem;
+
+	for (std::string& fileName : fileNames)
+	{
+		ObjData objData;
+		ObjLoader::ParseFile(fileName, objData);
+
+		int numOfCorners = (int)objData.m_faceVertices.size();
+
+		double mapSeconds = 1e30;
+		int numOfMapVertices = 0;
+
+		for (int runIndex = 0; runIndex < OBJ_BENCH_NUM_OF_RUNS; runIndex++)
+		{
+			double mapStartTime = GetCurrentTimeSeconds();
+
+			std::unordered_map<Vertex, unsigned int, VertexHash, VertexEqual> vertexIndices;
+			std::vector<unsigned int> cornerIndices(numOfCorners);
+
+			for (int cornerIndex = 0; cornerIndex < numOfCorners; cornerIndex++)
+			{
+				auto inserted = vertexIndices.emplace(objData.m_faceVertices[cornerIndex], (unsigned int)vertexIndices.size());
+				cornerIndices[cornerIndex] = inserted.first->second;
+			}
+
+			mapSeconds = std::min(mapSeconds, GetCurrentTimeSeconds() - mapStartTime);
+			numOfMapVertices = (int)vertexIndices.size();
+		}
+
+		double generateSeconds[2] = { 1e30, 1e30 };
+		std::vector<Vertex_PCUTBN> vertices[2];
+		std::vector<unsigned int> indices[2];
+
+		for (int threadMode = 0; threadMode < 2; threadMode++)
+		{
+			g_theJobSystem = threadMode == 0 ? nullptr : &jobSystem;
+
+			for (int runIndex = 0; runIndex < OBJ_BENCH_NUM_OF_RUNS; runIndex++)
+			{
+				vertices[threadMode].clear();
+				indices[threadMode].clear();
+				std::vector<ObjSubmesh> submeshes;
+
+				double generateStartTime = GetCurrentTimeSeconds();
+
+				ObjLoader::GenerateVerticesAndIndices(objData.m_faces, objData.m_faceVertices, objData.m_positions, objData.m_uvs, objData.m_normals, vertices[threadMode], indices[threadMode], submeshes);
+
+				generateSeconds[threadMode] = std::min(generateSeconds[threadMode], GetCurrentTimeSeconds() - generateStartTime);
+			}
+
+			g_theJobSystem = previousJobSystem;
+		}
+
+		bool isSameAsSerial = vertices[0].size() == vertices[1].size() && indices[0] == indices[1]
+			&& memcmp(vertices[0].data(), vertices[1].data(), vertices[0].size() * sizeof(Vertex_PCUTBN)) == 0;
+
+		printf("%s: %d corners, %d triangle corners, %d unique vertices (%d unique v/vt/vn triples)\n", fileName.c_str(), numOfCorners, (int)indices[0].size(), (int)vertices[0].size(), numOfMapVertices);
+		printf("  unordered_map on triples, 1 thread:  %8.1f ms %6.1f Mcorners/s\n", mapSeconds * 1000.0, numOfCorners / mapSeconds * 1e-6);
+		printf("  GenerateVerticesAndIndices, 1 thread:%8.1f ms %6.1f Mcorners/s\n", generateSeconds[0] * 1000.0, numOfCorners / generateSeconds[0] * 1e-6);
+		printf("  GenerateVerticesAndIndices, %2d threads:%6.1f ms %6.1f Mcorners/s%s\n", config.m_numOfWorkerThreads + 1, generateSeconds[1] * 1000.0, numOfCorners / generateSeconds[1] * 1e-6,
+			isSameAsSerial ? "" : "  MISMATCH against 1 thread");
+	}
+
+	jobSystem.ShutDown();
+}
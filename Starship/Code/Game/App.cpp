@@ -7,6 +7,10 @@
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/Clock.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/NamedStrings.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/FileUtils.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Audio/AudioSystem.hpp"
 #include "Engine/Window/Window.hpp"
@@ -50,10 +54,16 @@ void App::StartUp()
 	renderConfig.m_window = g_theWindow;
 	g_theRenderer = new Renderer(renderConfig);
 
+	JobSystemConfig jobSystemConfig;
+	int numOfCores = static_cast<int>(std::thread::hardware_concurrency());
+	jobSystemConfig.m_numOfWorkerThreads = numOfCores > 1 ? numOfCores - 1 : 1;
+	g_theJobSystem = new JobSystem(jobSystemConfig);
+
 	g_theAudio = new AudioSystem();
 	m_theGame = new Game();
 
 	g_theEventSystem->StartUp();
+	g_theJobSystem->StartUp();
 	g_theConsole->StartUp();
 	g_theInputSystem->StartUp();
 	g_theWindow->StartUp();
@@ -62,6 +72,8 @@ void App::StartUp()
 	m_theGame->StartUp();
 
 	SubscribeEventCallbackFunction("QUIT", App::QuitApp);
+
+	Clock::GetSystemClock().SetFixedTimeStep(SIMULATION_STEP_SECONDS, MAX_SIMULATION_STEPS_PER_FRAME);
 }
 
 void App::Run()
@@ -80,15 +92,104 @@ void App::ShutDown()
 	g_theWindow->ShutDown();
 	g_theInputSystem->ShutDown();
 	g_theConsole->ShutDown();
+	g_theJobSystem->ShutDown();
 	g_theEventSystem->ShutDown();
 
 	DELETE_PTR(m_theGame);
+	DELETE_PTR(g_theJobSystem);
 	DELETE_PTR(g_theRenderer);
 	DELETE_PTR(g_theAudio);
 	DELETE_PTR(g_theWindow);
 	DELETE_PTR(g_theInputSystem);
 }
 
+void App::RunHeadless(std::string const& commandLine)
+{
+	NamedStrings args;
+	Strings tokens = SplitStringOnDelimiter(commandLine, ' ');
+
+	for (std::string token : tokens)
+	{
+		while (!token.empty() && token[0] == '-')
+		{
+			token.erase(0, 1);
+		}
+
+		if (token.empty())
+			continue;
+
+		Strings keyValue = SplitStringOnDelimiter(token, '=');
+		args.SetValue(keyValue[0], keyValue.size() > 1 ? keyValue[1] : "true");
+	}
+
+	int numOfTicks = args.GetValue("ticks", 36000);
+	float ticksPerSecond = args.GetValue("hz", 60.0f);
+	int seed = args.GetValue("seed", 1);
+	std::string reportPath = args.GetValue("report", std::string());
+
+	GUARANTEE_OR_DIE(numOfTicks > 0 && ticksPerSecond > 0.0f, "Headless run needs a positive tick count and rate!");
+
+	float fixedDeltaSeconds = 1.0f / ticksPerSecond;
+
+	m_theGame = new Game(true, static_cast<unsigned int>(seed));
+	m_theGame->StartUp();
+
+	GamePhaseTimings totalTimings;
+	int numOfRestarts = 0;
+
+	auto accumulateTimings = [&totalTimings](GamePhaseTimings const& timings)
+	{
+		totalTimings.m_spawnSeconds += timings.m_spawnSeconds;
+		totalTimings.m_updateSeconds += timings.m_updateSeconds;
+		totalTimings.m_collisionSeconds += timings.m_collisionSeconds;
+		totalTimings.m_garbageSeconds += timings.m_garbageSeconds;
+		totalTimings.m_numOfTicks += timings.m_numOfTicks;
+	};
+
+	double startTime = GetCurrentTimeSeconds();
+
+	for (int tick = 0; tick < numOfTicks; tick++)
+	{
+		m_theGame->Update(fixedDeltaSeconds);
+
+		// Game over drops back to the main menu; start a fresh game so every tick simulates gameplay
+		if (m_theGame->m_isMainMenu)
+		{
+			accumulateTimings(m_theGame->GetPhaseTimings());
+
+			m_theGame->Shutdown();
+			DELETE_PTR(m_theGame);
+			numOfRestarts++;
+			m_theGame = new Game(true, static_cast<unsigned int>(seed + numOfRestarts));
+			m_theGame->StartUp();
+		}
+	}
+
+	double elapsedSeconds = GetCurrentTimeSeconds() - startTime;
+
+	accumulateTimings(m_theGame->GetPhaseTimings());
+
+	m_theGame->Shutdown();
+	DELETE_PTR(m_theGame);
+
+	double milliPerTick = totalTimings.m_numOfTicks > 0 ? 1000.0 / static_cast<double>(totalTimings.m_numOfTicks) : 0.0;
+
+	std::string report = Stringf("Headless run: %d ticks at %.1f Hz, seed %d, %d restarts\n", numOfTicks, ticksPerSecond, seed, numOfRestarts);
+	report += Stringf("Total %.3f s, %.1f ticks/sec\n", elapsedSeconds, static_cast<double>(numOfTicks) / elapsedSeconds);
+	report += Stringf("Spawn     %.3f s (%.4f ms/tick)\n", totalTimings.m_spawnSeconds, totalTimings.m_spawnSeconds * milliPerTick);
+	report += Stringf("Update    %.3f s (%.4f ms/tick)\n", totalTimings.m_updateSeconds, totalTimings.m_updateSeconds * milliPerTick);
+	report += Stringf("Collision %.3f s (%.4f ms/tick)\n", totalTimings.m_collisionSeconds, totalTimings.m_collisionSeconds * milliPerTick);
+	report += Stringf("Garbage   %.3f s (%.4f ms/tick)\n", totalTimings.m_garbageSeconds, totalTimings.m_garbageSeconds * milliPerTick);
+
+	DebuggerPrintf("%s", report.c_str());
+
+	if (!reportPath.empty())
+	{
+		std::vector<unsigned char> reportBuffer(report.begin(), report.end());
+		WriteBufferToFile(reportBuffer, reportPath);
+	}
+}
+
 void App::RunFrame()
 {
 	Clock::TickSystemClock();
@@ -109,10 +210,13 @@ void App::BeginFrame()
 	g_theInputSystem->BeginFrame();
 	g_theRenderer->BeginFrame();
 	g_theAudio->BeginFrame();
+	g_theJobSystem->BeginFrame();
 }
 
 void App::Update(float deltaseconds)
 {
+	Clock& systemClock = Clock::GetSystemClock();
+
 	if (!g_theConsole->IsOpen())
 	{
 		if (g_theInputSystem->WasKeyJustPressed('P'))
@@ -122,17 +226,20 @@ void App::Update(float deltaseconds)
 
 		if (g_theInputSystem->WasKeyJustPressed('O'))
 		{
-			m_theGame->Update(deltaseconds);
+			m_theGame->Update(systemClock.GetFixedStepSeconds());
 			m_isPaused = true;
 		}
 
+		// Slow motion scales the clock, so the simulation still runs whole fixed steps, just fewer of them
 		if (g_theInputSystem->WasKeyJustPressed('T'))
 		{
 			m_isSlowMo = true;
+			systemClock.SetTimeScale(0.1f);
 		}
 		if (g_theInputSystem->WasKeyJustReleased('T'))
 		{
 			m_isSlowMo = false;
+			systemClock.SetTimeScale(1.0f);
 		}
 	}
 
@@ -157,18 +264,21 @@ void App::Update(float deltaseconds)
 		m_theGame->StartUp();
 	}
 
+	m_theGame->UpdateInput(deltaseconds);
+
 	if (m_isPaused && !m_isSlowMo)
 	{
 		m_theGame->Update(0.0f);
 	}
-	else if(!m_isPaused && m_isSlowMo)
+	else if (!m_isPaused)
 	{
-		m_theGame->Update(deltaseconds * 0.1f);
-	}
-	else if(!m_isPaused && !m_isSlowMo)
-	{
-		m_theGame->Update(deltaseconds);
+		for (int step = 0; step < systemClock.GetNumOfFixedSteps(); step++)
+		{
+			m_theGame->Update(systemClock.GetFixedStepSeconds());
+		}
 	}
+
+	m_theGame->UpdateEntityBatch();
 }
 
 void App::Render() const
@@ -189,6 +299,7 @@ void App::Render() const
 
 void App::EndFrame()
 {
+	g_theJobSystem->EndFrame();
 	g_theAudio->EndFrame();
 	g_theRenderer->EndFrame();
 	g_theWindow->EndFrame();
@@ -22,6 +22,10 @@ public:
 	void				Run();
 	void				ShutDown();
 
+	// Runs the simulation alone at a fixed timestep with no window, renderer, audio or input, then reports throughput.
+	// Arguments are space separated key=value pairs: ticks, hz, seed and an optional report file path.
+	void				RunHeadless(std::string const& commandLine);
+
 	bool				IsQuitting() const { return m_isQuitting; }
 	void				HandleKeyPressed(unsigned char keyCode);
 	void				HandleKeyReleased(unsigned char keyCode);
@@ -1,8 +1,6 @@
 #pragma once
 
-#include "Game/Entity.hpp"
-
-#include "Engine/Core/Vertex_PCU.hpp"
+#include "Game/EntityStore.hpp"
 
 constexpr int NUM_OF_BULLET_TRIANGLES = 2;
 constexpr int NUM_OF_BULLET_VERTICES = 3 * NUM_OF_BULLET_TRIANGLES;
@@ -10,21 +8,13 @@ constexpr int NUM_OF_BULLET_VERTICES = 3 * NUM_OF_BULLET_TRIANGLES;
 constexpr int NUM_OF_GLOW_TRIANGLES = 20;
 constexpr int NUM_OF_GLOW_VERTICES = 3 * NUM_OF_GLOW_TRIANGLES;
 
-class VertexBuffer;
-
-class Bullet : public Entity
+class BulletStore : public EntityStore
 {
-	Vertex_PCU		m_vertices[NUM_OF_BULLET_VERTICES] = {};
-	Vertex_PCU		m_glowVertices[NUM_OF_GLOW_VERTICES] = {};
-	VertexBuffer*	m_gpuMesh = nullptr;
 public:
-					Bullet(Game* owner, Vec2 const& startPos, float const& orientation, Rgba8 color);
-					~Bullet();
-
-	void			Initialize();
-	void			RenderGlow() const;
+	explicit		BulletStore(Game* owner);
 
-	virtual void	Update(float deltaseconds) override;
-	virtual void	Render() const override;
-	virtual void	Die() override;
-};
\ No newline at end of file
+	int				Spawn(Vec2 const& position, float orientation, Rgba8 const& color);
+	void			Update(float deltaseconds);
+private:
+	void			InitializeMesh(int index);
+};
@@ -18,7 +18,7 @@ void Entity::Update(float deltaseconds)
 	UNUSED(deltaseconds);
 }
 
-void Entity::Render() const
+void Entity::RenderDebug() const
 {
 }
 
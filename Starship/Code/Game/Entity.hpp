@@ -2,6 +2,9 @@
 
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+
+#include <vector>
 
 class Game;
 
@@ -27,7 +30,10 @@ public:
 	virtual			~Entity();
 
 	virtual void	Update(float deltaseconds) = 0;
-	virtual void	Render() const = 0;
+
+	// World-space verts built during Update; Game gathers every entity into one batch and draws it once
+	virtual void	AddVertsForRender(std::vector<Vertex_PCU>& verts) const = 0;
+	virtual void	RenderDebug() const;
 	virtual void	Die();
 
 	bool			IsOffScreen();
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+#include <vector>
+
+class Game;
+
+// Fixed-capacity free list of pre-created entities. Every entity and its mesh is built once up front;
+// Acquire and Release only move slot indices, so spawning and despawning never touch the heap or the renderer.
+template <typename T>
+class EntityPool
+{
+	std::vector<T*>		m_entities;
+	std::vector<int>	m_freeSlots;
+	int					m_highWaterMark		= 0;
+public:
+	explicit			EntityPool(Game* owner, int capacity);
+						EntityPool(EntityPool const& copy) = delete;
+						~EntityPool();
+
+	// Returns the slot of a free entity, or -1 when the pool is exhausted
+	int					Acquire();
+	void				Release(int slot);
+	T*					Get(int slot) const;
+
+	int					GetCapacity() const;
+	int					GetNumOfActive() const;
+	int					GetHighWaterMark() const;
+};
+
+template <typename T>
+EntityPool<T>::EntityPool(Game* owner, int capacity)
+{
+	m_entities.reserve(capacity);
+	m_freeSlots.reserve(capacity);
+
+	for (int slot = 0; slot < capacity; slot++)
+	{
+		m_entities.push_back(new T(owner, Vec2()));
+	}
+
+	// Hand out low slots first
+	for (int slot = capacity - 1; slot >= 0; slot--)
+	{
+		m_freeSlots.push_back(slot);
+	}
+}
+
+template <typename T>
+EntityPool<T>::~EntityPool()
+{
+	for (T* entity : m_entities)
+	{
+		delete entity;
+	}
+}
+
+template <typename T>
+int EntityPool<T>::Acquire()
+{
+	if (m_freeSlots.empty())
+		return -1;
+
+	int slot = m_freeSlots.back();
+	m_freeSlots.pop_back();
+
+	if (GetNumOfActive() > m_highWaterMark)
+	{
+		m_highWaterMark = GetNumOfActive();
+	}
+
+	return slot;
+}
+
+template <typename T>
+void EntityPool<T>::Release(int slot)
+{
+	GUARANTEE_OR_DIE(slot >= 0 && slot < GetCapacity(), "EntityPool slot out of range!");
+	GUARANTEE_OR_DIE(GetNumOfActive() > 0, "EntityPool released more entities than it handed out!");
+
+	m_freeSlots.push_back(slot);
+}
+
+template <typename T>
+T* EntityPool<T>::Get(int slot) const
+{
+	return m_entities[slot];
+}
+
+template <typename T>
+int EntityPool<T>::GetCapacity() const
+{
+	return static_cast<int>(m_entities.size());
+}
+
+template <typename T>
+int EntityPool<T>::GetNumOfActive() const
+{
+	return GetCapacity() - static_cast<int>(m_freeSlots.size());
+}
+
+template <typename T>
+int EntityPool<T>::GetHighWaterMark() const
+{
+	return m_highWaterMark;
+}
\ No newline at end of file
@@ -0,0 +1,244 @@
+#include "Game/EntityStore.hpp"
+
+#include "Game/GameCommon.hpp"
+#include "Game/Game.hpp"
+#include "Game/Entity.hpp"
+
+#include "Engine/Core/VertexUtils.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Math/MathUtils.hpp"
+
+EntityStore::EntityStore(Game* owner, int capacity, int numOfVertsPerEntity)
+	: m_game(owner), m_capacity(capacity), m_numOfVertsPerEntity(numOfVertsPerEntity)
+{
+	m_positions.reserve(capacity);
+	m_velocities.reserve(capacity);
+	m_orientationDegrees.reserve(capacity);
+	m_angularVelocities.reserve(capacity);
+	m_scales.reserve(capacity);
+	m_speeds.reserve(capacity);
+	m_physicsRadii.reserve(capacity);
+	m_cosmeticRadii.reserve(capacity);
+	m_aliveTimes.reserve(capacity);
+	m_health.reserve(capacity);
+	m_colors.reserve(capacity);
+	m_flags.reserve(capacity);
+
+	m_localVerts.reserve(static_cast<size_t>(capacity) * numOfVertsPerEntity);
+	m_worldVerts.resize(static_cast<size_t>(capacity) * numOfVertsPerEntity);
+}
+
+EntityStore::~EntityStore()
+{
+}
+
+int EntityStore::GetCount() const
+{
+	return m_count;
+}
+
+int EntityStore::GetCapacity() const
+{
+	return m_capacity;
+}
+
+int EntityStore::GetHighWaterMark() const
+{
+	return m_highWaterMark;
+}
+
+bool EntityStore::IsFull() const
+{
+	return m_count >= m_capacity;
+}
+
+bool EntityStore::IsAlive(int index) const
+{
+	return (m_flags[index] & ENTITY_FLAG_DEAD) == 0;
+}
+
+bool EntityStore::IsGarbage(int index) const
+{
+	return (m_flags[index] & ENTITY_FLAG_GARBAGE) != 0;
+}
+
+Vertex_PCU* EntityStore::GetLocalVerts(int index)
+{
+	return &m_localVerts[static_cast<size_t>(index) * m_numOfVertsPerEntity];
+}
+
+int EntityStore::Add(Vec2 const& position, Vec2 const& velocity, float orientationDegrees, float physicsRadius, float cosmeticRadius, int health, Rgba8 const& color)
+{
+	if (IsFull())
+		return -1;
+
+	m_positions.push_back(position);
+	m_velocities.push_back(velocity);
+	m_orientationDegrees.push_back(orientationDegrees);
+	m_angularVelocities.push_back(0.0f);
+	m_scales.push_back(1.0f);
+	m_speeds.push_back(1.0f);
+	m_physicsRadii.push_back(physicsRadius);
+	m_cosmeticRadii.push_back(cosmeticRadius);
+	m_aliveTimes.push_back(0.0f);
+	m_health.push_back(health);
+	m_colors.push_back(color);
+	m_flags.push_back(ENTITY_FLAG_NONE);
+
+	m_localVerts.resize(m_localVerts.size() + m_numOfVertsPerEntity);
+
+	m_count++;
+
+	if (m_count > m_highWaterMark)
+	{
+		m_highWaterMark = m_count;
+	}
+
+	return m_count - 1;
+}
+
+void EntityStore::MarkGarbage(int index)
+{
+	m_flags[index] |= ENTITY_FLAG_DEAD | ENTITY_FLAG_GARBAGE;
+}
+
+void EntityStore::RemoveAt(int index)
+{
+	GUARANTEE_OR_DIE(index >= 0 && index < m_count, "EntityStore index out of range!");
+
+	int lastIndex = m_count - 1;
+
+	if (index != lastIndex)
+	{
+		m_positions[index]			= m_positions[lastIndex];
+		m_velocities[index]			= m_velocities[lastIndex];
+		m_orientationDegrees[index]	= m_orientationDegrees[lastIndex];
+		m_angularVelocities[index]	= m_angularVelocities[lastIndex];
+		m_scales[index]				= m_scales[lastIndex];
+		m_speeds[index]				= m_speeds[lastIndex];
+		m_physicsRadii[index]		= m_physicsRadii[lastIndex];
+		m_cosmeticRadii[index]		= m_cosmeticRadii[lastIndex];
+		m_aliveTimes[index]			= m_aliveTimes[lastIndex];
+		m_health[index]				= m_health[lastIndex];
+		m_colors[index]				= m_colors[lastIndex];
+		m_flags[index]				= m_flags[lastIndex];
+
+		Vertex_PCU const* lastVerts = GetLocalVerts(lastIndex);
+		Vertex_PCU* verts = GetLocalVerts(index);
+
+		for (int vertIndex = 0; vertIndex < m_numOfVertsPerEntity; vertIndex++)
+		{
+			verts[vertIndex] = lastVerts[vertIndex];
+		}
+	}
+
+	m_positions.pop_back();
+	m_velocities.pop_back();
+	m_orientationDegrees.pop_back();
+	m_angularVelocities.pop_back();
+	m_scales.pop_back();
+	m_speeds.pop_back();
+	m_physicsRadii.pop_back();
+	m_cosmeticRadii.pop_back();
+	m_aliveTimes.pop_back();
+	m_health.pop_back();
+	m_colors.pop_back();
+	m_flags.pop_back();
+
+	m_localVerts.resize(m_localVerts.size() - m_numOfVertsPerEntity);
+
+	m_count--;
+}
+
+int EntityStore::RemoveGarbage()
+{
+	int numOfRemoved = 0;
+
+	// Walk backwards so every entity swapped into a hole has already been checked
+	for (int index = m_count - 1; index >= 0; index--)
+	{
+		if (IsGarbage(index))
+		{
+			RemoveAt(index);
+			numOfRemoved++;
+		}
+	}
+
+	return numOfRemoved;
+}
+
+void EntityStore::Clear()
+{
+	while (m_count > 0)
+	{
+		RemoveAt(m_count - 1);
+	}
+
+	m_numOfWorldVerts = 0;
+}
+
+void EntityStore::UpdateWorldVerts(bool useEntityColors)
+{
+	int numOfWorldVerts = 0;
+
+	for (int index = 0; index < m_count; index++)
+	{
+		if (!IsAlive(index))
+			continue;
+
+		Vertex_PCU const* localVerts = GetLocalVerts(index);
+		Vertex_PCU* worldVerts = &m_worldVerts[numOfWorldVerts];
+
+		TransformVertexArrayXY3D(m_numOfVertsPerEntity, localVerts, worldVerts, m_scales[index], m_orientationDegrees[index], m_positions[index]);
+
+		if (useEntityColors)
+		{
+			for (int vertIndex = 0; vertIndex < m_numOfVertsPerEntity; vertIndex++)
+			{
+				worldVerts[vertIndex].m_color = m_colors[index];
+			}
+		}
+
+		numOfWorldVerts += m_numOfVertsPerEntity;
+	}
+
+	m_numOfWorldVerts = numOfWorldVerts;
+}
+
+void EntityStore::AddVertsForRender(std::vector<Vertex_PCU>& verts) const
+{
+	verts.insert(verts.end(), m_worldVerts.begin(), m_worldVerts.begin() + m_numOfWorldVerts);
+}
+
+void EntityStore::RenderDebug() const
+{
+	if (!m_game->IsDeveloperModeOn() || !m_game->GetShip())
+		return;
+
+	Vec2 shipPosition = m_game->GetShip()->GetPosition();
+
+	for (int index = 0; index < m_count; index++)
+	{
+		if (!IsAlive(index))
+			continue;
+
+		Vec2 position = m_positions[index];
+		float orientation = m_orientationDegrees[index];
+		float cosmeticRadius = m_cosmeticRadii[index];
+
+		DrawDebugLine(position, shipPosition, 0.2f, Rgba8(50, 50, 50, 255));
+		DrawDebugLine(position, position + Vec2::MakeFromPolarDegrees(orientation, cosmeticRadius), 0.2f, Rgba8(255, 0, 0, 255));
+		DrawDebugLine(position, position + Vec2::MakeFromPolarDegrees(90.0f + orientation, cosmeticRadius), 0.2f, Rgba8(0, 255, 0, 255));
+		DrawDebugRing(position, cosmeticRadius, orientation, 0.2f, Rgba8(255, 0, 255, 255));
+		DrawDebugRing(position, m_physicsRadii[index], orientation, 0.2f, Rgba8(0, 255, 255, 255));
+
+		if (m_debugHeadingLineScale > 0.0f)
+		{
+			DrawDebugLine(position, position + Vec2::MakeFromPolarDegrees(orientation, m_debugHeadingLineScale * cosmeticRadius), 0.2f, Rgba8(255, 255, 0, 255));
+		}
+		else
+		{
+			DrawDebugLine(position, position + m_debugVelocityLineScale * m_velocities[index], 0.2f, Rgba8(255, 255, 0, 255));
+		}
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+
+#include <vector>
+
+class Game;
+
+enum EntityFlags : unsigned char
+{
+	ENTITY_FLAG_NONE		= 0,
+	ENTITY_FLAG_DEAD		= 1 << 0,
+	ENTITY_FLAG_GARBAGE		= 1 << 1,
+};
+
+// Structure-of-arrays storage for one entity archetype. Every column holds one entry per entity in [0, GetCount()),
+// so update, collision and render passes walk packed memory. RemoveAt swaps the last entity into the hole, so indices
+// are only stable until the next removal.
+class EntityStore
+{
+public:
+	std::vector<Vec2>			m_positions;
+	std::vector<Vec2>			m_velocities;
+	std::vector<float>			m_orientationDegrees;
+	std::vector<float>			m_angularVelocities;
+	std::vector<float>			m_scales;
+	std::vector<float>			m_speeds;
+	std::vector<float>			m_physicsRadii;
+	std::vector<float>			m_cosmeticRadii;
+	std::vector<float>			m_aliveTimes;
+	std::vector<int>			m_health;
+	std::vector<Rgba8>			m_colors;
+	std::vector<unsigned char>	m_flags;
+
+	// Model-space mesh of every entity, m_numOfVertsPerEntity verts each
+	std::vector<Vertex_PCU>		m_localVerts;
+protected:
+	Game*						m_game						= nullptr;
+	int							m_capacity					= 0;
+	int							m_numOfVertsPerEntity		= 0;
+	int							m_count						= 0;
+	int							m_highWaterMark				= 0;
+
+	std::vector<Vertex_PCU>		m_worldVerts;
+	int							m_numOfWorldVerts			= 0;
+
+	// Length of the yellow debug line. It follows the heading instead of the velocity when m_debugHeadingLineScale is positive.
+	float						m_debugVelocityLineScale	= 1.0f;
+	float						m_debugHeadingLineScale		= 0.0f;
+public:
+								EntityStore(Game* owner, int capacity, int numOfVertsPerEntity);
+								EntityStore(EntityStore const& copy) = delete;
+								~EntityStore();
+
+	int							GetCount() const;
+	int							GetCapacity() const;
+	int							GetHighWaterMark() const;
+	bool						IsFull() const;
+	bool						IsAlive(int index) const;
+	bool						IsGarbage(int index) const;
+	Vertex_PCU*					GetLocalVerts(int index);
+
+	int							Add(Vec2 const& position, Vec2 const& velocity, float orientationDegrees, float physicsRadius, float cosmeticRadius, int health, Rgba8 const& color);
+	void						MarkGarbage(int index);
+	void						RemoveAt(int index);
+	int							RemoveGarbage();
+	void						Clear();
+
+	// Transforms every live entity into one world-space vertex stream. Entity colors replace the mesh colors when asked.
+	void						UpdateWorldVerts(bool useEntityColors);
+	void						AddVertsForRender(std::vector<Vertex_PCU>& verts) const;
+	void						RenderDebug() const;
+};
@@ -7,6 +7,7 @@
 #include "Game/TieFighter.hpp"
 #include "Game/TieBomber.hpp"
 #include "Game/Star.hpp"
+#include "Game/EntityPool.hpp"
 #include "Game/GameCommon.hpp"
 
 #include "Engine/Math/RandomNumberGenerator.hpp"
@@ -15,11 +16,28 @@
 #include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Core/SimpleTriangleFont.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Engine/Core/Clock.hpp"
+#include "Engine/Renderer/VertexBuffer.hpp"
 
 Game::Game()
+	: m_rng(static_cast<unsigned int>(GetCurrentTimeSeconds() * 1000.0))
 {
 }
 
+// A headless game skips the attract mode and menus and never touches the renderer, audio or input.
+// Every gameplay roll comes from m_rng, so the same seed replays the same game.
+Game::Game(bool isHeadless, unsigned int seed)
+	: m_rng(seed), m_isHeadless(isHeadless)
+{
+	if (m_isHeadless)
+	{
+		m_isAttractMode = false;
+		m_isMainMenu = false;
+	}
+}
+
 Game::~Game()
 {
 }
@@ -28,13 +46,11 @@ void Game::StartUp()
 {
 	if (m_isAttractMode)
 	{
-		m_attractModeMusic = g_theAudio->CreateOrGetSound("Data/Audio/Star Wars Theme.mp3");
-		m_attractModePlayback = g_theAudio->StartSound(m_attractModeMusic, true, 0.8f);
+		m_attractModePlayback = StartGameSound("Data/Audio/Star Wars Theme.mp3", true, 0.8f);
 	}
 	else if (m_isMainMenu)
 	{
-		m_mainMenuMusic = g_theAudio->CreateOrGetSound("Data/Audio/MainTheme.mp3");
-		m_mainMenuPlayback = g_theAudio->StartSound(m_mainMenuMusic, true);
+		m_mainMenuPlayback = StartGameSound("Data/Audio/MainTheme.mp3", true);
 	}
 
 	m_screenCamera = new Camera();
@@ -43,10 +59,24 @@ void Game::StartUp()
 	m_playerShip = new PlayerShip(this, Vec2(WORLD_CENTER_X, WORLD_CENTER_Y));
 	m_numOfPlayerLives = 3;
 
+	m_asteroids = new AsteroidStore(this);
+	m_bullets = new BulletStore(this);
+	m_debris = new DebrisStore(this);
+	m_fighterPool = new EntityPool<TieFighter>(this, MAX_FIGHTERS);
+	m_bomberPool = new EntityPool<TieBomber>(this, MAX_BOMBERS);
+
+	m_collisionGrid.Initialize(AABB2(0.0f, 0.0f, WORLD_SIZE_X, WORLD_SIZE_Y), COLLISION_CELL_SIZE);
+
+	// The batch grows to the peak vertex count in the first frames of a wave, then stays put
+	if (!m_isHeadless)
+	{
+		m_entityBatchVerts.reserve(MAX_STARS * NUM_OF_STAR_VERTICES);
+		m_entityBatchBuffer = g_theRenderer->CreateVertexBuffer(sizeof(Vertex_PCU) * m_entityBatchVerts.capacity());
+	}
+
 	GenerateStarMap();
 
-	SoundID ambient = g_theAudio->CreateOrGetSound("Data/Audio/Ambient.mp3");
-	g_theAudio->StartSound(ambient, true, 0.3f);
+	StartGameSound("Data/Audio/Ambient.mp3", true, 0.3f);
 }
 
 void Game::Shutdown()
@@ -55,35 +85,25 @@ void Game::Shutdown()
 	DELETE_PTR(m_screenCamera);
 	DELETE_PTR(m_playerShip);
 
-	for (int index = 0; index < MAX_BULLETS; index++)
-	{
-		DELETE_PTR(m_bullets[index])
-	}
+	DebuggerPrintf("Entity high-water marks: asteroids %d/%d, bullets %d/%d, debris %d/%d, fighters %d/%d, bombers %d/%d\n",
+		m_asteroids->GetHighWaterMark(), m_asteroids->GetCapacity(), m_bullets->GetHighWaterMark(), m_bullets->GetCapacity(),
+		m_debris->GetHighWaterMark(), m_debris->GetCapacity(), m_fighterPool->GetHighWaterMark(), m_fighterPool->GetCapacity(),
+		m_bomberPool->GetHighWaterMark(), m_bomberPool->GetCapacity());
 
-	for (int index = 0; index < MAX_ASTEROIDS; index++)
-	{
-		DELETE_PTR(m_asteroids[index])
-	}
+	DELETE_PTR(m_bullets);
+	DELETE_PTR(m_asteroids);
+	DELETE_PTR(m_debris);
 
-	for (int index = 0; index < MAX_DEBRIS; index++)
-	{
-		DELETE_PTR(m_debris[index])
-	}
+	DELETE_PTR(m_entityBatchBuffer);
 
-	for (int index = 0; index < MAX_BOMBERS; index++)
-	{
-		DELETE_PTR(m_tieBombers[index])
-	}
+	// Fighters and bombers are owned by their pools
+	DELETE_PTR(m_fighterPool);
+	DELETE_PTR(m_bomberPool);
 
 	for (int index = 0; index < MAX_STARS; index++)
 	{
 		DELETE_PTR(m_starMap[index])
 	}
-
-	for (int index = 0; index < MAX_FIGHTERS; index++)
-	{
-		DELETE_PTR(m_tieFighters[index])
-	}
 }
 
 void Game::Update(float deltaseconds)
@@ -102,7 +122,7 @@ void Game::Update(float deltaseconds)
 	}
 	else
 	{
-		g_theAudio->StopSound(m_mainMenuPlayback);
+		StopGameSound(m_mainMenuPlayback);
 
 		if (m_numOfPlayerLives < 0 || m_waveMode == 6)
 		{
@@ -119,6 +139,8 @@ void Game::Update(float deltaseconds)
 			m_isMainMenu = true;
 		}
 		
+		double spawnStartTime = GetCurrentTimeSeconds();
+
 		if (!m_isHyperSpace)
 		{
 			SpawnWave();
@@ -128,24 +150,58 @@ void Game::Update(float deltaseconds)
 			UpdateHyperSpace(deltaseconds);
 		}
 
+		double updateStartTime = GetCurrentTimeSeconds();
+
 		UpdateEntities(deltaseconds);
 
+		double collisionStartTime = GetCurrentTimeSeconds();
+
 		CheckCollisionBulletsVsEnemies();
 		CheckCollisionShipVsEnemies();
 		CheckCollisionShipVsBullets();
+
+		double garbageStartTime = GetCurrentTimeSeconds();
+
 		CheckDebrisAliveTime();
 		CheckBulletAliveTime();
 
 		DeleteGarbageEntities();
 
+		double garbageEndTime = GetCurrentTimeSeconds();
+
+		UpdateEntityStoreWorldVerts();
+
+		double worldVertsEndTime = GetCurrentTimeSeconds();
+
+		m_phaseTimings.m_spawnSeconds += updateStartTime - spawnStartTime;
+		m_phaseTimings.m_updateSeconds += (collisionStartTime - updateStartTime) + (worldVertsEndTime - garbageEndTime);
+		m_phaseTimings.m_collisionSeconds += garbageStartTime - collisionStartTime;
+		m_phaseTimings.m_garbageSeconds += garbageEndTime - garbageStartTime;
+		m_phaseTimings.m_numOfTicks++;
+
 		m_screenCamera->SetOrthoView(Vec2(0.0f, 0.0f), Vec2(SCREEN_SIZE_X, SCREEN_SIZE_Y));
 		m_worldCamera->SetOrthoView(Vec2(0.0f, 0.0f), Vec2(WORLD_SIZE_X, WORLD_SIZE_Y));
 
 		UpdateCameraShake(deltaseconds);
 	}
+}
 
+// Input is read once per rendered frame, since a frame can run zero or several fixed simulation steps.
+// Reading it per step would drop or repeat the just-pressed edges.
+void Game::UpdateInput(float deltaseconds)
+{
 	HandleInput();
 	UpdateFromController(deltaseconds);
+
+	if (m_isAttractMode || m_isMainMenu || m_isHyperSpace)
+		return;
+
+	if (m_playerShip && m_playerShip->IsAlive())
+	{
+		PlayerShip* playerShip = static_cast<PlayerShip*>(m_playerShip);
+		playerShip->HandleKeyboardInput();
+		playerShip->UpdateFromController(deltaseconds);
+	}
 }
 
 void Game::Render() const
@@ -173,43 +229,118 @@ void Game::Render() const
 		RenderEntities();
 
 		g_theRenderer->EndCamera(*m_worldCamera);
+
+		if (m_developerMode)
+		{
+			g_theRenderer->BeginCamera(*m_screenCamera, RootSig::DEFAULT_PIPELINE);
+
+			RenderDrawStats();
+
+			g_theRenderer->EndCamera(*m_screenCamera);
+		}
 	}
 }
 
-void Game::RenderEntities() const
+// Every entity shares one render state, so the whole world goes out as a single upload and a single draw.
+// Appending in the old per-entity draw order keeps the same alpha layering. Runs once per rendered frame, after
+// however many simulation steps the frame took.
+void Game::UpdateEntityBatch()
 {
-	RenderStarMap();
+	if (m_isAttractMode || m_isMainMenu)
+		return;
 
-	RenderEntityList(MAX_DEBRIS, (Entity const**)m_debris);
-	RenderEntityList(MAX_ASTEROIDS, (Entity const**)m_asteroids);
-	RenderEntityList(MAX_BOMBERS, (Entity const**)m_tieBombers);
-	RenderEntityList(MAX_FIGHTERS, (Entity const**)m_tieFighters);
+	m_entityBatchVerts.clear();
 
-	if (m_playerShip)
+	AddVertsForEntityList(MAX_STARS, m_starMap);
+
+	m_debris->AddVertsForRender(m_entityBatchVerts);
+	m_asteroids->AddVertsForRender(m_entityBatchVerts);
+	AddVertsForEntityList(MAX_BOMBERS, m_tieBombers);
+	AddVertsForEntityList(MAX_FIGHTERS, m_tieFighters);
+
+	if (m_playerShip && m_playerShip->IsAlive())
 	{
-		if (m_playerShip->IsAlive())
+		m_playerShip->AddVertsForRender(m_entityBatchVerts);
+	}
+
+	m_bullets->AddVertsForRender(m_entityBatchVerts);
+
+	if (!m_entityBatchVerts.empty())
+	{
+		g_theRenderer->CopyCPUToGPU(m_entityBatchVerts.data(), sizeof(Vertex_PCU) * m_entityBatchVerts.size(), m_entityBatchBuffer);
+	}
+}
+
+void Game::AddVertsForEntityList(int numList, Entity* const* entity)
+{
+	for (int index = 0; index < numList; index++)
+	{
+		if (entity[index] && entity[index]->IsAlive())
 		{
-			m_playerShip->Render();
+			entity[index]->AddVertsForRender(m_entityBatchVerts);
 		}
 	}
+}
+
+void Game::RenderEntities() const
+{
+	if (!m_entityBatchVerts.empty())
+	{
+		g_theRenderer->SetModelConstants(RootSig::DEFAULT_PIPELINE);
+		g_theRenderer->SetBlendMode(BlendMode::ALPHA);
+		g_theRenderer->SetDepthMode(DepthMode::ENABLED);
+		g_theRenderer->SetSamplerMode(SamplerMode::POINT_CLAMP);
+		g_theRenderer->BindShader();
+		g_theRenderer->BindTexture();
+		g_theRenderer->DrawVertexBuffer(m_entityBatchBuffer, static_cast<int>(m_entityBatchVerts.size()), sizeof(Vertex_PCU));
+	}
 
-	RenderEntityList(MAX_BULLETS, (Entity const**)m_bullets);
+	if (!m_developerMode)
+		return;
+
+	m_debris->RenderDebug();
+	m_asteroids->RenderDebug();
+	RenderDebugEntityList(MAX_BOMBERS, m_tieBombers);
+	RenderDebugEntityList(MAX_FIGHTERS, m_tieFighters);
+
+	if (m_playerShip && m_playerShip->IsAlive())
+	{
+		m_playerShip->RenderDebug();
+	}
+
+	m_bullets->RenderDebug();
 }
 
-void Game::RenderEntityList(int numList, Entity const** entity) const
+void Game::RenderDebugEntityList(int numList, Entity const* const* entity) const
 {
 	for (int index = 0; index < numList; index++)
 	{
-		if (entity[index])
+		if (entity[index] && entity[index]->IsAlive())
 		{
-			if (entity[index]->IsAlive())
-			{
-				entity[index]->Render();
-			}
+			entity[index]->RenderDebug();
 		}
 	}
 }
 
+// Counts from the last finished frame, since this frame is still being drawn
+void Game::RenderDrawStats() const
+{
+	RenderFrameStats const& stats = g_theRenderer->GetLastFrameStats();
+
+	std::vector<Vertex_PCU> textVerts;
+	AddVertsForTextTriangles2D(textVerts, Stringf("DRAWS: %d", stats.m_numOfDrawCalls), Vec2(10.0f, SCREEN_SIZE_Y - 30.0f), 20.0f, Rgba8(255, 255, 255, 255));
+	AddVertsForTextTriangles2D(textVerts, Stringf("UPLOADED: %.1f KB", static_cast<float>(stats.m_numOfUploadedBytes) / 1024.0f), Vec2(10.0f, SCREEN_SIZE_Y - 55.0f), 20.0f, Rgba8(255, 255, 255, 255));
+
+	Clock const& systemClock = Clock::GetSystemClock();
+	AddVertsForTextTriangles2D(textVerts, Stringf("SIM STEPS: %d", systemClock.GetNumOfFixedSteps()), Vec2(10.0f, SCREEN_SIZE_Y - 80.0f), 20.0f, Rgba8(255, 255, 255, 255));
+	AddVertsForTextTriangles2D(textVerts, Stringf("DROPPED: %.1f MS", systemClock.GetTotalDroppedSeconds() * 1000.0f), Vec2(10.0f, SCREEN_SIZE_Y - 105.0f), 20.0f, Rgba8(255, 255, 255, 255));
+
+	g_theRenderer->SetModelConstants(RootSig::DEFAULT_PIPELINE);
+	g_theRenderer->BindTexture();
+	g_theRenderer->BindShader();
+	g_theRenderer->DrawVertexArray(static_cast<int>(textVerts.size()), textVerts.data());
+}
+
 void Game::RenderAttractMode() const
 {
 	std::vector<Vertex_PCU> textVerts;
@@ -257,14 +388,6 @@ void Game::RenderMainMenu() const
 	g_theRenderer->DrawVertexArray(static_cast<int>(textVerts.size()), textVerts.data());
 }
 
-void Game::RenderStarMap() const
-{
-	for (int index = 0; index < MAX_STARS; index++)
-	{
-		m_starMap[index]->Render();
-	}
-}
-
 void Game::HandleInput()
 {
 	if (m_isAttractMode)
@@ -313,24 +436,21 @@ void Game::HandleInput()
 			m_playerShip = new PlayerShip(this, Vec2(WORLD_CENTER_X, WORLD_CENTER_Y));
 		}
 
-		if (m_numOfBullets == MAX_BULLETS)
+		if (m_bullets->IsFull())
 			ERROR_RECOVERABLE("MAX LIMIT OF BULLETS REACHED!!!");
 
-		if (m_numOfAsteroids == MAX_ASTEROIDS)
+		if (m_asteroids->IsFull())
 			ERROR_RECOVERABLE("MAX LIMIT OF ASTEROIDS REACHED!!!");
 	}
 }
 
 void Game::CheckDebrisAliveTime()
 {
-	for (int index = 0; index < MAX_DEBRIS; index++)
+	for (int index = 0; index < m_debris->GetCount(); index++)
 	{
-		if (m_debris[index])
+		if (m_debris->m_aliveTimes[index] > 1.0f)
 		{
-			if (m_debris[index]->GetAliveTime() > 1.0f)
-			{
-				m_debris[index]->Die();
-			}
+			m_debris->MarkGarbage(index);
 		}
 	}
 }
@@ -338,14 +458,11 @@ void Game::CheckDebrisAliveTime()
 
 void Game::CheckBulletAliveTime()
 {
-	for (int index = 0; index < MAX_BULLETS; index++)
+	for (int index = 0; index < m_bullets->GetCount(); index++)
 	{
-		if (m_bullets[index])
+		if (m_bullets->m_aliveTimes[index] > 2.0f)
 		{
-			if (m_bullets[index]->GetAliveTime() > 2.0f)
-			{
-				m_bullets[index]->Die();
-			}
+			m_bullets->MarkGarbage(index);
 		}
 	}
 }
@@ -361,9 +478,8 @@ void Game::UpdateCameraShake(float deltaseconds)
 	{
 		m_cameraShakeRate -= CAMERA_SHAKE_RATE * deltaseconds;
 
-		RandomNumberGenerator random = RandomNumberGenerator();
-		m_worldCameraOffsetX = random.RollRandomFloatInRange(-m_cameraShakeRate * deltaseconds, m_cameraShakeRate * deltaseconds);
-		m_worldCameraOffsetY = random.RollRandomFloatInRange(-m_cameraShakeRate * deltaseconds, m_cameraShakeRate * deltaseconds);
+		m_worldCameraOffsetX = m_rng.RollRandomFloatInRange(-m_cameraShakeRate * deltaseconds, m_cameraShakeRate * deltaseconds);
+		m_worldCameraOffsetY = m_rng.RollRandomFloatInRange(-m_cameraShakeRate * deltaseconds, m_cameraShakeRate * deltaseconds);
 
 		m_worldCamera->Translate2D(Vec2(m_worldCameraOffsetX, m_worldCameraOffsetY));
 	}
@@ -391,8 +507,6 @@ void Game::GenerateStarMap()
 {
 	for (int index = 0; index < MAX_STARS; index++)
 	{
-		RandomNumberGenerator random = RandomNumberGenerator();
-
 		Rgba8 color;
 		float parallaxEffect = 0.0f;
 
@@ -421,7 +535,7 @@ void Game::GenerateStarMap()
 			parallaxEffect = 0.01f;
 		}
 
-		m_starMap[index] = new Star(this, Vec2(random.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), random.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y)), color, parallaxEffect);
+		m_starMap[index] = new Star(this, Vec2(m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y)), color, parallaxEffect);
 	}
 }
 
@@ -439,9 +553,17 @@ void Game::UpdateEntities(float deltaseconds)
 
 	UpdateEntityList(MAX_FIGHTERS, m_tieFighters, deltaseconds);
 	UpdateEntityList(MAX_BOMBERS, m_tieBombers, deltaseconds);
-	UpdateEntityList(MAX_ASTEROIDS, m_asteroids, deltaseconds);
-	UpdateEntityList(MAX_DEBRIS, m_debris, deltaseconds);
-	UpdateEntityList(MAX_BULLETS, m_bullets, deltaseconds);
+	m_asteroids->Update(deltaseconds);
+	m_debris->Update(deltaseconds);
+	m_bullets->Update(deltaseconds);
+}
+
+// Runs after collisions and garbage removal, so nothing killed this tick is left in the streams Render draws
+void Game::UpdateEntityStoreWorldVerts()
+{
+	m_asteroids->UpdateWorldVerts(false);
+	m_debris->UpdateWorldVerts(true);
+	m_bullets->UpdateWorldVerts(false);
 }
 
 void Game::UpdateEntityList(int numList, Entity** entity, float deltaseconds)
@@ -481,12 +603,11 @@ void Game::UpdateAttractMode(float deltaseconds)
 	if (m_attractModeTimer > 44.5f)
 	{
 		m_isAttractMode = false;
-		g_theAudio->StopSound(m_attractModePlayback);
+		StopGameSound(m_attractModePlayback);
 		m_attractModeTimer = 0.0f;
 
 		m_isMainMenu = true;
-		m_mainMenuMusic = g_theAudio->CreateOrGetSound("Data/Audio/MainTheme.mp3");
-		m_mainMenuPlayback = g_theAudio->StartSound(m_mainMenuMusic, true);
+		m_mainMenuPlayback = StartGameSound("Data/Audio/MainTheme.mp3", true);
 	}
 }
 
@@ -533,36 +654,95 @@ void Game::UpdateFromController(float deltaseconds)
 	}
 }
 
+void Game::CheckCollisionBulletsVsAsteroids()
+{
+	if (m_bullets->GetCount() == 0 || m_asteroids->GetCount() == 0)
+		return;
+
+	m_collisionGrid.Clear();
+
+	for (int j = 0; j < m_asteroids->GetCount(); j++)
+	{
+		if (m_asteroids->IsAlive(j))
+		{
+			m_collisionGrid.Add(j, m_asteroids->m_positions[j], m_asteroids->m_physicsRadii[j]);
+		}
+	}
+
+	m_collisionGrid.Build();
+
+	// Both player and enemy bullets break asteroids
+	for (int i = 0; i < m_bullets->GetCount(); i++)
+	{
+		if (!m_bullets->IsAlive(i))
+			continue;
+
+		// A bullet hits the lowest overlapping index, same as a front-to-back scan would
+		int hitIndex = m_collisionGrid.FindLowestOverlappingId(m_bullets->m_positions[i], BULLET_PHYSICS_RADIUS, [&](int j) { return m_asteroids->IsAlive(j); });
+
+		if (hitIndex < 0)
+			continue;
+
+		if (SpawnDebrisOnBulletCollision(i, m_asteroids->m_positions[hitIndex], m_asteroids->m_cosmeticRadii[hitIndex], m_asteroids->m_health[hitIndex]))
+		{
+			m_asteroids->Die(hitIndex);
+		}
+	}
+}
+
 void Game::CheckCollisionBulletsVsEntity(int numList, Entity** entity)
 {
+	if (m_bullets->GetCount() == 0)
+		return;
+
+	m_collisionGrid.Clear();
 
-	for (int i = 0; i < MAX_BULLETS; i++)
+	for (int j = 0; j < numList; j++)
 	{
-		for (int j = 0; j < numList; j++)
+		if (entity[j] && entity[j]->IsAlive())
 		{
-			if (entity[j] && m_bullets[i])
-			{
-				if (m_bullets[i]->m_color.r == 255 && m_bullets[i]->m_color.b == 0)
-				{
-					if (DoDiscsOverlap(entity[j]->GetPosition(), entity[j]->m_physicsRadius, m_bullets[i]->GetPosition(), BULLET_PHYSICS_RADIUS))
-					{
-						if (m_bullets[i]->IsAlive() && entity[j]->IsAlive())
-						{
-							SpawnDebrisOnBulletCollision(m_bullets[i], entity[j]);
-						}
-					}
-				}
+			m_collisionGrid.Add(j, entity[j]->GetPosition(), entity[j]->m_physicsRadius);
+		}
+	}
 
-				if (m_bullets[i]->m_color.g == 255 && entity[j] == m_asteroids[j])
-				{
-					if (DoDiscsOverlap(entity[j]->GetPosition(), entity[j]->m_physicsRadius, m_bullets[i]->GetPosition(), BULLET_PHYSICS_RADIUS))
-					{
-						if (m_bullets[i]->IsAlive() && entity[j]->IsAlive())
-						{
-							SpawnDebrisOnBulletCollision(m_bullets[i], entity[j]);
-						}
-					}
-				}
+	m_collisionGrid.Build();
+
+	if (m_collisionGrid.GetNumOfEntries() == 0)
+		return;
+
+	for (int i = 0; i < m_bullets->GetCount(); i++)
+	{
+		Rgba8 const& bulletColor = m_bullets->m_colors[i];
+
+		if (bulletColor.r != 255 || bulletColor.b != 0 || !m_bullets->IsAlive(i))
+			continue;
+
+		int hitIndex = m_collisionGrid.FindLowestOverlappingId(m_bullets->m_positions[i], BULLET_PHYSICS_RADIUS, [&](int j) { return entity[j]->IsAlive(); });
+
+		if (hitIndex < 0)
+			continue;
+
+		if (SpawnDebrisOnBulletCollision(i, entity[hitIndex]->GetPosition(), entity[hitIndex]->m_cosmeticRadius, entity[hitIndex]->m_health))
+		{
+			entity[hitIndex]->Die();
+		}
+	}
+}
+
+void Game::CheckCollisionShipVsAsteroids()
+{
+	for (int i = 0; i < m_asteroids->GetCount(); i++)
+	{
+		if (!m_playerShip->IsAlive())
+			return;
+
+		if (m_asteroids->IsAlive(i) && DoDiscsOverlap(m_asteroids->m_positions[i], m_asteroids->m_physicsRadii[i], m_playerShip->GetPosition(), PLAYER_SHIP_PHYSICS_RADIUS))
+		{
+			m_isPlayerShieldActive = true;
+
+			if (SpawnDebrisOnShipCollision(m_asteroids->m_positions[i], m_asteroids->m_cosmeticRadii[i], m_asteroids->m_health[i], m_asteroids->m_colors[i]))
+			{
+				m_asteroids->Die(i);
 			}
 		}
 	}
@@ -577,7 +757,11 @@ void Game::CheckCollisionShipVsEntity(int numList, Entity** entity)
 			if (DoDiscsOverlap(entity[i]->GetPosition(), entity[i]->m_physicsRadius, m_playerShip->GetPosition(), PLAYER_SHIP_PHYSICS_RADIUS))
 			{
 				m_isPlayerShieldActive = true;
-				SpawnDebrisOnShipCollision(entity[i]);
+
+				if (SpawnDebrisOnShipCollision(entity[i]->GetPosition(), entity[i]->m_cosmeticRadius, entity[i]->m_health, entity[i]->m_color))
+				{
+					entity[i]->Die();
+				}
 			}
 		}
 	}
@@ -585,17 +769,20 @@ void Game::CheckCollisionShipVsEntity(int numList, Entity** entity)
 
 void Game::CheckCollisionShipVsBullets()
 {
-	for (int i = 0; i < MAX_BULLETS; i++)
+	if (!m_playerShip)
+		return;
+
+	for (int i = 0; i < m_bullets->GetCount(); i++)
 	{
-		if (m_playerShip && m_bullets[i])
+		if (m_bullets->m_colors[i].g == 255)
 		{
-			if (m_bullets[i]->m_color.g == 255)
+			if (DoDiscsOverlap(m_playerShip->GetPosition(), m_playerShip->m_physicsRadius, m_bullets->m_positions[i], BULLET_PHYSICS_RADIUS))
 			{
-				if (DoDiscsOverlap(m_playerShip->GetPosition(), m_playerShip->m_physicsRadius, m_bullets[i]->GetPosition(), BULLET_PHYSICS_RADIUS))
+				if (m_bullets->IsAlive(i) && m_playerShip->IsAlive())
 				{
-					if (m_bullets[i]->IsAlive() && m_playerShip->IsAlive())
+					if (SpawnDebrisOnBulletCollision(i, m_playerShip->GetPosition(), m_playerShip->m_cosmeticRadius, m_playerShip->m_health))
 					{
-						SpawnDebrisOnBulletCollision(m_bullets[i], m_playerShip);
+						m_playerShip->Die();
 					}
 				}
 			}
@@ -605,21 +792,21 @@ void Game::CheckCollisionShipVsBullets()
 
 void Game::CheckCollisionBulletsVsEnemies()
 {
-	CheckCollisionBulletsVsEntity(MAX_ASTEROIDS, m_asteroids);
+	CheckCollisionBulletsVsAsteroids();
 	CheckCollisionBulletsVsEntity(MAX_FIGHTERS, m_tieFighters);
 	CheckCollisionBulletsVsEntity(MAX_BOMBERS, m_tieBombers);
 }
 
 void Game::CheckCollisionShipVsEnemies()
 {
-	CheckCollisionShipVsEntity(MAX_ASTEROIDS,	m_asteroids);
+	CheckCollisionShipVsAsteroids();
 	CheckCollisionShipVsEntity(MAX_FIGHTERS, m_tieFighters);
 	CheckCollisionShipVsEntity(MAX_BOMBERS, m_tieBombers);
 }
 
 void Game::SpawnWave()
 {
-	if (m_numOfAsteroids + m_numOfBombers + m_numOfFighters == 0)
+	if (m_asteroids->GetCount() + m_numOfBombers + m_numOfFighters == 0)
 	{
 		static int tempWaveMode = 0;
 
@@ -627,11 +814,8 @@ void Game::SpawnWave()
 		{
 			m_isHyperSpace = true;
 
-			SoundID hyperSpeed = g_theAudio->CreateOrGetSound("Data/Audio/HyperSpeed.mp3");
-			g_theAudio->StartSound(hyperSpeed);
-
-			SoundID falcon = g_theAudio->CreateOrGetSound("Data/Audio/Falcon.mp3");
-			g_theAudio->StartSound(falcon, false, 0.5f);
+			StartGameSound("Data/Audio/HyperSpeed.mp3");
+			StartGameSound("Data/Audio/Falcon.mp3", false, 0.5f);
 
 			return;
 		}
@@ -696,51 +880,36 @@ void Game::SpawnWave()
 
 void Game::SpawnBullet(Vec2 const& position, float const& orientation, Rgba8 const& color)
 {
-	for (int index = 0; index < MAX_BULLETS; index++)
-	{
-		if (!m_bullets[index])
-		{
-			m_bullets[index] = new Bullet(this, position, orientation, color);
-			m_numOfBullets++;
-			break;
-		}
-	}
+	m_bullets->Spawn(position, orientation, color);
 }
 
 void Game::SpawnAsteroid(int numOfAsteroids)
 {
-	for (int index = 0; index < numOfAsteroids; index++)
+	for (int index = 0; index < numOfAsteroids && !m_asteroids->IsFull(); index++)
 	{
 		Vec2 position;
 
-		RandomNumberGenerator random = RandomNumberGenerator();
-
-		int edge = random.RollRandomIntInRange(0, 3);
+		int edge = m_rng.RollRandomIntInRange(0, 3);
 
 		if (edge == 0)
 		{
-			position = Vec2(-ASTEROID_COSMETIC_RADIUS, random.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y));
+			position = Vec2(-ASTEROID_COSMETIC_RADIUS, m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y));
 		}
 		else if (edge == 1)
 		{
-			position = Vec2(random.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), WORLD_SIZE_Y + ASTEROID_COSMETIC_RADIUS);
+			position = Vec2(m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), WORLD_SIZE_Y + ASTEROID_COSMETIC_RADIUS);
 		}
 		else if (edge == 2)
 		{
-			position = Vec2(WORLD_SIZE_X + ASTEROID_COSMETIC_RADIUS, random.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y));
+			position = Vec2(WORLD_SIZE_X + ASTEROID_COSMETIC_RADIUS, m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y));
 		}
 		else if (edge == 3)
 		{
-			position = Vec2(random.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), -ASTEROID_COSMETIC_RADIUS);
+			position = Vec2(m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), -ASTEROID_COSMETIC_RADIUS);
 		}
 
-		if (!m_asteroids[index + m_numOfAsteroids])
-		{
-			m_asteroids[index + m_numOfAsteroids] = new Asteroid(this, position);
-		}
+		m_asteroids->Spawn(position);
 	}
-
-	m_numOfAsteroids += numOfAsteroids;
 }
 
 void Game::SpawnFighters(int numOfFigthers)
@@ -749,34 +918,36 @@ void Game::SpawnFighters(int numOfFigthers)
 	{
 		Vec2 position;
 
-		RandomNumberGenerator random = RandomNumberGenerator();
-
-		int edge = random.RollRandomIntInRange(0, 3);
+		int edge = m_rng.RollRandomIntInRange(0, 3);
 
 		if (edge == 0)
 		{
-			position = Vec2(-TIE_FIGHTER_COSMETIC_RADIUS, random.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y));
+			position = Vec2(-TIE_FIGHTER_COSMETIC_RADIUS, m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y));
 		}
 		else if (edge == 1)
 		{
-			position = Vec2(random.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), WORLD_SIZE_Y + TIE_FIGHTER_COSMETIC_RADIUS);
+			position = Vec2(m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), WORLD_SIZE_Y + TIE_FIGHTER_COSMETIC_RADIUS);
 		}
 		else if (edge == 2)
 		{
-			position = Vec2(WORLD_SIZE_X + TIE_FIGHTER_COSMETIC_RADIUS, random.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y));
+			position = Vec2(WORLD_SIZE_X + TIE_FIGHTER_COSMETIC_RADIUS, m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y));
 		}
 		else if (edge == 3)
 		{
-			position = Vec2(random.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), -TIE_FIGHTER_COSMETIC_RADIUS);
+			position = Vec2(m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), -TIE_FIGHTER_COSMETIC_RADIUS);
 		}
 
-		if (!m_tieFighters[index + m_numOfFighters])
-		{
-			m_tieFighters[index + m_numOfFighters] = new TieFighter(this, position);
-		}
-	}
+		int slot = m_fighterPool->Acquire();
+
+		if (slot < 0)
+			return;
+
+		TieFighter* fighter = m_fighterPool->Get(slot);
+		fighter->Spawn(position);
 
-	m_numOfFighters += numOfFigthers;
+		m_tieFighters[slot] = fighter;
+		m_numOfFighters++;
+	}
 }
 
 bool Game::IsHyperSpace() const
@@ -790,37 +961,40 @@ void Game::SpawnBombers(int numOfBombers)
 	{
 		Vec2 position;
 
-		RandomNumberGenerator random = RandomNumberGenerator();
-
-		int edge = random.RollRandomIntInRange(0, 3);
+		int edge = m_rng.RollRandomIntInRange(0, 3);
 
 		if (edge == 0)
 		{
-			position = Vec2(-TIE_BOMBER_COSMETIC_RADIUS, random.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y));
+			position = Vec2(-TIE_BOMBER_COSMETIC_RADIUS, m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y));
 		}
 		else if (edge == 1)
 		{
-			position = Vec2(random.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), WORLD_SIZE_Y + TIE_BOMBER_COSMETIC_RADIUS);
+			position = Vec2(m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), WORLD_SIZE_Y + TIE_BOMBER_COSMETIC_RADIUS);
 		}
 		else if (edge == 2)
 		{
-			position = Vec2(WORLD_SIZE_X + TIE_BOMBER_COSMETIC_RADIUS, random.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y));
+			position = Vec2(WORLD_SIZE_X + TIE_BOMBER_COSMETIC_RADIUS, m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_Y));
 		}
 		else if (edge == 3)
 		{
-			position = Vec2(random.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), -TIE_BOMBER_COSMETIC_RADIUS);
+			position = Vec2(m_rng.RollRandomFloatInRange(0.0f, WORLD_SIZE_X), -TIE_BOMBER_COSMETIC_RADIUS);
 		}
 
-		if (!m_tieBombers[index + m_numOfBombers])
-		{
-			m_tieBombers[index + m_numOfBombers] = new TieBomber(this, position);
-		}
-	}
+		int slot = m_bomberPool->Acquire();
 
-	m_numOfBombers += numOfBombers;
+		if (slot < 0)
+			return;
+
+		TieBomber* bomber = m_bomberPool->Get(slot);
+		bomber->Spawn(position);
+
+		m_tieBombers[slot] = bomber;
+		m_numOfBombers++;
+	}
 }
 
-void Game::SpawnDebrisOnShipCollision(Entity* other)
+// Returns true when the collision destroys the other entity; the caller kills it
+bool Game::SpawnDebrisOnShipCollision(Vec2 const& otherPosition, float otherCosmeticRadius, int& otherHealth, Rgba8 const& otherColor)
 {
 	m_playerShip->m_health--;
 	m_isCameraShake = true;
@@ -831,81 +1005,71 @@ void Game::SpawnDebrisOnShipCollision(Entity* other)
 		m_numOfPlayerLives--;
 	}
 
-	Vec2 normal = m_playerShip->GetPosition() - other->GetPosition();
-	RandomNumberGenerator random = RandomNumberGenerator();
+	Vec2 normal = m_playerShip->GetPosition() - otherPosition;
 
-	if (other->m_health > 1)
+	if (otherHealth > 1)
 	{
-		SoundID testSound = g_theAudio->CreateOrGetSound("Data/Audio/Asteroid_Explosion.wav");
-		g_theAudio->StartSound(testSound);
+		StartGameSound("Data/Audio/Asteroid_Explosion.wav");
 
-		other->m_health--;
-		SpawnDebris(random.RollRandomIntInRange(1, 3), Vec2((other->GetPosition().x + (other->m_cosmeticRadius * CosDegrees(normal.GetOrientationDegrees()))), (other->GetPosition().y + (other->m_cosmeticRadius * SinDegrees(normal.GetOrientationDegrees())))), Vec2(0.0f, 0.0f), random.RollRandomFloatInRange(0.2f, 0.8f), other->m_color);
-		return;
-	}
-	else
-	{
-		other->Die();
-		m_isCameraShake = true;
+		otherHealth--;
+		SpawnDebris(m_rng.RollRandomIntInRange(1, 3), otherPosition + Vec2::MakeFromPolarDegrees(normal.GetOrientationDegrees(), otherCosmeticRadius), Vec2(0.0f, 0.0f), m_rng.RollRandomFloatInRange(0.2f, 0.8f), otherColor);
+		return false;
 	}
+
+	m_isCameraShake = true;
+	return true;
 }
 
-void Game::SpawnDebrisOnBulletCollision(Entity* bullet, Entity* other)
+// Returns true when the hit destroys the other entity; the caller kills it
+bool Game::SpawnDebrisOnBulletCollision(int bulletIndex, Vec2 const& otherPosition, float otherCosmeticRadius, int& otherHealth)
 {
-	bullet->Die();
-	Vec2 normal = bullet->GetPosition() - other->GetPosition();
-	RandomNumberGenerator random = RandomNumberGenerator();
+	m_bullets->MarkGarbage(bulletIndex);
 
-	if (other->m_health > 1)
-	{
-		SoundID testSound = g_theAudio->CreateOrGetSound("Data/Audio/Hit.wav");
-		g_theAudio->StartSound(testSound);
+	Vec2 normal = m_bullets->m_positions[bulletIndex] - otherPosition;
 
-		other->m_health--;
-		SpawnDebris(random.RollRandomIntInRange(1, 3), Vec2((other->GetPosition().x + (other->m_cosmeticRadius * CosDegrees(normal.GetOrientationDegrees()))),
-			(other->GetPosition().y + (other->m_cosmeticRadius * SinDegrees(normal.GetOrientationDegrees())))), Vec2(0.0f, 0.0f), 0.2f, bullet->m_color);
-	}
-	else
+	if (otherHealth > 1)
 	{
-		other->Die();
-		m_isCameraShake = true;
+		StartGameSound("Data/Audio/Hit.wav");
+
+		otherHealth--;
+		SpawnDebris(m_rng.RollRandomIntInRange(1, 3), otherPosition + Vec2::MakeFromPolarDegrees(normal.GetOrientationDegrees(), otherCosmeticRadius), Vec2(0.0f, 0.0f), 0.2f, m_bullets->m_colors[bulletIndex]);
+		return false;
 	}
+
+	m_isCameraShake = true;
+	return true;
 }
 
 void Game::SpawnDebris(int numOfDebris, Vec2 const& position, Vec2 const& velocity, float const& scale, Rgba8 const& color)
 {
-	for (int index = 0; index < numOfDebris; index++)
+	for (int index = 0; index < numOfDebris && !m_debris->IsFull(); index++)
 	{
-		if (!m_debris[index + m_numOfDebris])
-		{
-			m_debris[index + m_numOfDebris] = new Debris(this, position, velocity, scale, color);
-		}
+		m_debris->Spawn(position, velocity, scale, color);
 	}
-	m_numOfDebris += numOfDebris;
 }
 
-void Game::DeleteGarbageEntityList(int numList, Entity** entity, int& currentTotal)
+// The list shares slot indices with the pool, so entity[slot] is either null or pool->Get(slot)
+template <typename T>
+void Game::ReleaseGarbageEntityList(Entity** entity, EntityPool<T>* pool, int& currentTotal)
 {
-	for (int index = 0; index < numList; index++)
+	for (int slot = 0; slot < pool->GetCapacity(); slot++)
 	{
-		if (entity[index])
+		if (entity[slot] && entity[slot]->IsGarbage())
 		{
-			if (entity[index]->IsGarbage())
-			{
-				DELETE_PTR(entity[index])
-					currentTotal--;
-			}
+			entity[slot] = nullptr;
+			pool->Release(slot);
+			currentTotal--;
 		}
 	}
 }
 
 void Game::DeleteGarbageEntities()
 {
-	DeleteGarbageEntityList(MAX_ASTEROIDS,	m_asteroids,	m_numOfAsteroids);
-	DeleteGarbageEntityList(MAX_FIGHTERS,	m_tieFighters,	m_numOfFighters);
-	DeleteGarbageEntityList(MAX_BOMBERS,	m_tieBombers,	m_numOfBombers);
-	DeleteGarbageEntityList(MAX_BULLETS,	m_bullets,		m_numOfBullets);
-	DeleteGarbageEntityList(MAX_DEBRIS,		m_debris,		m_numOfDebris);
+	m_asteroids->RemoveGarbage();
+	ReleaseGarbageEntityList(m_tieFighters,	m_fighterPool,	m_numOfFighters);
+	ReleaseGarbageEntityList(m_tieBombers,	m_bomberPool,	m_numOfBombers);
+	m_bullets->RemoveGarbage();
+	m_debris->RemoveGarbage();
 }
 
 bool Game::IsDeveloperModeOn() const
@@ -913,6 +1077,38 @@ bool Game::IsDeveloperModeOn() const
 	return m_developerMode;
 }
 
+bool Game::IsHeadless() const
+{
+	return m_isHeadless;
+}
+
+SoundPlaybackID Game::StartGameSound(char const* soundFilePath, bool isLooped, float volume)
+{
+	if (m_isHeadless)
+		return MISSING_SOUND_ID;
+
+	SoundID sound = g_theAudio->CreateOrGetSound(soundFilePath);
+	return g_theAudio->StartSound(sound, isLooped, volume);
+}
+
+void Game::StopGameSound(SoundPlaybackID playbackID)
+{
+	if (m_isHeadless)
+		return;
+
+	g_theAudio->StopSound(playbackID);
+}
+
+GamePhaseTimings const& Game::GetPhaseTimings() const
+{
+	return m_phaseTimings;
+}
+
+void Game::ResetPhaseTimings()
+{
+	m_phaseTimings = GamePhaseTimings();
+}
+
 Entity* Game::GetShip() const
 {
 	return m_playerShip;
@@ -1,34 +1,60 @@
 #pragma once
 
 #include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/SpatialHashGrid.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Renderer/Camera.hpp"
 
 #include "Game/GameCommon.hpp"
 
 class Entity;
+class VertexBuffer;
+class AsteroidStore;
+class BulletStore;
+class DebrisStore;
+class TieFighter;
+class TieBomber;
+
+template <typename T>
+class EntityPool;
+
+// Wall-clock seconds spent in each simulation phase, accumulated across updates until reset
+struct GamePhaseTimings
+{
+	double				m_spawnSeconds					= 0.0;
+	double				m_updateSeconds					= 0.0;
+	double				m_collisionSeconds				= 0.0;
+	double				m_garbageSeconds				= 0.0;
+	int					m_numOfTicks					= 0;
+};
 
 class Game
 {
 public:
 	Entity*				m_playerShip					= nullptr;
-	Entity*				m_asteroids[MAX_ASTEROIDS]		= { nullptr };
+	AsteroidStore*		m_asteroids						= nullptr;
 	Entity*				m_tieFighters[MAX_FIGHTERS]		= { nullptr };
 	Entity*				m_tieBombers[MAX_BOMBERS]		= { nullptr };
-	Entity*				m_bullets[MAX_BULLETS]			= { nullptr };
-	Entity*				m_debris[MAX_DEBRIS]			= { nullptr };
+	BulletStore*		m_bullets						= nullptr;
+	DebrisStore*		m_debris						= nullptr;
+	EntityPool<TieFighter>*	m_fighterPool				= nullptr;
+	EntityPool<TieBomber>*	m_bomberPool				= nullptr;
 	Entity*				m_starMap[MAX_STARS]			= {	nullptr	};
 	Camera*				m_worldCamera					= nullptr;
 	Camera*				m_screenCamera					= nullptr;
 
+	SpatialHashGrid		m_collisionGrid;
+	RandomNumberGenerator	m_rng;
+
+	std::vector<Vertex_PCU>	m_entityBatchVerts;
+	VertexBuffer*		m_entityBatchBuffer				= nullptr;
+
 	Vec2				m_attractModeOffset				= Vec2(0.0f, 34.0f);
 	Vec2				m_attractModePosition			= Vec2(550.0f, 400.0f);
 	Vec2				m_mainMenuPosition				= Vec2(500.0f, 400.0f);
 
-	SoundID				m_attractModeMusic;
-	SoundPlaybackID		m_attractModePlayback;
-
-	SoundID				m_mainMenuMusic;
-	SoundPlaybackID		m_mainMenuPlayback;
+	SoundPlaybackID		m_attractModePlayback			= MISSING_SOUND_ID;
+	SoundPlaybackID		m_mainMenuPlayback				= MISSING_SOUND_ID;
 
 	unsigned char		m_attractModeAlpha				= 0;
 	unsigned char		m_playButtonAlpha				= 0;
@@ -38,12 +64,9 @@ public:
 	float				m_gameEndTimer					= 2.0f;
 	float				m_worldCameraOffsetX			= 0.0f;
 	float				m_worldCameraOffsetY			= 0.0f;
-	int					m_numOfBullets					= 0;
 	int					m_numOfPlayerLives				= 0;
-	int					m_numOfAsteroids				= 0;
 	int					m_numOfFighters					= 0;
 	int					m_numOfBombers					= 0;
-	int					m_numOfDebris					= 0;
 	bool				m_developerMode					= false;
 	bool				m_isAttractMode					= true;
 	bool				m_isMainMenu					= false;
@@ -53,8 +76,11 @@ public:
 	float				m_cameraShakeTimer				= 0.0f;
 	float				m_hyperSpaceTimer				= 0.0f;
 	float				m_cameraShakeRate				= 40.0f;
+	bool				m_isHeadless					= false;
+	GamePhaseTimings	m_phaseTimings;
 public:
 						Game();
+	explicit			Game(bool isHeadless, unsigned int seed);
 						~Game();
 
 	void				StartUp();
@@ -63,10 +89,13 @@ public:
 	void				Update(float deltaseconds);
 	void				Render() const ;
 
+	void				UpdateInput(float deltaseconds);
 	void				HandleInput();
 	void				CheckCollisionBulletsVsEnemies();
 	void				CheckCollisionShipVsEnemies();
+	void				CheckCollisionBulletsVsAsteroids();
 	void				CheckCollisionBulletsVsEntity(int numList, Entity** entity);
+	void				CheckCollisionShipVsAsteroids();
 	void				CheckCollisionShipVsEntity(int numList, Entity** entity);
 	void				CheckCollisionShipVsBullets();
 	void				CheckBulletAliveTime();
@@ -76,14 +105,17 @@ public:
 	void				GenerateStarMap();
 	void				UpdateFromController(float deltaseconds);
 	void				UpdateEntities(float deltaseconds);
+	void				UpdateEntityStoreWorldVerts();
 	void				UpdateEntityList(int numList, Entity** entity, float deltaseconds);
 	void				UpdateStarMap(float deltaseconds);
 	void				UpdateAttractMode(float deltaseconds);
 	void				UpdateMainMenu(float deltaseconds);
+	void				UpdateEntityBatch();
+	void				AddVertsForEntityList(int numList, Entity* const* entity);
 
 	void				RenderEntities() const;
-	void				RenderEntityList(int numList, Entity const** entity) const;
-	void				RenderStarMap() const;
+	void				RenderDebugEntityList(int numList, Entity const* const* entity) const;
+	void				RenderDrawStats() const;
 	void				RenderAttractMode() const;
 	void				RenderMainMenu() const;
 
@@ -93,14 +125,23 @@ public:
 	void				SpawnFighters(int numOfFigthers);
 	void				SpawnBombers(int numOfBombers);
 	void				SpawnDebris(int numOfDebris, Vec2 const& position, Vec2 const& velocity, float const& scale, Rgba8 const& color);
-	void				SpawnDebrisOnShipCollision(Entity* other);
-	void				SpawnDebrisOnBulletCollision(Entity* bullet, Entity* other);
+	bool				SpawnDebrisOnShipCollision(Vec2 const& otherPosition, float otherCosmeticRadius, int& otherHealth, Rgba8 const& otherColor);
+	bool				SpawnDebrisOnBulletCollision(int bulletIndex, Vec2 const& otherPosition, float otherCosmeticRadius, int& otherHealth);
 
 	void				DeleteGarbageEntities();
-	void				DeleteGarbageEntityList(int numList, Entity** entity, int& currentTotal);
+	template <typename T>
+	void				ReleaseGarbageEntityList(Entity** entity, EntityPool<T>* pool, int& currentTotal);
+
+	// Audio goes through these so a headless game never touches g_theAudio
+	SoundPlaybackID		StartGameSound(char const* soundFilePath, bool isLooped = false, float volume = 1.0f);
+	void				StopGameSound(SoundPlaybackID playbackID);
 
 	bool				IsHyperSpace() const;
 	bool				IsDeveloperModeOn() const;
+	bool				IsHeadless() const;
+
+	GamePhaseTimings const&	GetPhaseTimings() const;
+	void				ResetPhaseTimings();
 
 	Entity*				GetShip() const;
 };
\ No newline at end of file
@@ -23,6 +23,8 @@ constexpr int			MAX_DEBRIS							= 1000;
 constexpr int			MAX_FIGHTERS						= 50;
 constexpr int			MAX_BOMBERS							= 50;
 constexpr int			MAX_STARS							= 500;
+constexpr float			SIMULATION_STEP_SECONDS				= 1.0f / 60.0f;
+constexpr int			MAX_SIMULATION_STEPS_PER_FRAME		= 5;
 constexpr float			SCREEN_SIZE_X						= 1600.0f;
 constexpr float			SCREEN_SIZE_Y						= 800.0f;
 constexpr float			WORLD_SIZE_X						= 300.0f;
@@ -33,6 +35,7 @@ constexpr float			DEBRIS_SPEED						= 15.0f;
 constexpr float			DEBRIS_PHYSICS_RADIUS				= 0.1f;
 constexpr float			DEBRIS_COSMETIC_RADIUS				= 2.0f;
 constexpr float			CAMERA_SHAKE_RATE					= 15.0f;
+constexpr float			COLLISION_CELL_SIZE					= 10.0f;
 constexpr float			ASTEROID_SPEED						= 10.0f;
 constexpr float			ASTEROID_PHYSICS_RADIUS				= 5.6f;
 constexpr float			ASTEROID_COSMETIC_RADIUS			= 5.0f;
@@ -2,6 +2,8 @@
 #include <windows.h>
 #include "Game/App.hpp"
 
+#include <string>
+
 #define UNUSED(x) (void)(x);
 
 extern App* g_theApp;
@@ -11,13 +13,23 @@ int WINAPI WinMain( _In_ HINSTANCE applicationInstanceHandle, _In_opt_ HINSTANCE
 {
 	UNUSED(applicationInstanceHandle);
 	UNUSED(previousInstance);
-	UNUSED(commandLineString);
 	UNUSED(nShowCmd);
 
+	std::string commandLine = commandLineString;
+
 	g_theApp = new App();
-	g_theApp->StartUp();
-	g_theApp->Run();
-	g_theApp->ShutDown();
+
+	if (commandLine.find("-headless") != std::string::npos)
+	{
+		g_theApp->RunHeadless(commandLine);
+	}
+	else
+	{
+		g_theApp->StartUp();
+		g_theApp->Run();
+		g_theApp->ShutDown();
+	}
+
 	delete g_theApp;
 	g_theApp = nullptr;
 	
@@ -7,7 +7,6 @@
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Renderer/Renderer.hpp"
-#include "Engine/Renderer/VertexBuffer.hpp"
 
 #include "Game/Game.hpp"
 #include "Game/GameCommon.hpp"
@@ -23,16 +22,13 @@ PlayerShip::PlayerShip(Game* owner, Vec2 const& startPos)
 	m_health = 100;
 	m_color = Rgba8(189, 195, 199, 255);
 
-	m_gpuBodyMesh = g_theRenderer->CreateVertexBuffer(sizeof(Vertex_PCU) * (NUM_OF_MAIN_BODY_VERTICES + NUM_OF_COCKPIT_VERTICES + NUM_OF_FRONT_VERTICES + NUM_OF_SHIP_WEAPON_VERTICES));
-	m_gpuThrusterMesh = g_theRenderer->CreateVertexBuffer(sizeof(Vertex_PCU) * 300);
+	m_worldVerts.reserve(NUM_OF_SHIP_WORLD_VERTICES);
 
 	Initialize();
 }
 
 PlayerShip::~PlayerShip()
 {
-	DELETE_PTR(m_gpuBodyMesh);
-	DELETE_PTR(m_gpuThrusterMesh);
 }
 
 void PlayerShip::Initialize()
@@ -139,8 +135,7 @@ void PlayerShip::HandleKeyboardInput()
 	{
 		if (g_theInputSystem->WasKeyJustPressed(KEYCODE_SPACE))
 		{
-			SoundID testSound = g_theAudio->CreateOrGetSound("Data/Audio/Player_Laser.wav");
-			g_theAudio->StartSound(testSound);
+			m_game->StartGameSound("Data/Audio/Player_Laser.wav");
 
 			m_game->SpawnBullet(m_position, m_orientationDegrees, Rgba8(255, 0, 0, 255));
 		}
@@ -220,22 +215,42 @@ void PlayerShip::UpdateFromController(float deltaseconds)
 
 	if (controller.WasButtonJustPressed(XboxButtonID::BUTTON_A))
 	{
-		SoundID testSound = g_theAudio->CreateOrGetSound("Data/Audio/Player_Laser.wav");
-		g_theAudio->StartSound(testSound);
+		m_game->StartGameSound("Data/Audio/Player_Laser.wav");
 
 		m_game->SpawnBullet(m_position, m_orientationDegrees, Rgba8(255, 0, 0, 255));
 	}
 }
 
+// Stands in for the player in headless runs: circles at half thrust and fires on a fixed period, so the
+// bullet and collision paths see the same load on every run
+void PlayerShip::UpdateAutopilot(float deltaseconds)
+{
+	m_isShipThrusting = true;
+	m_thrustFraction = 0.5f;
+	m_isTurningLeft = true;
+
+	m_autopilotFireTimer += deltaseconds;
+
+	while (m_autopilotFireTimer >= AUTOPILOT_FIRE_INTERVAL)
+	{
+		m_autopilotFireTimer -= AUTOPILOT_FIRE_INTERVAL;
+		m_game->SpawnBullet(m_position, m_orientationDegrees, Rgba8(255, 0, 0, 255));
+	}
+}
+
 void PlayerShip::Update(float deltaseconds)
 {
 	UpdateThruster(deltaseconds);
 
 	if (!m_game->IsHyperSpace())
 	{
-		HandleKeyboardInput();
+		// Player input arrives once per frame through Game::UpdateInput
+		if (m_game->IsHeadless())
+		{
+			UpdateAutopilot(deltaseconds);
+		}
+
 		BounceOffWalls();
-		UpdateFromController(deltaseconds);
 
 		if (m_isShipThrusting)
 		{
@@ -251,57 +266,21 @@ void PlayerShip::Update(float deltaseconds)
 
 		m_position += m_velocity * deltaseconds;
 
-		std::vector<Vertex_PCU> verts;
-
-		Vertex_PCU shipVerts[NUM_OF_VERTICES];
-
-		for (int index = 0; index < NUM_OF_VERTICES; index++)
-		{
-			shipVerts[index] = m_bodyVertices[index];
-		}
-
-		TransformVertexArrayXY3D(NUM_OF_VERTICES, shipVerts, 3.0f * m_scale, m_orientationDegrees, m_position);
-
-		for (int index = 0; index < NUM_OF_VERTICES; index++)
-		{
-			verts.push_back(shipVerts[index]);
-		}
-
-		Vertex_PCU cockpitVerts[NUM_OF_COCKPIT_VERTICES];
+		// Reused every frame so the ship never reallocates its vertex stream
+		m_worldVerts.resize(NUM_OF_SHIP_WORLD_VERTICES);
 
-		for (int index = 0; index < NUM_OF_COCKPIT_VERTICES; index++)
-		{
-			cockpitVerts[index] = m_cockpitVertices[index];
-		}
-
-		TransformVertexArrayXY3D(NUM_OF_COCKPIT_VERTICES, cockpitVerts, 1.0f * m_scale, m_orientationDegrees, m_position);
-
-		for (int index = 0; index < NUM_OF_COCKPIT_VERTICES; index++)
-		{
-			verts.push_back(cockpitVerts[index]);
-		}
-
-		Vertex_PCU weaponVerts[NUM_OF_SHIP_WEAPON_VERTICES];
-
-		for (int index = 0; index < NUM_OF_SHIP_WEAPON_VERTICES; index++)
-		{
-			weaponVerts[index] = m_weaponVertices[index];
-		}
+		Vertex_PCU* shipVerts = m_worldVerts.data();
+		Vertex_PCU* cockpitVerts = shipVerts + NUM_OF_VERTICES;
+		Vertex_PCU* weaponVerts = cockpitVerts + NUM_OF_COCKPIT_VERTICES;
 
-		TransformVertexArrayXY3D(NUM_OF_SHIP_WEAPON_VERTICES, weaponVerts, 1.0f * m_scale, m_orientationDegrees, m_position);
-
-		for (int index = 0; index < NUM_OF_SHIP_WEAPON_VERTICES; index++)
-		{
-			verts.push_back(weaponVerts[index]);
-		}
-
-		g_theRenderer->CopyCPUToGPU(verts.data(), sizeof(Vertex_PCU) * (NUM_OF_MAIN_BODY_VERTICES + NUM_OF_COCKPIT_VERTICES + NUM_OF_FRONT_VERTICES + NUM_OF_SHIP_WEAPON_VERTICES), m_gpuBodyMesh);
+		TransformVertexArrayXY3D(NUM_OF_VERTICES, m_bodyVertices, shipVerts, 3.0f * m_scale, m_orientationDegrees, m_position);
+		TransformVertexArrayXY3D(NUM_OF_COCKPIT_VERTICES, m_cockpitVertices, cockpitVerts, 1.0f * m_scale, m_orientationDegrees, m_position);
+		TransformVertexArrayXY3D(NUM_OF_SHIP_WEAPON_VERTICES, m_weaponVertices, weaponVerts, 1.0f * m_scale, m_orientationDegrees, m_position);
 
 		if (m_isShipThrusting)
 		{
 			float thetaDegrees = 360.0f / 50.0f;
 
-			Vertex_PCU vertices[300];
 
 			for (int index = 0; index < 12; index++)
 			{
@@ -313,24 +292,21 @@ void PlayerShip::Update(float deltaseconds)
 				Vec2 vert3 = Vec2((2.0f + m_thrustPower) * CosDegrees(theta1) + 0.2f, (2.0f + m_thrustPower) * SinDegrees(theta1) + 0.2f);
 				Vec2 vert4 = Vec2((2.0f + m_thrustPower) * CosDegrees(theta2) + 0.2f, (2.0f + m_thrustPower) * SinDegrees(theta2) + 0.2f);
 
-				vertices[6 * index] = Vertex_PCU(vert1.x, vert1.y,     0, 255, 255, 127);
-				vertices[6 * index + 1] = Vertex_PCU(vert3.x, vert3.y, 0, 255, 255, 0);
-				vertices[6 * index + 2] = Vertex_PCU(vert4.x, vert4.y, 0, 255, 255, 0);
-				vertices[6 * index + 3] = Vertex_PCU(vert4.x, vert4.y, 0, 255, 255, 0);
-				vertices[6 * index + 4] = Vertex_PCU(vert2.x, vert2.y, 0, 255, 255, 127);
-				vertices[6 * index + 5] = Vertex_PCU(vert1.x, vert1.y, 0, 255, 255, 127);
+				m_thrusterVerts[6 * index] = Vertex_PCU(vert1.x, vert1.y,     0, 255, 255, 127);
+				m_thrusterVerts[6 * index + 1] = Vertex_PCU(vert3.x, vert3.y, 0, 255, 255, 0);
+				m_thrusterVerts[6 * index + 2] = Vertex_PCU(vert4.x, vert4.y, 0, 255, 255, 0);
+				m_thrusterVerts[6 * index + 3] = Vertex_PCU(vert4.x, vert4.y, 0, 255, 255, 0);
+				m_thrusterVerts[6 * index + 4] = Vertex_PCU(vert2.x, vert2.y, 0, 255, 255, 127);
+				m_thrusterVerts[6 * index + 5] = Vertex_PCU(vert1.x, vert1.y, 0, 255, 255, 127);
 			}
 
-			TransformVertexArrayXY3D(300, vertices, 1.0f, m_orientationDegrees + 135.0f, m_position);
-
-			g_theRenderer->CopyCPUToGPU(&vertices, sizeof(Vertex_PCU) * 300, m_gpuThrusterMesh);
+			TransformVertexArrayXY3D(NUM_OF_THRUSTER_VERTICES, m_thrusterVerts, 1.0f, m_orientationDegrees + 135.0f, m_position);
 		}
 	}
 	else
 	{
 		float thetaDegrees = 360.0f / 50.0f;
 
-		Vertex_PCU vertices[300];
 
 		for (int index = 0; index < 12; index++)
 		{
@@ -342,17 +318,15 @@ void PlayerShip::Update(float deltaseconds)
 			Vec2 vert3 = Vec2((2.0f + m_thrustPower) * CosDegrees(theta1) + 0.2f, (2.0f + m_thrustPower) * SinDegrees(theta1) + 0.2f);
 			Vec2 vert4 = Vec2((2.0f + m_thrustPower) * CosDegrees(theta2) + 0.2f, (2.0f + m_thrustPower) * SinDegrees(theta2) + 0.2f);
 
-			vertices[6 * index] = Vertex_PCU(vert1.x, vert1.y,     0, 255, 255, 127);
-			vertices[6 * index + 1] = Vertex_PCU(vert3.x, vert3.y, 0, 255, 255, 0);
-			vertices[6 * index + 2] = Vertex_PCU(vert4.x, vert4.y, 0, 255, 255, 0);
-			vertices[6 * index + 3] = Vertex_PCU(vert4.x, vert4.y, 0, 255, 255, 0);
-			vertices[6 * index + 4] = Vertex_PCU(vert2.x, vert2.y, 0, 255, 255, 127);
-			vertices[6 * index + 5] = Vertex_PCU(vert1.x, vert1.y, 0, 255, 255, 127);
+			m_thrusterVerts[6 * index] = Vertex_PCU(vert1.x, vert1.y,     0, 255, 255, 127);
+			m_thrusterVerts[6 * index + 1] = Vertex_PCU(vert3.x, vert3.y, 0, 255, 255, 0);
+			m_thrusterVerts[6 * index + 2] = Vertex_PCU(vert4.x, vert4.y, 0, 255, 255, 0);
+			m_thrusterVerts[6 * index + 3] = Vertex_PCU(vert4.x, vert4.y, 0, 255, 255, 0);
+			m_thrusterVerts[6 * index + 4] = Vertex_PCU(vert2.x, vert2.y, 0, 255, 255, 127);
+			m_thrusterVerts[6 * index + 5] = Vertex_PCU(vert1.x, vert1.y, 0, 255, 255, 127);
 		}
 
-		TransformVertexArrayXY3D(300, vertices, 1.0f, m_orientationDegrees + 135.0f, m_position);
-
-		g_theRenderer->CopyCPUToGPU(&vertices, sizeof(Vertex_PCU) * 300, m_gpuThrusterMesh);
+		TransformVertexArrayXY3D(NUM_OF_THRUSTER_VERTICES, m_thrusterVerts, 1.0f, m_orientationDegrees + 135.0f, m_position);
 	}
 }
 
@@ -381,36 +355,23 @@ void PlayerShip::RenderCockpit() const
 	//g_theRenderer->DrawVertexArray(NUM_OF_COCKPIT_VERTICES, shipVerts);
 }
 
-void PlayerShip::Render() const
+void PlayerShip::AddVertsForRender(std::vector<Vertex_PCU>& verts) const
 {
 	/*if (m_game->m_isPlayerShieldActive)
 	{
 		RenderShield();
 	}*/
 
-	//RenderBody();
-	//RenderCockpit();
-	//RenderWeapons();
-
-	g_theRenderer->SetModelConstants(RootSig::DEFAULT_PIPELINE);
-	g_theRenderer->SetBlendMode(BlendMode::ALPHA);
-	g_theRenderer->SetDepthMode(DepthMode::ENABLED);
-	g_theRenderer->SetSamplerMode(SamplerMode::POINT_CLAMP);
-	g_theRenderer->BindShader();
-	g_theRenderer->BindTexture();
-	g_theRenderer->DrawVertexBuffer(m_gpuBodyMesh, (NUM_OF_MAIN_BODY_VERTICES + NUM_OF_COCKPIT_VERTICES + NUM_OF_FRONT_VERTICES + NUM_OF_SHIP_WEAPON_VERTICES), sizeof(Vertex_PCU));
+	verts.insert(verts.end(), m_worldVerts.begin(), m_worldVerts.end());
 
 	if (m_isShipThrusting || m_game->IsHyperSpace())
 	{
-		g_theRenderer->SetModelConstants(RootSig::DEFAULT_PIPELINE);
-		g_theRenderer->SetBlendMode(BlendMode::ALPHA);
-		g_theRenderer->SetDepthMode(DepthMode::ENABLED);
-		g_theRenderer->SetSamplerMode(SamplerMode::POINT_CLAMP);
-		g_theRenderer->BindShader();
-		g_theRenderer->BindTexture();
-		g_theRenderer->DrawVertexBuffer(m_gpuThrusterMesh, 300, sizeof(Vertex_PCU));
+		verts.insert(verts.end(), m_thrusterVerts, m_thrusterVerts + NUM_OF_THRUSTER_VERTICES);
 	}
+}
 
+void PlayerShip::RenderDebug() const
+{
 	if (m_game->IsDeveloperModeOn())
 	{
 		DrawDebugLine(m_position, Vec2((m_position.x + (m_cosmeticRadius * CosDegrees(m_orientationDegrees))), (m_position.y + (m_cosmeticRadius * SinDegrees(m_orientationDegrees)))), 0.2f, Rgba8(255, 0, 0, 255));
@@ -430,11 +391,10 @@ void PlayerShip::RenderThrusts() const
 
 void PlayerShip::Die()
 {
-	SoundID testSound = g_theAudio->CreateOrGetSound("Data/Audio/Player_Explosion.mp3");
-	g_theAudio->StartSound(testSound);
+	m_game->StartGameSound("Data/Audio/Player_Explosion.mp3");
 
 	m_isDead = true;
 	m_isGarbage = false;
-	RandomNumberGenerator random = RandomNumberGenerator();
+	RandomNumberGenerator& random = m_game->m_rng;
 	m_game->SpawnDebris(random.RollRandomIntInRange(5, 30), m_position, m_velocity * 0.1f, random.RollRandomFloatInRange(0.2f, 0.8f), m_color);
 }
@@ -4,6 +4,8 @@
 
 #include "Engine/Core/Vertex_PCU.hpp"
 
+#include <vector>
+
 constexpr int NUM_OF_MAIN_BODY_TRIANGLES = 20;
 constexpr int NUM_OF_MAIN_BODY_VERTICES = 3 * NUM_OF_MAIN_BODY_TRIANGLES;
 
@@ -17,21 +19,26 @@ constexpr int NUM_OF_SHIP_WEAPON_TRIANGLES = 4 + 6;
 constexpr int NUM_OF_SHIP_WEAPON_VERTICES = 3 * NUM_OF_SHIP_WEAPON_TRIANGLES;
 
 constexpr int NUM_OF_VERTICES = NUM_OF_MAIN_BODY_VERTICES + NUM_OF_FRONT_VERTICES;
+constexpr int NUM_OF_SHIP_WORLD_VERTICES = NUM_OF_VERTICES + NUM_OF_COCKPIT_VERTICES + NUM_OF_SHIP_WEAPON_VERTICES;
+
+constexpr int NUM_OF_THRUSTER_TRIANGLES = 2 * 12;
+constexpr int NUM_OF_THRUSTER_VERTICES = 3 * NUM_OF_THRUSTER_TRIANGLES;
 
-class VertexBuffer;
+constexpr float AUTOPILOT_FIRE_INTERVAL = 0.2f;
 
 class PlayerShip : public Entity
 {
 	Vertex_PCU			m_bodyVertices[NUM_OF_VERTICES]						= {};
 	Vertex_PCU			m_cockpitVertices[NUM_OF_COCKPIT_VERTICES]			= {};
 	Vertex_PCU			m_weaponVertices[NUM_OF_SHIP_WEAPON_VERTICES]		= {};
-	VertexBuffer*		m_gpuBodyMesh										= nullptr;
-	VertexBuffer*		m_gpuThrusterMesh									= nullptr;
+	Vertex_PCU			m_thrusterVerts[NUM_OF_THRUSTER_VERTICES]			= {};
+	std::vector<Vertex_PCU>	m_worldVerts;
 	bool				m_isShipThrusting									= false;
 	bool				m_isTurningLeft										= false;
 	bool				m_isTurningRight									= false;
 	float				m_thrustFraction									= 1.0f;
 	float				m_thrustPower										= 2.0f;
+	float				m_autopilotFireTimer								= 0.0f;
 public:
 						PlayerShip(Game* owner, Vec2 const& startPos);
 						~PlayerShip();
@@ -41,6 +48,7 @@ public:
 	void				HandleKeyboardInput();
 	void				UpdateThruster(float deltaseconds);
 	void				UpdateFromController(float deltaseconds);
+	void				UpdateAutopilot(float deltaseconds);
 
 	void				RenderBody() const;
 	void				RenderShield() const;
@@ -49,6 +57,7 @@ public:
 	void				RenderThrusts() const;
 
 	virtual void		Update(float deltaseconds) override;
-	virtual void		Render() const override;
+	virtual void		AddVertsForRender(std::vector<Vertex_PCU>& verts) const override;
+	virtual void		RenderDebug() const override;
 	virtual void		Die() override;
 };
\ No newline at end of file
@@ -4,7 +4,6 @@
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Renderer/Renderer.hpp"
-#include "Engine/Renderer/VertexBuffer.hpp"
 
 #include "Game/GameCommon.hpp"
 #include "Game/Game.hpp"
@@ -20,31 +19,34 @@ Star::Star(Game* owner, Vec2 const& startPos, Rgba8 const& color, float const& d
 	m_color = color;
 	m_distanceFromScreen = distanceFromPlayer;
 
-	m_gpuMesh = g_theRenderer->CreateVertexBuffer(sizeof(Vertex_PCU) * NUM_OF_STAR_VERTICES);
-	m_gpuHyperSpaceMesh = g_theRenderer->CreateVertexBuffer(sizeof(Vertex_PCU) * 4);
-
 	Initialize();
 }
 
 Star::~Star()
 {
-	DELETE_PTR(m_gpuMesh);
-	DELETE_PTR(m_gpuHyperSpaceMesh);
 }
 
 void Star::Initialize()
 {
 	float thetaDegrees = 360.0f / (float)NUM_OF_STAR_TRIANGLES;
 
+	float rimDegrees[NUM_OF_STAR_TRIANGLES + 1];
+	float rimSines[NUM_OF_STAR_TRIANGLES + 1];
+	float rimCosines[NUM_OF_STAR_TRIANGLES + 1];
+
+	for (int rimIndex = 0; rimIndex <= NUM_OF_STAR_TRIANGLES; rimIndex++)
+	{
+		rimDegrees[rimIndex] = rimIndex * thetaDegrees;
+	}
+
+	FastSinCosDegrees(rimDegrees, rimSines, rimCosines, NUM_OF_STAR_TRIANGLES + 1);
+
 	for (int index = 0; index < NUM_OF_STAR_TRIANGLES; index++)
 	{
 		float radius = 1.0f;
 
-		float theta1 = index * thetaDegrees;
-		float theta2 = (index + 1) * thetaDegrees;
-
-		Vec2 vert1 = Vec2(radius * CosDegrees(theta1), radius * SinDegrees(theta1));
-		Vec2 vert2 = Vec2(radius * CosDegrees(theta2), radius * SinDegrees(theta2));
+		Vec2 vert1 = Vec2(radius * rimCosines[index], radius * rimSines[index]);
+		Vec2 vert2 = Vec2(radius * rimCosines[index + 1], radius * rimSines[index + 1]);
 
 		m_vertices[3 * index] = Vertex_PCU(0.0f, 0.0f, m_color.r, m_color.g, m_color.b, m_color.a);
 		m_vertices[3 * index + 1] = Vertex_PCU(vert1.x, vert1.y, m_color.r, m_color.g, m_color.b, m_color.a);
@@ -87,11 +89,9 @@ void Star::Update(float deltaseconds)
 		m_velocity = -1.0f * m_distanceFromScreen * STAR_SPEED * m_stretchSpeed * m_game->GetShip()->GetForwardNormal();
 		m_position += m_velocity * deltaseconds;
 
-		std::vector<Vertex_PCU> verts;
+		m_hyperSpaceVerts.clear();
 
-		AddVertsForLineSegment2D(verts, m_position, Vec2(m_position.x - (m_spaceStretch * m_game->GetShip()->GetForwardNormal().x), m_position.y - (m_spaceStretch * m_game->GetShip()->GetForwardNormal().y)), 0.25f, m_color);
-
-		g_theRenderer->CopyCPUToGPU(verts.data(), sizeof(Vertex_PCU) * 4, m_gpuHyperSpaceMesh);
+		AddVertsForLineSegment2D(m_hyperSpaceVerts, m_position, Vec2(m_position.x - (m_spaceStretch * m_game->GetShip()->GetForwardNormal().x), m_position.y - (m_spaceStretch * m_game->GetShip()->GetForwardNormal().y)), 0.25f, m_color);
 	}
 	else
 	{
@@ -99,40 +99,19 @@ void Star::Update(float deltaseconds)
 		m_position += m_velocity * deltaseconds;
 		m_spaceStretch = 0.0f;
 
-		Vertex_PCU tempVerts[NUM_OF_STAR_VERTICES];
-
-		for (int index = 0; index < NUM_OF_STAR_VERTICES; index++)
-		{
-			tempVerts[index] = m_vertices[index];
-		}
-
-		TransformVertexArrayXY3D(NUM_OF_STAR_VERTICES, tempVerts, 0.125f, m_orientationDegrees, m_position);
-
-		g_theRenderer->CopyCPUToGPU(&tempVerts, sizeof(Vertex_PCU) * NUM_OF_STAR_VERTICES, m_gpuMesh);
+		TransformVertexArrayXY3D(NUM_OF_STAR_VERTICES, m_vertices, m_worldVerts, 0.125f, m_orientationDegrees, m_position);
 	}
 }
 
-void Star::Render() const
+void Star::AddVertsForRender(std::vector<Vertex_PCU>& verts) const
 {
 	if (!m_game->IsHyperSpace())
 	{
-		g_theRenderer->SetModelConstants(RootSig::DEFAULT_PIPELINE);
-		g_theRenderer->SetBlendMode(BlendMode::ALPHA);
-		g_theRenderer->SetDepthMode(DepthMode::ENABLED);
-		g_theRenderer->SetSamplerMode(SamplerMode::POINT_CLAMP);
-		g_theRenderer->BindShader();
-		g_theRenderer->BindTexture();
-		g_theRenderer->DrawVertexBuffer(m_gpuMesh, NUM_OF_STAR_VERTICES, sizeof(Vertex_PCU));
+		verts.insert(verts.end(), m_worldVerts, m_worldVerts + NUM_OF_STAR_VERTICES);
 	}
 	else
 	{
-		g_theRenderer->SetModelConstants(RootSig::DEFAULT_PIPELINE);
-		g_theRenderer->SetBlendMode(BlendMode::ALPHA);
-		g_theRenderer->SetDepthMode(DepthMode::ENABLED);
-		g_theRenderer->SetSamplerMode(SamplerMode::POINT_CLAMP);
-		g_theRenderer->BindShader();
-		g_theRenderer->BindTexture();
-		g_theRenderer->DrawVertexBuffer(m_gpuHyperSpaceMesh, 4, sizeof(Vertex_PCU));
+		verts.insert(verts.end(), m_hyperSpaceVerts.begin(), m_hyperSpaceVerts.end());
 
 		//DrawDebugLine(m_position, Vec2(m_position.x - (m_spaceStretch * m_game->GetShip()->GetForwardNormal().x), m_position.y - (m_spaceStretch * m_game->GetShip()->GetForwardNormal().y)), 0.25f, m_color);
 	}
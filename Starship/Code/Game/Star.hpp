@@ -4,16 +4,16 @@
 
 #include "Engine/Core/Vertex_PCU.hpp"
 
+#include <vector>
+
 constexpr int NUM_OF_STAR_TRIANGLES = 10;
 constexpr int NUM_OF_STAR_VERTICES = 3 * NUM_OF_STAR_TRIANGLES;
 
-class VertexBuffer;
-
 class Star : public Entity
 {
 	Vertex_PCU		m_vertices[NUM_OF_STAR_VERTICES]	= {};
-	VertexBuffer*	m_gpuMesh							= nullptr;
-	VertexBuffer*	m_gpuHyperSpaceMesh					= nullptr;
+	Vertex_PCU		m_worldVerts[NUM_OF_STAR_VERTICES]	= {};
+	std::vector<Vertex_PCU>	m_hyperSpaceVerts;
 	float			m_distanceFromScreen				= 0.0f;
 	float			m_spaceStretch						= 0.0f;
 	float			m_stretchSpeed						= 100.0f;
@@ -24,6 +24,6 @@ public:
 	void			Initialize();
 
 	virtual void	Update(float deltaseconds) override;
-	virtual void	Render() const override;
+	virtual void	AddVertsForRender(std::vector<Vertex_PCU>& verts) const override;
 	virtual void	Die() override;
 };
\ No newline at end of file
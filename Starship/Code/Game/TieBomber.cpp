@@ -8,24 +8,20 @@
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Renderer/Renderer.hpp"
-#include "Engine/Renderer/VertexBuffer.hpp"
 
 TieBomber::TieBomber(Game* owner, Vec2 const& position)
 	: Entity(owner, position)
 {
 	m_physicsRadius = TIE_BOMBER_PHYSICS_RADIUS;
 	m_cosmeticRadius = TIE_BOMBER_COSMETIC_RADIUS;
-	m_health = 10;
 	m_color = Rgba8(128, 128, 128, 255);
 
-	m_gpuMesh = g_theRenderer->CreateVertexBuffer(sizeof(Vertex_PCU) * (NUM_BOMBER_VERTS + NUM_OF_TIE_B_WEAPON_VERTICES));
-
 	Initialize();
+	Spawn(position);
 }
 
 TieBomber::~TieBomber()
 {
-	DELETE_PTR(m_gpuMesh);
 }
 
 void TieBomber::Initialize()
@@ -147,16 +143,23 @@ void TieBomber::Initialize()
 	m_weaponVertices[71] = Vertex_PCU(0.25f, -0.25f, 255, 0, 0, 255);
 }
 
+// Resets the gameplay state so a pooled bomber can be reused; the local mesh verts are kept
+void TieBomber::Spawn(Vec2 const& position)
+{
+	m_position = position;
+	m_velocity = Vec2();
+	m_orientationDegrees = 0.0f;
+	m_health = 10;
+	m_isDead = false;
+	m_isGarbage = false;
+	m_aliveTime = 0.0f;
+	m_lastShipPosition = Vec2();
+}
+
 void TieBomber::RenderBody() const
 {
 	Vertex_PCU tempVerts[NUM_BOMBER_VERTS];
-
-	for (int index = 0; index < NUM_BOMBER_VERTS; index++)
-	{
-		tempVerts[index] = m_bodyVertices[index];
-	}
-
-	TransformVertexArrayXY3D(NUM_BOMBER_VERTS, tempVerts, 1.0f * m_scale, m_orientationDegrees, m_position);
+	TransformVertexArrayXY3D(NUM_BOMBER_VERTS, m_bodyVertices, tempVerts, 1.0f * m_scale, m_orientationDegrees, m_position);
 
 	g_theRenderer->BindTexture();
 	g_theRenderer->DrawVertexArray(NUM_BOMBER_VERTS, tempVerts);
@@ -165,13 +168,7 @@ void TieBomber::RenderBody() const
 void TieBomber::RenderWeapons() const
 {
 	Vertex_PCU tempVerts[NUM_OF_TIE_B_WEAPON_VERTICES];
-
-	for (int index = 0; index < NUM_OF_TIE_B_WEAPON_VERTICES; index++)
-	{
-		tempVerts[index] = m_weaponVertices[index];
-	}
-
-	TransformVertexArrayXY3D(NUM_OF_TIE_B_WEAPON_VERTICES, tempVerts, 1.0f * m_scale, m_orientationDegrees, m_position);
+	TransformVertexArrayXY3D(NUM_OF_TIE_B_WEAPON_VERTICES, m_weaponVertices, tempVerts, 1.0f * m_scale, m_orientationDegrees, m_position);
 
 	g_theRenderer->BindTexture();
 	g_theRenderer->DrawVertexArray(NUM_OF_TIE_B_WEAPON_VERTICES, tempVerts);
@@ -200,39 +197,17 @@ void TieBomber::Update(float deltaseconds)
 
 	m_position += forwardDirection * m_velocity * deltaseconds;
 
-	Vertex_PCU tempVerts[NUM_BOMBER_VERTS * NUM_OF_TIE_B_WEAPON_VERTICES];
-
-	for (int index = 0; index < NUM_BOMBER_VERTS; index++)
-	{
-		tempVerts[index] = m_bodyVertices[index];
-	}
-
-	int weaponIndex = 0;
-
-	for (int index = NUM_BOMBER_VERTS; index < NUM_BOMBER_VERTS + NUM_OF_TIE_B_WEAPON_VERTICES; index++)
-	{
-		tempVerts[index] = m_weaponVertices[weaponIndex];
-		weaponIndex++;
-	}
-
-	TransformVertexArrayXY3D(NUM_BOMBER_VERTS * NUM_OF_TIE_B_WEAPON_VERTICES, tempVerts, 1.0f * m_scale, m_orientationDegrees, m_position);
-
-	g_theRenderer->CopyCPUToGPU(&tempVerts, sizeof(Vertex_PCU) * (NUM_BOMBER_VERTS + NUM_OF_TIE_B_WEAPON_VERTICES), m_gpuMesh);
+	TransformVertexArrayXY3D(NUM_BOMBER_VERTS, m_bodyVertices, m_worldVerts, 1.0f * m_scale, m_orientationDegrees, m_position);
+	TransformVertexArrayXY3D(NUM_OF_TIE_B_WEAPON_VERTICES, m_weaponVertices, m_worldVerts + NUM_BOMBER_VERTS, 1.0f * m_scale, m_orientationDegrees, m_position);
 }
 
-void TieBomber::Render() const
+void TieBomber::AddVertsForRender(std::vector<Vertex_PCU>& verts) const
 {
-	//RenderBody();
-	//RenderWeapons();
-
-	g_theRenderer->SetModelConstants(RootSig::DEFAULT_PIPELINE);
-	g_theRenderer->SetBlendMode(BlendMode::ALPHA);
-	g_theRenderer->SetDepthMode(DepthMode::ENABLED);
-	g_theRenderer->SetSamplerMode(SamplerMode::POINT_CLAMP);
-	g_theRenderer->BindShader();
-	g_theRenderer->BindTexture();
-	g_theRenderer->DrawVertexBuffer(m_gpuMesh, NUM_BOMBER_VERTS + NUM_OF_TIE_B_WEAPON_VERTICES, sizeof(Vertex_PCU));
+	verts.insert(verts.end(), m_worldVerts, m_worldVerts + NUM_BOMBER_VERTS + NUM_OF_TIE_B_WEAPON_VERTICES);
+}
 
+void TieBomber::RenderDebug() const
+{
 	if (m_game->IsDeveloperModeOn() && m_game->GetShip())
 	{
 		DrawDebugLine(m_position, m_game->GetShip()->GetPosition(), 0.2f, Rgba8(50, 50, 50, 255));
@@ -246,12 +221,11 @@ void TieBomber::Render() const
 
 void TieBomber::Die()
 {
-	SoundID testSound = g_theAudio->CreateOrGetSound("Data/Audio/Tie_Explosion.mp3");
-	g_theAudio->StartSound(testSound);
+	m_game->StartGameSound("Data/Audio/Tie_Explosion.mp3");
 
 	m_isDead = true;
 	m_isGarbage = true;
-	RandomNumberGenerator random = RandomNumberGenerator();
+	RandomNumberGenerator& random = m_game->m_rng;
 	Vec2 normal = m_game->GetShip()->GetPosition() - m_position;
 	m_game->SpawnDebris(random.RollRandomIntInRange(3, 12), Vec2((m_position.x + (m_cosmeticRadius * CosDegrees(normal.GetOrientationDegrees()))), (m_position.y + (m_cosmeticRadius * SinDegrees(normal.GetOrientationDegrees())))), Vec2(0.0f, 0.0f), random.RollRandomFloatInRange(0.2f, 0.8f), m_color);
 }
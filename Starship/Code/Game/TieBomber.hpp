@@ -5,7 +5,6 @@
 #include "Engine/Core/Vertex_PCU.hpp"
 
 class Game;
-class VertexBuffer;
 
 constexpr int NUM_BOMBER_TRIANGLES = 36;
 constexpr int NUM_BOMBER_VERTS = 3 * NUM_BOMBER_TRIANGLES;
@@ -17,7 +16,7 @@ class TieBomber : public Entity
 {
 	Vertex_PCU			m_bodyVertices[NUM_BOMBER_VERTS] = {};
 	Vertex_PCU			m_weaponVertices[NUM_OF_TIE_B_WEAPON_VERTICES] = {};
-	VertexBuffer*		m_gpuMesh = nullptr;
+	Vertex_PCU			m_worldVerts[NUM_BOMBER_VERTS + NUM_OF_TIE_B_WEAPON_VERTICES] = {};
 	Vec2				m_lastShipPosition;
 public:
 						TieBomber() = default;
@@ -25,11 +24,13 @@ public:
 						~TieBomber();
 
 	void				Initialize();
+	void				Spawn(Vec2 const& position);
 
 	void				RenderBody() const;
 	void				RenderWeapons() const;
 
 	virtual void		Update(float deltaseconds) override;
-	virtual void		Render() const override;
+	virtual void		AddVertsForRender(std::vector<Vertex_PCU>& verts) const override;
+	virtual void		RenderDebug() const override;
 	virtual void		Die() override;
 };
\ No newline at end of file
@@ -8,25 +8,20 @@
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Renderer/Renderer.hpp"
-#include "Engine/Renderer/VertexBuffer.hpp"
 
 TieFighter::TieFighter(Game* owner, Vec2 const& position)
 	: Entity(owner, position)
 {
-	m_velocity = Vec2(TIE_FIGHTER_SPEED, TIE_FIGHTER_SPEED);
 	m_physicsRadius = TIE_FIGHTER_PHYSICS_RADIUS;
 	m_cosmeticRadius = TIE_FIGHTER_COSMETIC_RADIUS;
-	m_health = 5;
 	m_color = Rgba8(128, 128, 128, 255);
 
-	m_gpuMesh = g_theRenderer->CreateVertexBuffer(sizeof(Vertex_PCU) * (NUM_FIGHTER_VERTS + NUM_OF_TIE_WEAPON_VERTICES));
-
 	Initialize();
+	Spawn(position);
 }
 
 TieFighter::~TieFighter()
 {
-	DELETE_PTR(m_gpuMesh);
 }
 
 void TieFighter::Initialize()
@@ -115,6 +110,20 @@ void TieFighter::Initialize()
 	m_weaponVertices[71] = Vertex_PCU(0.25f, -0.25f, 58, 58, 58, 255);
 }
 
+// Resets the gameplay state so a pooled fighter can be reused; the local mesh verts are kept
+void TieFighter::Spawn(Vec2 const& position)
+{
+	m_position = position;
+	m_velocity = Vec2(TIE_FIGHTER_SPEED, TIE_FIGHTER_SPEED);
+	m_orientationDegrees = 0.0f;
+	m_health = 5;
+	m_isDead = false;
+	m_isGarbage = false;
+	m_aliveTime = 0.0f;
+	m_lastShipPosition = Vec2();
+	m_bulletDelay = 2.0f;
+}
+
 void TieFighter::RenderBody() const
 {
 
@@ -142,7 +151,7 @@ void TieFighter::Update(float deltaseconds)
 		{
 			float shipConeThreshold = 20.0f;
 
-			RandomNumberGenerator random = RandomNumberGenerator();
+			RandomNumberGenerator& random = m_game->m_rng;
 
 			float delay = random.RollRandomFloatInRange(1.0f, 2.0f);
 
@@ -153,8 +162,7 @@ void TieFighter::Update(float deltaseconds)
 				if (orientation > m_orientationDegrees - shipConeThreshold && orientation < m_orientationDegrees + shipConeThreshold)
 				{
 
-					SoundID testSound = g_theAudio->CreateOrGetSound("Data/Audio/Tie_Laser.mp3");
-					g_theAudio->StartSound(testSound);
+					m_game->StartGameSound("Data/Audio/Tie_Laser.mp3");
 
 					m_game->SpawnBullet(m_position, m_orientationDegrees, Rgba8(0, 255, 0, 255));
 				}
@@ -177,39 +185,17 @@ void TieFighter::Update(float deltaseconds)
 
 	m_position += forwardDirection * m_velocity * deltaseconds;
 
-	Vertex_PCU tempVerts[NUM_FIGHTER_VERTS * NUM_OF_TIE_WEAPON_VERTICES];
-
-	for (int index = 0; index < NUM_FIGHTER_VERTS; index++)
-	{
-		tempVerts[index] = m_bodyVertices[index];
-	}
-
-	int weaponIndex = 0;
-
-	for (int index = NUM_FIGHTER_VERTS; index < NUM_FIGHTER_VERTS + NUM_OF_TIE_WEAPON_VERTICES; index++)
-	{
-		tempVerts[index] = m_weaponVertices[weaponIndex];
-		weaponIndex++;
-	}
-
-	TransformVertexArrayXY3D(NUM_FIGHTER_VERTS * NUM_OF_TIE_WEAPON_VERTICES, tempVerts, 1.0f * m_scale, m_orientationDegrees, m_position);
-
-	g_theRenderer->CopyCPUToGPU(&tempVerts, sizeof(Vertex_PCU) * (NUM_FIGHTER_VERTS + NUM_OF_TIE_WEAPON_VERTICES), m_gpuMesh);
+	TransformVertexArrayXY3D(NUM_FIGHTER_VERTS, m_bodyVertices, m_worldVerts, 1.0f * m_scale, m_orientationDegrees, m_position);
+	TransformVertexArrayXY3D(NUM_OF_TIE_WEAPON_VERTICES, m_weaponVertices, m_worldVerts + NUM_FIGHTER_VERTS, 1.0f * m_scale, m_orientationDegrees, m_position);
 }
 
-void TieFighter::Render() const
+void TieFighter::AddVertsForRender(std::vector<Vertex_PCU>& verts) const
 {
-	//RenderBody();
-	//RenderWeapons();
-
-	g_theRenderer->SetModelConstants(RootSig::DEFAULT_PIPELINE);
-	g_theRenderer->SetBlendMode(BlendMode::ALPHA);
-	g_theRenderer->SetDepthMode(DepthMode::ENABLED);
-	g_theRenderer->SetSamplerMode(SamplerMode::POINT_CLAMP);
-	g_theRenderer->BindShader();
-	g_theRenderer->BindTexture();
-	g_theRenderer->DrawVertexBuffer(m_gpuMesh, NUM_FIGHTER_VERTS + NUM_OF_TIE_WEAPON_VERTICES, sizeof(Vertex_PCU));
+	verts.insert(verts.end(), m_worldVerts, m_worldVerts + NUM_FIGHTER_VERTS + NUM_OF_TIE_WEAPON_VERTICES);
+}
 
+void TieFighter::RenderDebug() const
+{
 	if (m_game->IsDeveloperModeOn() && m_game->GetShip())
 	{
 		DrawDebugLine(m_position, m_game->GetShip()->GetPosition(), 0.2f, Rgba8(50, 50, 50, 255));
@@ -223,12 +209,11 @@ void TieFighter::Render() const
 
 void TieFighter::Die()
 {
-	SoundID testSound = g_theAudio->CreateOrGetSound("Data/Audio/Tie_Explosion.mp3");
-	g_theAudio->StartSound(testSound);
+	m_game->StartGameSound("Data/Audio/Tie_Explosion.mp3");
 
 	m_isDead = true;
 	m_isGarbage = true;
-	RandomNumberGenerator random = RandomNumberGenerator();
+	RandomNumberGenerator& random = m_game->m_rng;
 	Vec2 normal = m_game->GetShip()->GetPosition() - m_position;
 	m_game->SpawnDebris(random.RollRandomIntInRange(3, 12), Vec2((m_position.x + (m_cosmeticRadius * CosDegrees(normal.GetOrientationDegrees()))), (m_position.y + (m_cosmeticRadius * SinDegrees(normal.GetOrientationDegrees())))), Vec2(0.0f, 0.0f), random.RollRandomFloatInRange(0.2f, 0.8f), m_color);
 }
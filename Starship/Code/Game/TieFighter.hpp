@@ -5,7 +5,6 @@
 #include "Engine/Core/Vertex_PCU.hpp"
 
 class Game;
-class VertexBuffer;
 
 constexpr int NUM_FIGHTER_TRIANGLES = 28;
 constexpr int NUM_FIGHTER_VERTS = 3 * NUM_FIGHTER_TRIANGLES;
@@ -15,9 +14,9 @@ constexpr int NUM_OF_TIE_WEAPON_VERTICES = 3 * NUM_OF_TIE_WEAPON_TRIANGLES;
 
 class TieFighter : public Entity
 {
-	VertexBuffer*		m_gpuMesh = nullptr;
 	Vertex_PCU			m_bodyVertices[NUM_FIGHTER_VERTS] = {};
 	Vertex_PCU			m_weaponVertices[NUM_OF_TIE_WEAPON_VERTICES] = {};
+	Vertex_PCU			m_worldVerts[NUM_FIGHTER_VERTS + NUM_OF_TIE_WEAPON_VERTICES] = {};
 	Vec2				m_lastShipPosition;
 	float				m_bulletDelay = 2.0f;
 public:
@@ -26,11 +25,13 @@ public:
 						~TieFighter();
 
 	void				Initialize();
+	void				Spawn(Vec2 const& position);
 
 	void				RenderBody() const;
 	void				RenderWeapons() const;
 
 	virtual void		Update(float deltaseconds) override;
-	virtual void		Render() const override;
+	virtual void		AddVertsForRender(std::vector<Vertex_PCU>& verts) const override;
+	virtual void		RenderDebug() const override;
 	virtual void		Die() override;
 };
\ No newline at end of file
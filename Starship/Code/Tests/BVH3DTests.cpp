@@ -0,0 +1,179 @@
+#include "Tests/TestFramework.hpp"
+
+#include "Engine/Math/BVH3D.hpp"
+
+#include <random>
+
+static float RollFloat(std::mt19937& rng, float minValue, float maxValue)
+{
+	return std::uniform_real_distribution<float>(minValue, maxValue)(rng);
+}
+
+static int RollInt(std::mt19937& rng, int minValue, int maxValue)
+{
+	return std::uniform_int_distribution<int>(minValue, maxValue)(rng);
+}
+
+static Vec3 RollDirection(std::mt19937& rng)
+{
+	Vec3 direction;
+
+	do
+	{
+		direction = Vec3(RollFloat(rng, -1.0f, 1.0f), RollFloat(rng, -1.0f, 1.0f), RollFloat(rng, -1.0f, 1.0f));
+	}
+	while (direction.GetLengthSquared() < 0.01f || direction.GetLengthSquared() > 1.0f);
+
+	return direction.GetNormalized();
+}
+
+// The nearest hit over every primitive, which the BVH promises to reproduce exactly
+static int RaycastBruteForce(BVH3D const& bvh, Vec3 const& startPos, Vec3 const& fwdNormal, float maxDist, float& outImpactDist)
+{
+	int hitHandle = -1;
+	outImpactDist = maxDist;
+
+	for (int handle = 0; handle < bvh.GetNumOfPrimitives(); handle++)
+	{
+		RaycastResult3D result = bvh.RaycastPrimitive(handle, startPos, fwdNormal, maxDist);
+
+		if (result.m_didImpact && (hitHandle < 0 || result.m_impactDist < outImpactDist))
+		{
+			outImpactDist = result.m_impactDist;
+			hitHandle = handle;
+		}
+	}
+
+	return hitHandle;
+}
+
+// Primitives are added with ids 0..N-1, so a handle and its id match
+static bool DoesBVHMatchBruteForce(BVH3D const& bvh, Vec3 const& startPos, Vec3 const& fwdNormal, float maxDist)
+{
+	float bruteDist;
+	int bruteHandle = RaycastBruteForce(bvh, startPos, fwdNormal, maxDist, bruteDist);
+
+	int hitID;
+	RaycastResult3D result = bvh.RaycastClosest(startPos, fwdNormal, maxDist, hitID);
+
+	if (hitID != bruteHandle || bvh.RaycastAny(startPos, fwdNormal, maxDist) != (bruteHandle >= 0))
+		return false;
+
+	return hitID < 0 || result.m_impactDist == bruteDist;
+}
+
+TEST_CASE(BVH3D_RaycastsMatchBruteForce)
+{
+	std::mt19937 rng(17);
+	BVH3D bvh;
+
+	for (int id = 0; id < 2000; id++)
+	{
+		Vec3 center(RollFloat(rng, 0.0f, 100.0f), RollFloat(rng, 0.0f, 100.0f), RollFloat(rng, 0.0f, 100.0f));
+		float size = RollFloat(rng, 0.5f, 3.0f);
+
+		switch (id % 5)
+		{
+		case 0:		bvh.AddAABB3(id, AABB3(center - Vec3(size, size, size), center + Vec3(size, size * 0.5f, size)));		break;
+		case 1:		bvh.AddOBB3(id, OBB3(center, RollDirection(rng), Vec3(size, size * 0.5f, size * 0.75f)));				break;
+		case 2:		bvh.AddSphere(id, center, size);																		break;
+		case 3:		bvh.AddZCylinder(id, center, size * 2.0f, size * 0.5f);													break;
+		default:	bvh.AddTriangle(id, center, center + RollDirection(rng) * size * 2.0f, center + RollDirection(rng) * size * 2.0f);	break;
+		}
+	}
+
+	bvh.Build();
+
+	bool doAllMatch = true;
+
+	for (int rayIndex = 0; rayIndex < 2000; rayIndex++)
+	{
+		Vec3 startPos(RollFloat(rng, 0.0f, 100.0f), RollFloat(rng, 0.0f, 100.0f), RollFloat(rng, 0.0f, 100.0f));
+		doAllMatch = doAllMatch && DoesBVHMatchBruteForce(bvh, startPos, RollDirection(rng), 60.0f);
+	}
+
+	// Moving every sphere and refitting must keep the queries exact
+	for (int handle = 2; handle < bvh.GetNumOfPrimitives(); handle += 5)
+	{
+		bvh.SetSphere(handle, Vec3(RollFloat(rng, 0.0f, 100.0f), RollFloat(rng, 0.0f, 100.0f), RollFloat(rng, 0.0f, 100.0f)), RollFloat(rng, 0.5f, 3.0f));
+	}
+
+	bvh.Refit();
+
+	for (int rayIndex = 0; rayIndex < 2000; rayIndex++)
+	{
+		Vec3 startPos(RollFloat(rng, 0.0f, 100.0f), RollFloat(rng, 0.0f, 100.0f), RollFloat(rng, 0.0f, 100.0f));
+		doAllMatch = doAllMatch && DoesBVHMatchBruteForce(bvh, startPos, RollDirection(rng), 60.0f);
+	}
+
+	CHECK(doAllMatch);
+}
+
+TEST_CASE(BVH3D_AxisAlignedRaysOnSlabPlanesMatchBruteForce)
+{
+	// A ray along z whose start lies exactly on the node's y = 0 plane, hitting the triangle's bottom edge
+	BVH3D edgeBVH;
+	edgeBVH.AddTriangle(0, Vec3(-5.0f, 0.0f, 10.0f), Vec3(5.0f, 0.0f, 10.0f), Vec3(0.0f, 5.0f, 12.0f));
+	edgeBVH.Build();
+
+	int hitID;
+	RaycastResult3D result = edgeBVH.RaycastClosest(Vec3(0.0f, 0.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f), 20.0f, hitID);
+
+	CHECK(hitID == 0 && result.m_impactDist == 10.0f);
+	CHECK(edgeBVH.RaycastAny(Vec3(0.0f, 0.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f), 20.0f));
+
+	// Triangles on an integer lattice, so node bounds sit on the same planes that the integer ray starts lie on
+	std::mt19937 rng(18);
+	BVH3D bvh;
+
+	for (int id = 0; id < 400; id++)
+	{
+		Vec3 corner((float)RollInt(rng, 0, 20), (float)RollInt(rng, 0, 20), (float)RollInt(rng, 0, 20));
+		Vec3 vertexB = corner + Vec3((float)RollInt(rng, -3, 3), (float)RollInt(rng, -3, 3), (float)RollInt(rng, -3, 3));
+		Vec3 vertexC = corner + Vec3((float)RollInt(rng, -3, 3), (float)RollInt(rng, -3, 3), (float)RollInt(rng, -3, 3));
+
+		bvh.AddTriangle(id, corner, vertexB, vertexC);
+	}
+
+	bvh.Build();
+
+	Vec3 const axisDirections[6] = { Vec3(1.0f, 0.0f, 0.0f), Vec3(-1.0f, 0.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f),
+		Vec3(0.0f, -1.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f), Vec3(0.0f, 0.0f, -1.0f) };
+
+	bool doAllMatch = true;
+	int numOfHits = 0;
+
+	for (int rayIndex = 0; rayIndex < 6000; rayIndex++)
+	{
+		Vec3 startPos((float)RollInt(rng, -2, 22), (float)RollInt(rng, -2, 22), (float)RollInt(rng, -2, 22));
+		Vec3 const& fwdNormal = axisDirections[rayIndex % 6];
+
+		doAllMatch = doAllMatch && DoesBVHMatchBruteForce(bvh, startPos, fwdNormal, 30.0f);
+		numOfHits += bvh.RaycastAny(startPos, fwdNormal, 30.0f) ? 1 : 0;
+	}
+
+	CHECK(doAllMatch);
+	CHECK(numOfHits > 100);
+}
+
+TEST_CASE(BVH3D_TriangleHitAtExactlyMaxDistCounts)
+{
+	Vec3 vertexA(-1.0f, -1.0f, 5.0f);
+	Vec3 vertexB(1.0f, -1.0f, 5.0f);
+	Vec3 vertexC(0.0f, 1.0f, 5.0f);
+
+	RaycastResult3D atMaxDist = RaycastVsTriangle3D(Vec3(0.0f, 0.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f), 5.0f, vertexA, vertexB, vertexC);
+	RaycastResult3D pastMaxDist = RaycastVsTriangle3D(Vec3(0.0f, 0.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f), 4.99f, vertexA, vertexB, vertexC);
+
+	CHECK(atMaxDist.m_didImpact && atMaxDist.m_impactDist == 5.0f);
+	CHECK(!pastMaxDist.m_didImpact);
+
+	BVH3D bvh;
+	bvh.AddTriangle(7, vertexA, vertexB, vertexC);
+	bvh.Build();
+
+	int hitID;
+	bvh.RaycastClosest(Vec3(0.0f, 0.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f), 5.0f, hitID);
+
+	CHECK(hitID == 7);
+}
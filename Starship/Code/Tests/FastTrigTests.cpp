@@ -0,0 +1,143 @@
+#include "Tests/TestFramework.hpp"
+
+#include "Engine/Math/MathUtils.hpp"
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+// The bound documented in MathUtils.hpp, against double precision sin/cos of the same float angle
+constexpr double FAST_TRIG_MAX_ERROR = 1e-7;
+
+static double GetSineError(float degrees, float sine)
+{
+	return fabs((double)sine - sin((double)degrees * (3.14159265358979323846 / 180.0)));
+}
+
+static double GetCosineError(float degrees, float cosine)
+{
+	return fabs((double)cosine - cos((double)degrees * (3.14159265358979323846 / 180.0)));
+}
+
+static bool AreBitsEqual(float a, float b)
+{
+	return memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+TEST_CASE(FastTrig_ErrorIsBoundedInEveryQuadrant)
+{
+	std::mt19937 rng(16);
+
+	// Each 90 degree quadrant on both sides of zero, then wider ranges where the reduction matters most
+	double maxError = 0.0;
+
+	for (int quadrant = -8; quadrant < 8; quadrant++)
+	{
+		std::uniform_real_distribution<float> distribution(quadrant * 90.0f, (quadrant + 1) * 90.0f);
+
+		for (int sampleIndex = 0; sampleIndex < 20000; sampleIndex++)
+		{
+			float degrees = distribution(rng);
+			float sine;
+			float cosine;
+			FastSinCosDegrees(degrees, sine, cosine);
+
+			maxError = fmax(maxError, fmax(GetSineError(degrees, sine), GetCosineError(degrees, cosine)));
+		}
+	}
+
+	for (float range : { 1e3f, 1e5f, 1e7f })
+	{
+		std::uniform_real_distribution<float> distribution(-range, range);
+
+		for (int sampleIndex = 0; sampleIndex < 50000; sampleIndex++)
+		{
+			float degrees = distribution(rng);
+			float sine;
+			float cosine;
+			FastSinCosDegrees(degrees, sine, cosine);
+
+			maxError = fmax(maxError, fmax(GetSineError(degrees, sine), GetCosineError(degrees, cosine)));
+		}
+	}
+
+	CHECK(maxError <= FAST_TRIG_MAX_ERROR);
+}
+
+TEST_CASE(FastTrig_QuadrantBoundariesAreExact)
+{
+	float const expectedSines[4] = { 0.0f, 1.0f, 0.0f, -1.0f };
+	float const expectedCosines[4] = { 1.0f, 0.0f, -1.0f, 0.0f };
+
+	for (int multiple = -40; multiple <= 40; multiple++)
+	{
+		float degrees = multiple * 90.0f;
+		int quadrant = ((multiple % 4) + 4) % 4;
+
+		float sine;
+		float cosine;
+		FastSinCosDegrees(degrees, sine, cosine);
+
+		CHECK(sine == expectedSines[quadrant]);
+		CHECK(cosine == expectedCosines[quadrant]);
+	}
+}
+
+TEST_CASE(FastTrig_NegativeAnglesAreSymmetric)
+{
+	std::mt19937 rng(17);
+	std::uniform_real_distribution<float> distribution(0.0f, 1e4f);
+
+	for (int sampleIndex = 0; sampleIndex < 100000; sampleIndex++)
+	{
+		float degrees = distribution(rng);
+
+		float sine;
+		float cosine;
+		float negativeSine;
+		float negativeCosine;
+		FastSinCosDegrees(degrees, sine, cosine);
+		FastSinCosDegrees(-degrees, negativeSine, negativeCosine);
+
+		CHECK(negativeSine == -sine);
+		CHECK(negativeCosine == cosine);
+		CHECK(FastSinDegrees(degrees) == sine);
+		CHECK(FastCosDegrees(degrees) == cosine);
+	}
+}
+
+TEST_CASE(FastTrig_BatchMatchesScalarBitForBit)
+{
+	std::mt19937 rng(18);
+	std::uniform_real_distribution<float> distribution(-1e4f, 1e4f);
+
+	// Counts around multiples of four cover the SIMD body and the scalar tail; the last includes halfway quadrant ties
+	for (int count = 0; count <= 37; count++)
+	{
+		std::vector<float> degrees(count);
+
+		for (int index = 0; index < count; index++)
+		{
+			degrees[index] = (index % 5 == 0) ? (index - 18) * 45.0f : distribution(rng);
+		}
+
+		std::vector<float> sines(count);
+		std::vector<float> cosines(count);
+		FastSinCosDegrees(degrees.data(), sines.data(), cosines.data(), count);
+
+		// The input may alias an output
+		std::vector<float> aliasedSines = degrees;
+		std::vector<float> otherCosines(count);
+		FastSinCosDegrees(aliasedSines.data(), aliasedSines.data(), otherCosines.data(), count);
+
+		for (int index = 0; index < count; index++)
+		{
+			float sine;
+			float cosine;
+			FastSinCosDegrees(degrees[index], sine, cosine);
+
+			CHECK(AreBitsEqual(sines[index], sine) && AreBitsEqual(cosines[index], cosine));
+			CHECK(AreBitsEqual(aliasedSines[index], sine) && AreBitsEqual(otherCosines[index], cosine));
+		}
+	}
+}
@@ -0,0 +1,190 @@
+#include "Tests/TestFramework.hpp"
+
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec4.hpp"
+#include "Engine/Core/JobSystem.hpp"
+
+#include <random>
+#include <vector>
+
+static float RollFloat(std::mt19937& rng, float minValue, float maxValue)
+{
+	return std::uniform_real_distribution<float>(minValue, maxValue)(rng);
+}
+
+// A camera somewhere near the origin looking in a random direction, as perspective or ortho
+static Mat44 MakeRandomViewProjection(std::mt19937& rng, bool isPerspective)
+{
+	Mat44 cameraToWorld = Mat44::CreateZRotationDegrees(RollFloat(rng, -180.0f, 180.0f));
+	cameraToWorld.AppendYRotation(RollFloat(rng, -80.0f, 80.0f));
+	cameraToWorld.AppendXRotation(RollFloat(rng, -180.0f, 180.0f));
+	cameraToWorld.SetTranslation3D(Vec3(RollFloat(rng, -5.0f, 5.0f), RollFloat(rng, -5.0f, 5.0f), RollFloat(rng, -5.0f, 5.0f)));
+
+	Mat44 viewProjection = isPerspective
+		? Mat44::CreatePerspectiveProjection(RollFloat(rng, 40.0f, 100.0f), RollFloat(rng, 0.5f, 2.0f), 0.1f, 100.0f)
+		: Mat44::CreateOrthoProjection(-20.0f, 20.0f, -10.0f, 10.0f, 0.0f, 60.0f);
+
+	viewProjection.Append(cameraToWorld.GetOrthonormalInverse());
+
+	return viewProjection;
+}
+
+enum class PointClass
+{
+	INSIDE,
+	OUTSIDE,
+	TOO_CLOSE_TO_CALL,
+};
+
+// Classifies a point straight from its D3D clip coordinates (-w <= x, y <= w and 0 <= z <= w), independent of the planes
+static PointClass ClassifyPoint(Mat44 const& viewProjection, Vec3 const& point)
+{
+	Vec4 clip = viewProjection.TransformHomogeneous3D(Vec4(point.x, point.y, point.z, 1.0f));
+	float margin = 1e-3f * (fabsf(clip.w) + 1.0f);
+
+	float distances[6] = { clip.w + clip.x, clip.w - clip.x, clip.w + clip.y, clip.w - clip.y, clip.z, clip.w - clip.z };
+	bool isClearlyInside = true;
+
+	for (float distance : distances)
+	{
+		if (distance < -margin)
+			return PointClass::OUTSIDE;
+
+		isClearlyInside = isClearlyInside && distance > margin;
+	}
+
+	return isClearlyInside ? PointClass::INSIDE : PointClass::TOO_CLOSE_TO_CALL;
+}
+
+TEST_CASE(Frustum_PlanesAgreeWithClipSpace)
+{
+	std::mt19937 rng(19);
+
+	int numOfInsidePoints = 0;
+	int numOfOutsidePoints = 0;
+
+	for (int cameraIndex = 0; cameraIndex < 40; cameraIndex++)
+	{
+		Mat44 viewProjection = MakeRandomViewProjection(rng, cameraIndex % 4 != 0);
+		Frustum frustum = Frustum::CreateFromViewProjection(viewProjection);
+
+		for (int pointIndex = 0; pointIndex < 2000; pointIndex++)
+		{
+			Vec3 point(RollFloat(rng, -80.0f, 80.0f), RollFloat(rng, -80.0f, 80.0f), RollFloat(rng, -80.0f, 80.0f));
+			PointClass pointClass = ClassifyPoint(viewProjection, point);
+
+			if (pointClass == PointClass::INSIDE)
+			{
+				CHECK(frustum.IsSphereVisible(point, 0.0f));
+				numOfInsidePoints++;
+			}
+			else if (pointClass == PointClass::OUTSIDE)
+			{
+				CHECK(!frustum.IsSphereVisible(point, 0.0f));
+				numOfOutsidePoints++;
+			}
+		}
+	}
+
+	// Both classes must actually be exercised
+	CHECK(numOfInsidePoints > 1000);
+	CHECK(numOfOutsidePoints > 1000);
+}
+
+TEST_CASE(Frustum_CullingIsConservative)
+{
+	std::mt19937 rng(20);
+
+	for (int cameraIndex = 0; cameraIndex < 40; cameraIndex++)
+	{
+		Mat44 viewProjection = MakeRandomViewProjection(rng, cameraIndex % 4 != 0);
+		Frustum frustum = Frustum::CreateFromViewProjection(viewProjection);
+
+		for (int shapeIndex = 0; shapeIndex < 500; shapeIndex++)
+		{
+			Vec3 center(RollFloat(rng, -60.0f, 60.0f), RollFloat(rng, -60.0f, 60.0f), RollFloat(rng, -60.0f, 60.0f));
+			Vec3 halfSize(RollFloat(rng, 0.0f, 6.0f), RollFloat(rng, 0.0f, 6.0f), RollFloat(rng, 0.0f, 6.0f));
+			AABB3 box(center - halfSize, center + halfSize);
+			float radius = halfSize.GetLength();
+
+			// Any shape holding a point that is clearly inside must never be culled
+			for (int sampleIndex = 0; sampleIndex < 16; sampleIndex++)
+			{
+				Vec3 sample(RollFloat(rng, box.m_mins.x, box.m_maxs.x), RollFloat(rng, box.m_mins.y, box.m_maxs.y), RollFloat(rng, box.m_mins.z, box.m_maxs.z));
+
+				if (ClassifyPoint(viewProjection, sample) == PointClass::INSIDE)
+				{
+					CHECK(frustum.IsAABB3Visible(box));
+					CHECK(frustum.IsSphereVisible(center, radius));
+					break;
+				}
+			}
+		}
+	}
+}
+
+static void CheckBatchMatchesScalar(std::mt19937& rng, Frustum const& frustum, int count)
+{
+	std::vector<AABB3> boxes(count);
+	std::vector<Vec3> centers(count);
+	std::vector<float> radii(count);
+
+	for (int index = 0; index < count; index++)
+	{
+		Vec3 center(RollFloat(rng, -60.0f, 60.0f), RollFloat(rng, -60.0f, 60.0f), RollFloat(rng, -60.0f, 60.0f));
+		Vec3 halfSize(RollFloat(rng, 0.0f, 6.0f), RollFloat(rng, 0.0f, 6.0f), RollFloat(rng, 0.0f, 6.0f));
+
+		boxes[index] = AABB3(center - halfSize, center + halfSize);
+		centers[index] = center;
+		radii[index] = RollFloat(rng, 0.0f, 6.0f);
+	}
+
+	// Sentinel values catch an output the batch forgot to write
+	std::vector<uint8_t> boxVisibility(count, 0xCD);
+	std::vector<uint8_t> sphereVisibility(count, 0xCD);
+
+	CullAABBs(frustum, boxes.data(), count, boxVisibility.data());
+	CullSpheres(frustum, centers.data(), radii.data(), count, sphereVisibility.data());
+
+	bool doAllMatch = true;
+
+	for (int index = 0; index < count; index++)
+	{
+		doAllMatch = doAllMatch && boxVisibility[index] == (frustum.IsAABB3Visible(boxes[index]) ? 1 : 0);
+		doAllMatch = doAllMatch && sphereVisibility[index] == (frustum.IsSphereVisible(centers[index], radii[index]) ? 1 : 0);
+	}
+
+	CHECK(doAllMatch);
+}
+
+TEST_CASE(Frustum_BatchCullingMatchesScalar)
+{
+	std::mt19937 rng(21);
+
+	// Counts around multiples of four cover the SIMD body and the scalar tail
+	for (int count = 0; count <= 13; count++)
+	{
+		Frustum frustum = Frustum::CreateFromViewProjection(MakeRandomViewProjection(rng, count % 3 != 0));
+		CheckBatchMatchesScalar(rng, frustum, count);
+	}
+
+	// Several CULL_PARALLEL_GRAIN chunks with a partial last one, split across workers
+	JobSystemConfig config;
+	config.m_numOfWorkerThreads = 4;
+
+	JobSystem jobSystem(config);
+	jobSystem.StartUp();
+
+	JobSystem* previousJobSystem = g_theJobSystem;
+	g_theJobSystem = &jobSystem;
+
+	for (int cameraIndex = 0; cameraIndex < 4; cameraIndex++)
+	{
+		Frustum frustum = Frustum::CreateFromViewProjection(MakeRandomViewProjection(rng, cameraIndex != 0));
+		CheckBatchMatchesScalar(rng, frustum, 3 * 16384 + 77);
+	}
+
+	g_theJobSystem = previousJobSystem;
+	jobSystem.ShutDown();
+}
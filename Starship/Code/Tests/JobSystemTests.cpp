@@ -0,0 +1,123 @@
+#include "Tests/TestFramework.hpp"
+
+#include "Engine/Core/JobSystem.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global heap for the whole test executable. Allocations are only counted while s_isCountingAllocations is
+// set, from any thread, so a job system worker reaching the heap shows up too.
+static std::atomic<bool> s_isCountingAllocations = false;
+static std::atomic<int> s_numOfCountedAllocations = 0;
+
+void* operator new(size_t size)
+{
+	if (s_isCountingAllocations)
+	{
+		s_numOfCountedAllocations++;
+	}
+
+	void* memory = malloc(size > 0 ? size : 1);
+
+	if (!memory)
+		throw std::bad_alloc();
+
+	return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+	free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+	free(memory);
+}
+
+constexpr int NUM_OF_JOBS_PER_ROUND = 32;
+
+// One frame's worth of small jobs: futures with results, plus a fire-and-forget background job
+static int SubmitAndWaitForARound(JobSystem& jobSystem)
+{
+	JobFuture<int> futures[NUM_OF_JOBS_PER_ROUND];
+
+	for (int jobIndex = 0; jobIndex < NUM_OF_JOBS_PER_ROUND; jobIndex++)
+	{
+		int a = jobIndex;
+		int b = jobIndex * 2;
+		futures[jobIndex] = jobSystem.Submit([a, b]() { return a + b; });
+	}
+
+	JobFuture<void> backgroundFuture = jobSystem.Submit([]() {}, JobPriority::BACKGROUND);
+
+	int sum = 0;
+
+	for (JobFuture<int> const& future : futures)
+	{
+		sum += future.Get();
+	}
+
+	backgroundFuture.Wait();
+
+	return sum;
+}
+
+TEST_CASE(JobSystem_SubmitDoesNotAllocateOnceThePoolIsWarm)
+{
+	JobSystemConfig config;
+	config.m_numOfWorkerThreads = 4;
+
+	JobSystem jobSystem(config);
+	jobSystem.StartUp();
+
+	// Warm-up grows every thread's block pool to its high-water mark
+	for (int roundIndex = 0; roundIndex < 200; roundIndex++)
+	{
+		SubmitAndWaitForARound(jobSystem);
+	}
+
+	int expectedSum = 3 * (NUM_OF_JOBS_PER_ROUND * (NUM_OF_JOBS_PER_ROUND - 1) / 2);
+	bool areSumsCorrect = true;
+
+	s_numOfCountedAllocations = 0;
+	s_isCountingAllocations = true;
+
+	for (int roundIndex = 0; roundIndex < 2000; roundIndex++)
+	{
+		areSumsCorrect = areSumsCorrect && SubmitAndWaitForARound(jobSystem) == expectedSum;
+	}
+
+	s_isCountingAllocations = false;
+
+	CHECK(areSumsCorrect);
+	CHECK(s_numOfCountedAllocations == 0);
+
+	jobSystem.ShutDown();
+}
+
+TEST_CASE(JobSystem_OversizedCapturesFallBackToTheHeap)
+{
+	JobSystemConfig config;
+	config.m_numOfWorkerThreads = 2;
+
+	JobSystem jobSystem(config);
+	jobSystem.StartUp();
+
+	struct LargeCapture
+	{
+		unsigned char m_bytes[JOB_BLOCK_PAYLOAD_SIZE * 2] = {};
+	};
+
+	LargeCapture largeCapture;
+	largeCapture.m_bytes[7] = 42;
+
+	{
+		JobFuture<int> future = jobSystem.Submit([largeCapture]() { return (int)largeCapture.m_bytes[7]; });
+
+		CHECK(future.Get() == 42);
+	}
+
+	jobSystem.ShutDown();
+}
@@ -0,0 +1,300 @@
+#include "Tests/TestFramework.hpp"
+
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Math/Vec4.hpp"
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+// The SIMD kernels are checked against plain scalar formulas written out here, summed in the same order as the engine's
+// scalar fallback. Append and the transforms promise bit-identical results, so those compare exactly.
+static float RollFloat(std::mt19937& rng, float minValue, float maxValue)
+{
+	return std::uniform_real_distribution<float>(minValue, maxValue)(rng);
+}
+
+static Mat44 MakeRandomMatrix(std::mt19937& rng)
+{
+	float values[16];
+
+	for (float& value : values)
+	{
+		value = RollFloat(rng, -4.0f, 4.0f);
+	}
+
+	return Mat44(values);
+}
+
+// Random entries plus a dominant diagonal keep the matrix far from singular
+static Mat44 MakeRandomInvertibleMatrix(std::mt19937& rng)
+{
+	Mat44 matrix = MakeRandomMatrix(rng);
+
+	for (int diagonalIndex = 0; diagonalIndex < 4; diagonalIndex++)
+	{
+		float sign = RollFloat(rng, -1.0f, 1.0f) < 0.0f ? -1.0f : 1.0f;
+		matrix.m_values[diagonalIndex * 5] += sign * 20.0f;
+	}
+
+	return matrix;
+}
+
+static Mat44 AppendScalar(Mat44 const& matrix, Mat44 const& appendThis)
+{
+	float const* a = matrix.m_values;
+	float const* b = appendThis.m_values;
+	float result[16];
+
+	for (int column = 0; column < 4; column++)
+	{
+		for (int row = 0; row < 4; row++)
+		{
+			result[column * 4 + row] = (a[row] * b[column * 4]) + (a[4 + row] * b[column * 4 + 1]) + (a[8 + row] * b[column * 4 + 2]) + (a[12 + row] * b[column * 4 + 3]);
+		}
+	}
+
+	return Mat44(result);
+}
+
+static Vec4 TransformScalar(Mat44 const& matrix, Vec4 const& point)
+{
+	float const* m = matrix.m_values;
+
+	return Vec4(
+		(m[Mat44::Ix] * point.x) + (m[Mat44::Jx] * point.y) + (m[Mat44::Kx] * point.z) + (m[Mat44::Tx] * point.w),
+		(m[Mat44::Iy] * point.x) + (m[Mat44::Jy] * point.y) + (m[Mat44::Ky] * point.z) + (m[Mat44::Ty] * point.w),
+		(m[Mat44::Iz] * point.x) + (m[Mat44::Jz] * point.y) + (m[Mat44::Kz] * point.z) + (m[Mat44::Tz] * point.w),
+		(m[Mat44::Iw] * point.x) + (m[Mat44::Jw] * point.y) + (m[Mat44::Kw] * point.z) + (m[Mat44::Tw] * point.w));
+}
+
+// Gauss-Jordan elimination with partial pivoting, in double precision
+static bool InvertScalar(Mat44 const& matrix, double* outInverse)
+{
+	double work[4][8];
+
+	for (int row = 0; row < 4; row++)
+	{
+		for (int column = 0; column < 4; column++)
+		{
+			work[row][column] = matrix.m_values[column * 4 + row];
+			work[row][column + 4] = row == column ? 1.0 : 0.0;
+		}
+	}
+
+	for (int pivot = 0; pivot < 4; pivot++)
+	{
+		int bestRow = pivot;
+
+		for (int row = pivot + 1; row < 4; row++)
+		{
+			if (fabs(work[row][pivot]) > fabs(work[bestRow][pivot]))
+			{
+				bestRow = row;
+			}
+		}
+
+		if (fabs(work[bestRow][pivot]) < 1e-12)
+			return false;
+
+		for (int column = 0; column < 8; column++)
+		{
+			double swap = work[pivot][column];
+			work[pivot][column] = work[bestRow][column];
+			work[bestRow][column] = swap;
+		}
+
+		double inversePivot = 1.0 / work[pivot][pivot];
+
+		for (int column = 0; column < 8; column++)
+		{
+			work[pivot][column] *= inversePivot;
+		}
+
+		for (int row = 0; row < 4; row++)
+		{
+			if (row == pivot)
+				continue;
+
+			double factor = work[row][pivot];
+
+			for (int column = 0; column < 8; column++)
+			{
+				work[row][column] -= factor * work[pivot][column];
+			}
+		}
+	}
+
+	for (int row = 0; row < 4; row++)
+	{
+		for (int column = 0; column < 4; column++)
+		{
+			outInverse[column * 4 + row] = work[row][column + 4];
+		}
+	}
+
+	return true;
+}
+
+static bool AreMatricesIdentical(Mat44 const& a, Mat44 const& b)
+{
+	return memcmp(a.m_values, b.m_values, sizeof(a.m_values)) == 0;
+}
+
+TEST_CASE(Mat44_AppendMatchesScalar)
+{
+	std::mt19937 rng(14);
+
+	for (int iteration = 0; iteration < 1000; iteration++)
+	{
+		Mat44 matrix = MakeRandomMatrix(rng);
+		Mat44 appendThis = MakeRandomMatrix(rng);
+
+		Mat44 expected = AppendScalar(matrix, appendThis);
+		matrix.Append(appendThis);
+
+		CHECK(AreMatricesIdentical(matrix, expected));
+	}
+
+	// Appending a matrix to itself reads columns that are being overwritten
+	Mat44 matrix = MakeRandomMatrix(rng);
+	Mat44 expected = AppendScalar(matrix, matrix);
+	matrix.Append(matrix);
+
+	CHECK(AreMatricesIdentical(matrix, expected));
+}
+
+TEST_CASE(Mat44_TransformsMatchScalar)
+{
+	std::mt19937 rng(15);
+
+	for (int iteration = 0; iteration < 1000; iteration++)
+	{
+		Mat44 matrix = MakeRandomMatrix(rng);
+		Vec4 point(RollFloat(rng, -100.0f, 100.0f), RollFloat(rng, -100.0f, 100.0f), RollFloat(rng, -100.0f, 100.0f), RollFloat(rng, -2.0f, 2.0f));
+
+		Vec4 expected = TransformScalar(matrix, point);
+		Vec4 homogeneous = matrix.TransformHomogeneous3D(point);
+
+		CHECK(homogeneous.x == expected.x && homogeneous.y == expected.y && homogeneous.z == expected.z && homogeneous.w == expected.w);
+
+		Vec4 expectedPosition = TransformScalar(matrix, Vec4(point.x, point.y, point.z, 1.0f));
+		Vec3 position = matrix.TransformPosition3D(Vec3(point.x, point.y, point.z));
+
+		CHECK(position.x == expectedPosition.x && position.y == expectedPosition.y && position.z == expectedPosition.z);
+	}
+}
+
+TEST_CASE(Mat44_InverseMatchesScalar)
+{
+	std::mt19937 rng(16);
+
+	for (int iteration = 0; iteration < 1000; iteration++)
+	{
+		Mat44 matrix = MakeRandomInvertibleMatrix(rng);
+
+		double expected[16];
+		CHECK(InvertScalar(matrix, expected));
+
+		Mat44 inverse = matrix.GetInverse();
+
+		for (int index = 0; index < 16; index++)
+		{
+			CHECK_NEAR(inverse.m_values[index], expected[index], 1e-5f);
+		}
+
+		// M * M^-1 is the identity
+		Mat44 product = matrix;
+		product.Append(inverse);
+
+		for (int index = 0; index < 16; index++)
+		{
+			CHECK_NEAR(product.m_values[index], index % 5 == 0 ? 1.0f : 0.0f, 1e-4f);
+		}
+	}
+
+	// Rigid transforms agree with the orthonormal inverse
+	Mat44 rigid = Mat44::CreateZRotationDegrees(37.0f);
+	rigid.AppendXRotation(-112.0f);
+	rigid.SetTranslation3D(Vec3(3.0f, -8.0f, 21.0f));
+
+	Mat44 inverse = rigid.GetInverse();
+	Mat44 orthonormalInverse = rigid.GetOrthonormalInverse();
+
+	for (int index = 0; index < 16; index++)
+	{
+		CHECK_NEAR(inverse.m_values[index], orthonormalInverse.m_values[index], 1e-5f);
+	}
+}
+
+TEST_CASE(Mat44_InverseOfSingularMatrixIsNotFinite)
+{
+	Mat44 singular = Mat44::CreateNonUniformScale3D(Vec3(1.0f, 0.0f, 1.0f));
+	Mat44 inverse = singular.GetInverse();
+
+	bool hasNonFiniteValue = false;
+
+	for (float value : inverse.m_values)
+	{
+		hasNonFiniteValue = hasNonFiniteValue || !std::isfinite(value);
+	}
+
+	CHECK(hasNonFiniteValue);
+}
+
+// Positions embedded in a larger struct, like a vertex, so the stride differs from sizeof(Vec3)
+struct StridedPosition
+{
+	Vec3	m_position;
+	float	m_padding[3]	= { 7.0f, 8.0f, 9.0f };
+};
+
+TEST_CASE(Mat44_StridedBatchTransformsMatchScalar)
+{
+	std::mt19937 rng(17);
+	int const stride = static_cast<int>(sizeof(StridedPosition));
+
+	// Counts around multiples of four cover the SIMD body, the scalar tail and both together
+	for (int count = 0; count <= 13; count++)
+	{
+		Mat44 matrix = MakeRandomMatrix(rng);
+
+		std::vector<StridedPosition> input(count);
+		std::vector<Vec3> packed(count);
+
+		for (int index = 0; index < count; index++)
+		{
+			input[index].m_position = Vec3(RollFloat(rng, -50.0f, 50.0f), RollFloat(rng, -50.0f, 50.0f), RollFloat(rng, -50.0f, 50.0f));
+			packed[index] = input[index].m_position;
+		}
+
+		std::vector<StridedPosition> positions = input;
+		std::vector<StridedPosition> vectors = input;
+		std::vector<Vec3> packedPositions(count);
+
+		// In place, the way vertex buffers are transformed
+		matrix.TransformPositions3D(&positions.data()->m_position, &positions.data()->m_position, count, stride);
+		matrix.TransformVectorQuantities3D(&vectors.data()->m_position, &vectors.data()->m_position, count, stride);
+		matrix.TransformPositions3D(packed.data(), packedPositions.data(), count);
+
+		for (int index = 0; index < count; index++)
+		{
+			Vec3 const& in = input[index].m_position;
+			Vec4 expectedPosition = TransformScalar(matrix, Vec4(in.x, in.y, in.z, 1.0f));
+			Vec4 expectedVector = TransformScalar(matrix, Vec4(in.x, in.y, in.z, 0.0f));
+
+			Vec3 const& position = positions[index].m_position;
+			Vec3 const& vector = vectors[index].m_position;
+			Vec3 const& packedPosition = packedPositions[index];
+
+			CHECK(position.x == expectedPosition.x && position.y == expectedPosition.y && position.z == expectedPosition.z);
+			CHECK(vector.x == expectedVector.x && vector.y == expectedVector.y && vector.z == expectedVector.z);
+			CHECK(packedPosition.x == expectedPosition.x && packedPosition.y == expectedPosition.y && packedPosition.z == expectedPosition.z);
+
+			// Bytes between elements are never touched
+			CHECK(positions[index].m_padding[0] == 7.0f && positions[index].m_padding[1] == 8.0f && positions[index].m_padding[2] == 9.0f);
+			CHECK(vectors[index].m_padding[0] == 7.0f && vectors[index].m_padding[1] == 8.0f && vectors[index].m_padding[2] == 9.0f);
+		}
+	}
+}
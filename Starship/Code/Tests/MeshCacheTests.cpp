@@ -0,0 +1,191 @@
+#include "Tests/TestFramework.hpp"
+
+#include "Engine/Renderer/MeshCache.hpp"
+#include "Engine/Renderer/ObjLoader.hpp"
+#include "Engine/Core/FileUtils.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <random>
+
+static float RollFloat(std::mt19937& rng, float minValue, float maxValue)
+{
+	return std::uniform_real_distribution<float>(minValue, maxValue)(rng);
+}
+
+static std::string GetTempFilePath(char const* fileName)
+{
+	return (std::filesystem::temp_directory_path() / fileName).string();
+}
+
+static void WriteTextFile(std::string const& filePath, char const* contents)
+{
+	FILE* file = nullptr;
+	fopen_s(&file, filePath.c_str(), "wb");
+
+	if (file)
+	{
+		fputs(contents, file);
+		fclose(file);
+	}
+}
+
+static Vec3 RollVec3(std::mt19937& rng, float range)
+{
+	return Vec3(RollFloat(rng, -range, range), RollFloat(rng, -range, range), RollFloat(rng, -range, range));
+}
+
+static std::vector<Vertex_PCUTBN> MakeRandomVertices(std::mt19937& rng, int count)
+{
+	std::vector<Vertex_PCUTBN> vertices(count);
+
+	for (int index = 0; index < count; index++)
+	{
+		Rgba8 color((unsigned char)index, (unsigned char)(index * 5), (unsigned char)(index * 11), 255);
+		vertices[index] = Vertex_PCUTBN(RollVec3(rng, 50.0f), color, Vec2(RollFloat(rng, 0.0f, 1.0f), RollFloat(rng, 0.0f, 1.0f)), RollVec3(rng, 1.0f), RollVec3(rng, 1.0f), RollVec3(rng, 1.0f));
+	}
+
+	return vertices;
+}
+
+template <typename T>
+static bool AreBytesEqual(std::vector<T> const& a, std::vector<T> const& b)
+{
+	return a.size() == b.size() && (a.empty() || memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+}
+
+TEST_CASE(MeshCache_RoundTripIsByteExact)
+{
+	std::mt19937 rng(22);
+
+	std::string cacheFilePath = GetTempFilePath("MeshCacheTests.meshcache");
+	std::string materialFilePath = GetTempFilePath("MeshCacheTests.mtl");
+	WriteTextFile(materialFilePath, "newmtl hull\nKd 1 0 0\n");
+
+	std::vector<Vertex_PCUTBN> vertices = MakeRandomVertices(rng, 1001);
+	std::vector<unsigned int> indices(3 * 2000);
+
+	for (unsigned int& index : indices)
+	{
+		index = std::uniform_int_distribution<unsigned int>(0, (unsigned int)vertices.size() - 1)(rng);
+	}
+
+	std::vector<ObjSubmesh> submeshes(2);
+	submeshes[0].m_materialID = -1;
+	submeshes[0].m_numOfIndices = 3 * 500;
+	submeshes[1].m_materialID = 0;
+	submeshes[1].m_firstIndex = 3 * 500;
+	submeshes[1].m_numOfIndices = 3 * 1500;
+
+	std::vector<std::string> dependencies = { materialFilePath };
+	uint64_t sourceHash = 0x1234567890abcdefULL;
+
+	CHECK(MeshCache::Write(cacheFilePath, sourceHash, dependencies, vertices, indices, submeshes, true, false));
+
+	std::vector<Vertex_PCUTBN> readVertices;
+	std::vector<unsigned int> readIndices;
+	std::vector<ObjSubmesh> readSubmeshes;
+	std::vector<std::string> readDependencies;
+	bool hasNormals = false;
+	bool hasUVs = false;
+	MeshCacheHeader header;
+
+	CHECK(MeshCache::Read(cacheFilePath, sourceHash, readVertices, readIndices, readSubmeshes, readDependencies, hasNormals, hasUVs, &header));
+
+	CHECK(AreBytesEqual(readVertices, vertices));
+	CHECK(AreBytesEqual(readIndices, indices));
+	CHECK(AreBytesEqual(readSubmeshes, submeshes));
+	CHECK(readDependencies == dependencies);
+	CHECK(hasNormals && !hasUVs);
+
+	// Bounds are the exact min and max of the vertex positions
+	Vec3 mins = vertices[0].m_position;
+	Vec3 maxs = vertices[0].m_position;
+
+	for (Vertex_PCUTBN const& vertex : vertices)
+	{
+		mins = Vec3(std::min(mins.x, vertex.m_position.x), std::min(mins.y, vertex.m_position.y), std::min(mins.z, vertex.m_position.z));
+		maxs = Vec3(std::max(maxs.x, vertex.m_position.x), std::max(maxs.y, vertex.m_position.y), std::max(maxs.z, vertex.m_position.z));
+	}
+
+	CHECK(header.m_boundsMins[0] == mins.x && header.m_boundsMins[1] == mins.y && header.m_boundsMins[2] == mins.z);
+	CHECK(header.m_boundsMaxs[0] == maxs.x && header.m_boundsMaxs[1] == maxs.y && header.m_boundsMaxs[2] == maxs.z);
+
+	// The mapped file holds the same bytes in place, every section aligned and inside the file, the meshlet sections empty
+	MappedFile cacheFile;
+	CHECK(FileMapReadOnly(cacheFile, cacheFilePath));
+
+	if (cacheFile.m_data)
+	{
+		MeshCacheSectionInfo const& vertexSection = header.m_sections[MESH_CACHE_SECTION_VERTICES];
+		MeshCacheSectionInfo const& indexSection = header.m_sections[MESH_CACHE_SECTION_INDICES];
+
+		CHECK(memcmp(cacheFile.m_data + vertexSection.m_offset, vertices.data(), vertices.size() * sizeof(Vertex_PCUTBN)) == 0);
+		CHECK(memcmp(cacheFile.m_data + indexSection.m_offset, indices.data(), indices.size() * sizeof(unsigned int)) == 0);
+
+		for (MeshCacheSectionInfo const& section : header.m_sections)
+		{
+			CHECK(section.m_offset % 16 == 0);
+			CHECK(section.m_offset + (uint64_t)section.m_elementSize * section.m_numOfElements <= cacheFile.m_size);
+		}
+
+		FileUnmap(cacheFile);
+	}
+
+	CHECK(header.m_sections[MESH_CACHE_SECTION_MESHLETS].m_numOfElements == 0);
+	CHECK(header.m_sections[MESH_CACHE_SECTION_MESHLET_VERTICES].m_numOfElements == 0);
+	CHECK(header.m_sections[MESH_CACHE_SECTION_MESHLET_PRIMITIVES].m_numOfElements == 0);
+
+	// A different source or an edited dependency makes the cache stale
+	std::vector<Vertex_PCUTBN> staleVertices;
+	std::vector<unsigned int> staleIndices;
+	std::vector<ObjSubmesh> staleSubmeshes;
+	std::vector<std::string> staleDependencies;
+
+	CHECK(!MeshCache::Read(cacheFilePath, sourceHash + 1, staleVertices, staleIndices, staleSubmeshes, staleDependencies, hasNormals, hasUVs));
+
+	WriteTextFile(materialFilePath, "newmtl hull\nKd 0 1 0\n");
+	staleDependencies.clear();
+
+	CHECK(!MeshCache::Read(cacheFilePath, sourceHash, staleVertices, staleIndices, staleSubmeshes, staleDependencies, hasNormals, hasUVs));
+	CHECK(staleVertices.empty() && staleIndices.empty() && staleSubmeshes.empty());
+
+	std::filesystem::remove(cacheFilePath);
+	std::filesystem::remove(materialFilePath);
+}
+
+TEST_CASE(MeshCache_EmptyMeshRoundTrips)
+{
+	std::string cacheFilePath = GetTempFilePath("MeshCacheTestsEmpty.meshcache");
+
+	CHECK(MeshCache::Write(cacheFilePath, 7, std::vector<std::string>(), std::vector<Vertex_PCUTBN>(), std::vector<unsigned int>(), std::vector<ObjSubmesh>(), false, false));
+
+	std::vector<Vertex_PCUTBN> vertices;
+	std::vector<unsigned int> indices;
+	std::vector<ObjSubmesh> submeshes;
+	std::vector<std::string> dependencies;
+	bool hasNormals = false;
+	bool hasUVs = false;
+	MeshCacheHeader header;
+
+	CHECK(MeshCache::Read(cacheFilePath, 7, vertices, indices, submeshes, dependencies, hasNormals, hasUVs, &header));
+	CHECK(vertices.empty() && indices.empty() && submeshes.empty() && dependencies.empty());
+
+	for (MeshCacheSectionInfo const& section : header.m_sections)
+	{
+		CHECK(section.m_numOfElements == 0);
+	}
+
+	std::filesystem::remove(cacheFilePath);
+}
+
+TEST_CASE(MeshCache_FailedWriteLeavesNoFile)
+{
+	std::string cacheFilePath = GetTempFilePath("MeshCacheTestsMissingFolder/Mesh.meshcache");
+	std::vector<Vertex_PCUTBN> vertices(3);
+	std::vector<unsigned int> indices = { 0, 1, 2 };
+
+	CHECK(!MeshCache::Write(cacheFilePath, 7, std::vector<std::string>(), vertices, indices, std::vector<ObjSubmesh>(), false, false));
+	CHECK(!std::filesystem::exists(cacheFilePath));
+}
@@ -0,0 +1,344 @@
+#include "Tests/TestFramework.hpp"
+
+#include "Engine/Renderer/Meshlet.hpp"
+#include "Engine/Math/MathUtils.hpp"
+
+#include "ThirdParty/Meshoptimizer/src/meshoptimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <unordered_map>
+
+// The greedy builder trades a few more meshlets for tighter ones than packing the vertex cache order as it comes. These
+// bound how far it may drift from that packing on regular meshes before culling stops paying for it.
+constexpr float MESHLET_MAX_COUNT_RATIO = 1.08f;
+constexpr float MESHLET_MAX_VERTEX_RATIO = 1.02f;
+constexpr float MESHLET_MAX_RADIUS_RATIO = 1.0f;
+
+struct MeshletStats
+{
+	int		m_numOfMeshlets		= 0;
+	float	m_averageVertices	= 0.0f;
+	float	m_averageRadius		= 0.0f;
+};
+
+static float RollFloat(std::mt19937& rng, float minValue, float maxValue)
+{
+	return std::uniform_real_distribution<float>(minValue, maxValue)(rng);
+}
+
+static void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount)
+{
+	std::vector<uint32_t> optimizedIndices(indices.size());
+	meshopt_optimizeVertexCache(optimizedIndices.data(), indices.data(), indices.size(), vertexCount);
+	indices.swap(optimizedIndices);
+}
+
+// A slightly bumpy latitude/longitude sphere with its quads in row order
+static void MakeSphereGrid(int size, std::mt19937& rng, std::vector<MeshVertex_PCUTBN>& outVertices, std::vector<uint32_t>& outIndices)
+{
+	for (int y = 0; y <= size; y++)
+	{
+		for (int x = 0; x <= size; x++)
+		{
+			float theta = 3.14159265f * y / size;
+			float phi = 6.28318531f * x / size;
+			float radius = 1.0f + RollFloat(rng, -0.02f, 0.02f);
+
+			MeshVertex_PCUTBN vertex;
+			vertex.m_position = Vec3(radius * sinf(theta) * cosf(phi), radius * sinf(theta) * sinf(phi), radius * cosf(theta));
+			outVertices.push_back(vertex);
+		}
+	}
+
+	for (int y = 0; y < size; y++)
+	{
+		for (int x = 0; x < size; x++)
+		{
+			uint32_t a = y * (size + 1) + x;
+			uint32_t b = a + 1;
+			uint32_t c = a + size + 2;
+			uint32_t d = a + size + 1;
+
+			outIndices.insert(outIndices.end(), { a, b, c, a, c, d });
+		}
+	}
+
+	OptimizeVertexCache(outIndices, outVertices.size());
+}
+
+// A subdivided icosahedron with its triangles shuffled, so only the vertex cache optimization puts neighbours together
+static void MakeIcosphere(int numOfSubdivisions, std::mt19937& rng, std::vector<MeshVertex_PCUTBN>& outVertices, std::vector<uint32_t>& outIndices)
+{
+	float t = (1.0f + sqrtf(5.0f)) * 0.5f;
+
+	std::vector<Vec3> positions =
+	{
+		Vec3(-1, t, 0), Vec3(1, t, 0), Vec3(-1, -t, 0), Vec3(1, -t, 0),
+		Vec3(0, -1, t), Vec3(0, 1, t), Vec3(0, -1, -t), Vec3(0, 1, -t),
+		Vec3(t, 0, -1), Vec3(t, 0, 1), Vec3(-t, 0, -1), Vec3(-t, 0, 1)
+	};
+
+	for (Vec3& position : positions)
+	{
+		position = position.GetNormalized();
+	}
+
+	std::vector<uint32_t> indices =
+	{
+		0, 11, 5,	0, 5, 1,	0, 1, 7,	0, 7, 10,	0, 10, 11,
+		1, 5, 9,	5, 11, 4,	11, 10, 2,	10, 7, 6,	7, 1, 8,
+		3, 9, 4,	3, 4, 2,	3, 2, 6,	3, 6, 8,	3, 8, 9,
+		4, 9, 5,	2, 4, 11,	6, 2, 10,	8, 6, 7,	9, 8, 1
+	};
+
+	for (int level = 0; level < numOfSubdivisions; level++)
+	{
+		std::unordered_map<uint64_t, uint32_t> midpoints;
+
+		auto getMidpoint = [&](uint32_t a, uint32_t b)
+		{
+			uint64_t key = ((uint64_t)std::min(a, b) << 32) | std::max(a, b);
+			auto found = midpoints.find(key);
+
+			if (found != midpoints.end())
+				return found->second;
+
+			positions.push_back(((positions[a] + positions[b]) * 0.5f).GetNormalized());
+			return midpoints[key] = (uint32_t)positions.size() - 1;
+		};
+
+		std::vector<uint32_t> subdividedIndices;
+
+		for (size_t corner = 0; corner < indices.size(); corner += 3)
+		{
+			uint32_t a = indices[corner];
+			uint32_t b = indices[corner + 1];
+			uint32_t c = indices[corner + 2];
+			uint32_t ab = getMidpoint(a, b);
+			uint32_t bc = getMidpoint(b, c);
+			uint32_t ca = getMidpoint(c, a);
+
+			subdividedIndices.insert(subdividedIndices.end(), { a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca });
+		}
+
+		indices.swap(subdividedIndices);
+	}
+
+	for (Vec3 const& position : positions)
+	{
+		MeshVertex_PCUTBN vertex;
+		vertex.m_position = position * (1.0f + RollFloat(rng, -0.02f, 0.02f));
+		outVertices.push_back(vertex);
+	}
+
+	std::vector<uint32_t> triangleOrder(indices.size() / 3);
+
+	for (uint32_t triangle = 0; triangle < (uint32_t)triangleOrder.size(); triangle++)
+	{
+		triangleOrder[triangle] = triangle;
+	}
+
+	std::shuffle(triangleOrder.begin(), triangleOrder.end(), rng);
+
+	for (uint32_t triangle : triangleOrder)
+	{
+		outIndices.insert(outIndices.end(), { indices[triangle * 3], indices[triangle * 3 + 1], indices[triangle * 3 + 2] });
+	}
+
+	OptimizeVertexCache(outIndices, outVertices.size());
+}
+
+// What Meshletize is measured against: the triangles packed in index order, a new meshlet whenever the next one doesn't fit
+static void PackInIndexOrder(std::vector<uint32_t> const& indices, std::vector<InlineMeshlet>& outMeshlets)
+{
+	outMeshlets.emplace_back();
+
+	for (size_t corner = 0; corner < indices.size(); corner += 3)
+	{
+		uint32_t tri[3] = { indices[corner], indices[corner + 1], indices[corner + 2] };
+
+		if (!MeshletBuilder::AddToMeshlet(outMeshlets.back(), tri))
+		{
+			outMeshlets.emplace_back();
+			MeshletBuilder::AddToMeshlet(outMeshlets.back(), tri);
+		}
+	}
+}
+
+// The radius is measured from the center of each meshlet's bounding box, independent of the spheres the builder grows
+static MeshletStats ComputeMeshletStats(std::vector<InlineMeshlet> const& meshlets, std::vector<MeshVertex_PCUTBN> const& vertices)
+{
+	MeshletStats stats;
+	stats.m_numOfMeshlets = (int)meshlets.size();
+
+	for (InlineMeshlet const& meshlet : meshlets)
+	{
+		Vec3 mins = vertices[meshlet.m_uniqueVertexIndices[0]].m_position;
+		Vec3 maxs = mins;
+
+		for (uint32_t vertexIndex : meshlet.m_uniqueVertexIndices)
+		{
+			Vec3 const& position = vertices[vertexIndex].m_position;
+			mins = Vec3(std::min(mins.x, position.x), std::min(mins.y, position.y), std::min(mins.z, position.z));
+			maxs = Vec3(std::max(maxs.x, position.x), std::max(maxs.y, position.y), std::max(maxs.z, position.z));
+		}
+
+		Vec3 center = (mins + maxs) * 0.5f;
+		float radiusSq = 0.0f;
+
+		for (uint32_t vertexIndex : meshlet.m_uniqueVertexIndices)
+		{
+			radiusSq = std::max(radiusSq, GetDistanceSquared3D(vertices[vertexIndex].m_position, center));
+		}
+
+		stats.m_averageVertices += (float)meshlet.m_uniqueVertexIndices.size();
+		stats.m_averageRadius += sqrtf(radiusSq);
+	}
+
+	stats.m_averageVertices /= (float)std::max(1, stats.m_numOfMeshlets);
+	stats.m_averageRadius /= (float)std::max(1, stats.m_numOfMeshlets);
+
+	return stats;
+}
+
+// Every input triangle ends up in exactly one meshlet with its winding intact, and every meshlet stays within the limits and
+// lists each of its vertices once
+static bool DoMeshletsCoverEachTriangleOnce(std::vector<InlineMeshlet> const& meshlets, std::vector<uint32_t> const& indices)
+{
+	std::vector<std::array<uint32_t, 3>> inputTriangles;
+	std::vector<std::array<uint32_t, 3>> meshletTriangles;
+
+	for (size_t corner = 0; corner < indices.size(); corner += 3)
+	{
+		inputTriangles.push_back({ indices[corner], indices[corner + 1], indices[corner + 2] });
+	}
+
+	for (InlineMeshlet const& meshlet : meshlets)
+	{
+		if (meshlet.m_primitiveIndices.empty() || meshlet.m_primitiveIndices.size() > MAX_TRIANGLES_PER_MESHLET || meshlet.m_uniqueVertexIndices.size() > MAX_VERTICES_PER_MESHLET)
+			return false;
+
+		std::vector<uint32_t> uniqueVertices = meshlet.m_uniqueVertexIndices;
+		std::sort(uniqueVertices.begin(), uniqueVertices.end());
+
+		if (std::adjacent_find(uniqueVertices.begin(), uniqueVertices.end()) != uniqueVertices.end())
+			return false;
+
+		for (PackedPrimitive const& primitive : meshlet.m_primitiveIndices)
+		{
+			for (uint32_t vertexIndex : { primitive.m_i0, primitive.m_i1, primitive.m_i2 })
+			{
+				if (!std::binary_search(uniqueVertices.begin(), uniqueVertices.end(), vertexIndex))
+					return false;
+			}
+
+			meshletTriangles.push_back({ primitive.m_i0, primitive.m_i1, primitive.m_i2 });
+		}
+	}
+
+	std::sort(inputTriangles.begin(), inputTriangles.end());
+	std::sort(meshletTriangles.begin(), meshletTriangles.end());
+
+	return inputTriangles == meshletTriangles;
+}
+
+TEST_CASE(Meshlet_CoversEveryTriangleOnce)
+{
+	std::mt19937 rng(25);
+
+	std::vector<MeshVertex_PCUTBN> vertices;
+	std::vector<uint32_t> indices;
+	std::vector<InlineMeshlet> meshlets;
+
+	MakeIcosphere(4, rng, vertices, indices);
+	MeshletBuilder::Meshletize(meshlets, indices.data(), (uint32_t)indices.size(), vertices, (uint32_t)vertices.size());
+	CHECK(DoMeshletsCoverEachTriangleOnce(meshlets, indices));
+
+	vertices.clear();
+	indices.clear();
+	MakeSphereGrid(60, rng, vertices, indices);
+	MeshletBuilder::Meshletize(meshlets, indices.data(), (uint32_t)indices.size(), vertices, (uint32_t)vertices.size());
+	CHECK(DoMeshletsCoverEachTriangleOnce(meshlets, indices));
+
+	// A triangle soup: open and non-manifold edges, repeated triangles and degenerate ones
+	vertices.resize(200);
+
+	for (MeshVertex_PCUTBN& vertex : vertices)
+	{
+		vertex.m_position = Vec3(RollFloat(rng, -1.0f, 1.0f), RollFloat(rng, -1.0f, 1.0f), RollFloat(rng, -1.0f, 1.0f));
+	}
+
+	indices.clear();
+
+	for (int corner = 0; corner < 3 * 3000; corner++)
+	{
+		indices.push_back(std::uniform_int_distribution<uint32_t>(0, (uint32_t)vertices.size() - 1)(rng));
+	}
+
+	indices.insert(indices.end(), { 7, 7, 8, 9, 9, 9, 10, 11, 12, 10, 11, 12 });
+
+	MeshletBuilder::Meshletize(meshlets, indices.data(), (uint32_t)indices.size(), vertices, (uint32_t)vertices.size());
+	CHECK(DoMeshletsCoverEachTriangleOnce(meshlets, indices));
+
+	MeshletBuilder::Meshletize(meshlets, indices.data(), 0, vertices, (uint32_t)vertices.size());
+	CHECK(meshlets.empty());
+}
+
+TEST_CASE(Meshlet_QualityWithinToleranceOfIndexOrder)
+{
+	std::mt19937 rng(25);
+
+	for (int meshIndex = 0; meshIndex < 2; meshIndex++)
+	{
+		std::vector<MeshVertex_PCUTBN> vertices;
+		std::vector<uint32_t> indices;
+
+		if (meshIndex == 0)
+		{
+			MakeIcosphere(5, rng, vertices, indices);
+		}
+		else
+		{
+			MakeSphereGrid(100, rng, vertices, indices);
+		}
+
+		std::vector<InlineMeshlet> meshlets;
+		MeshletBuilder::Meshletize(meshlets, indices.data(), (uint32_t)indices.size(), vertices, (uint32_t)vertices.size());
+
+		std::vector<InlineMeshlet> packedMeshlets;
+		PackInIndexOrder(indices, packedMeshlets);
+
+		MeshletStats stats = ComputeMeshletStats(meshlets, vertices);
+		MeshletStats packedStats = ComputeMeshletStats(packedMeshlets, vertices);
+
+		CHECK(DoMeshletsCoverEachTriangleOnce(meshlets, indices));
+		CHECK(stats.m_numOfMeshlets <= packedStats.m_numOfMeshlets * MESHLET_MAX_COUNT_RATIO);
+		CHECK(stats.m_averageVertices <= packedStats.m_averageVertices * MESHLET_MAX_VERTEX_RATIO);
+		CHECK(stats.m_averageRadius <= packedStats.m_averageRadius * MESHLET_MAX_RADIUS_RATIO);
+	}
+}
+
+TEST_CASE(Meshlet_GrowBoundingSphereKeepsEveryPoint)
+{
+	std::mt19937 rng(25);
+
+	std::vector<Vec3> points = { Vec3(0.0f, 0.0f, 0.0f), Vec3(1.0f, 0.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f) };
+	BoundingSphere sphere = MeshletBuilder::ComputeMinimumBoundingSphere(points, points.size());
+
+	for (int pointIndex = 0; pointIndex < 500; pointIndex++)
+	{
+		points.push_back(Vec3(RollFloat(rng, -5.0f, 5.0f), RollFloat(rng, -5.0f, 5.0f), RollFloat(rng, -5.0f, 5.0f)));
+		MeshletBuilder::GrowBoundingSphere(sphere, points.back());
+	}
+
+	bool isEveryPointInside = true;
+
+	for (Vec3 const& point : points)
+	{
+		isEveryPointInside = isEveryPointInside && GetDistance3D(point, sphere.m_center) <= sphere.m_radius * 1.0001f;
+	}
+
+	CHECK(isEveryPointInside);
+}
@@ -0,0 +1,44 @@
+#include "Tests/TestFramework.hpp"
+
+#include "Engine/Renderer/ObjLoader.hpp"
+
+#include <cstdio>
+#include <filesystem>
+
+static std::string WriteTempFile(char const* fileName, char const* contents)
+{
+	std::string filePath = (std::filesystem::temp_directory_path() / fileName).string();
+
+	FILE* file = nullptr;
+	fopen_s(&file, filePath.c_str(), "wb");
+
+	if (file)
+	{
+		fputs(contents, file);
+		fclose(file);
+	}
+
+	return filePath;
+}
+
+TEST_CASE(ObjLoader_MaterialFileWithoutFinalNewline)
+{
+	// The last map_Kd has no newline after it, so its path ends at the end of the file
+	std::string filePath = WriteTempFile("ObjLoaderTests.mtl", "newmtl hull\nKd 1 0.5 0\nmap_Kd hull.png\nnewmtl glass\nNs 32\nmap_Kd -s 2 2 1 glass.png");
+
+	std::vector<ObjMaterial> materials;
+	std::unordered_map<std::string, int> materialIDs;
+	ObjLoader::ParsingMaterialFile(filePath, materials, materialIDs);
+
+	std::filesystem::remove(filePath);
+
+	CHECK(materials.size() == 2);
+
+	if (materials.size() != 2)
+		return;
+
+	CHECK(materials[0].m_diffuseMapFilePath == ObjLoader::GetMaterialFilePath("hull.png"));
+	CHECK(materials[1].m_diffuseMapFilePath == ObjLoader::GetMaterialFilePath("glass.png"));
+	CHECK(materials[1].m_diffuseMapFilePath.find('\0') == std::string::npos);
+	CHECK(materials[1].m_specularExponent == 32.0f);
+}
@@ -0,0 +1,291 @@
+#include "Tests/TestFramework.hpp"
+
+#include "Engine/Math/RaycastUtils.hpp"
+
+#include <random>
+
+// Every lane of a packet call is checked against the scalar RaycastVs call for the same ray and primitive. Rays come in
+// four kinds so each lane sees misses, hits from outside, starts inside the shape and directions along an axis.
+enum class PacketRayKind
+{
+	RANDOM,
+	AIMED,
+	INSIDE,
+	AXIS_ALIGNED,
+	NUM_OF_KINDS
+};
+
+static float RollFloat(std::mt19937& rng, float minValue, float maxValue)
+{
+	return std::uniform_real_distribution<float>(minValue, maxValue)(rng);
+}
+
+static Vec3 RollDirection(std::mt19937& rng)
+{
+	Vec3 direction;
+
+	do
+	{
+		direction = Vec3(RollFloat(rng, -1.0f, 1.0f), RollFloat(rng, -1.0f, 1.0f), RollFloat(rng, -1.0f, 1.0f));
+	}
+	while (direction.GetLengthSquared() < 0.01f || direction.GetLengthSquared() > 1.0f);
+
+	return direction.GetNormalized();
+}
+
+static Vec3 RollAxisDirection(std::mt19937& rng, bool is2D)
+{
+	Vec3 const axisDirections[6] = { Vec3(1.0f, 0.0f, 0.0f), Vec3(-1.0f, 0.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f),
+		Vec3(0.0f, -1.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f), Vec3(0.0f, 0.0f, -1.0f) };
+
+	return axisDirections[std::uniform_int_distribution<int>(0, is2D ? 3 : 5)(rng)];
+}
+
+// A ray of the given kind near a shape centered on center with the given size. Axis-aligned rays start off center on
+// the other axes so they both hit and miss.
+static void RollRay(std::mt19937& rng, PacketRayKind kind, Vec3 const& center, float size, bool is2D, Vec3& outStartPos, Vec3& outFwdNormal, float& outMaxDist)
+{
+	outMaxDist = RollFloat(rng, 0.5f, 6.0f) * size;
+
+	switch (kind)
+	{
+	case PacketRayKind::RANDOM:
+		outStartPos = center + RollDirection(rng) * RollFloat(rng, 1.2f, 4.0f) * size;
+		outFwdNormal = RollDirection(rng);
+		break;
+	case PacketRayKind::AIMED:
+		outStartPos = center + RollDirection(rng) * RollFloat(rng, 1.8f, 4.0f) * size;
+		outFwdNormal = (center + RollDirection(rng) * 0.5f * size - outStartPos).GetNormalized();
+		break;
+	case PacketRayKind::INSIDE:
+		outStartPos = center + RollDirection(rng) * RollFloat(rng, 0.0f, 0.5f) * size;
+		outFwdNormal = RollDirection(rng);
+		break;
+	default:
+		outFwdNormal = RollAxisDirection(rng, is2D);
+		outStartPos = center + Vec3(RollFloat(rng, -1.5f, 1.5f), RollFloat(rng, -1.5f, 1.5f), RollFloat(rng, -1.5f, 1.5f)) * size - outFwdNormal * RollFloat(rng, 0.0f, 3.0f) * size;
+		break;
+	}
+
+	if (is2D)
+	{
+		outStartPos.z = 0.0f;
+		outFwdNormal.z = 0.0f;
+		outFwdNormal = outFwdNormal.GetLengthSquared() > 0.0f ? outFwdNormal.GetNormalized() : Vec3(1.0f, 0.0f, 0.0f);
+	}
+}
+
+static bool IsNear(float value, float expected)
+{
+	return fabsf(value - expected) <= 1e-4f * (1.0f + fabsf(expected));
+}
+
+struct LaneTally
+{
+	int		m_numOfHits			= 0;
+	int		m_numOfMisses		= 0;
+	int		m_numOfInsideHits	= 0;
+	int		m_numOfMismatches	= 0;
+};
+
+static void CompareLane(RaycastPacketResult3D const& packet, int lane, RaycastResult3D const& scalar, LaneTally& tally)
+{
+	bool isMatch = packet.DidImpact(lane) == scalar.m_didImpact;
+
+	if (isMatch && scalar.m_didImpact)
+	{
+		isMatch = IsNear(packet.m_impactDist[lane], scalar.m_impactDist)
+			&& IsNear(packet.m_impactPosX[lane], scalar.m_impactPos.x) && IsNear(packet.m_impactPosY[lane], scalar.m_impactPos.y) && IsNear(packet.m_impactPosZ[lane], scalar.m_impactPos.z)
+			&& IsNear(packet.m_impactNormalX[lane], scalar.m_impactNormal.x) && IsNear(packet.m_impactNormalY[lane], scalar.m_impactNormal.y) && IsNear(packet.m_impactNormalZ[lane], scalar.m_impactNormal.z);
+	}
+
+	tally.m_numOfHits += scalar.m_didImpact ? 1 : 0;
+	tally.m_numOfMisses += scalar.m_didImpact ? 0 : 1;
+	tally.m_numOfInsideHits += scalar.m_didImpact && scalar.m_impactDist == 0.0f ? 1 : 0;
+	tally.m_numOfMismatches += isMatch ? 0 : 1;
+}
+
+static void CompareLane(RaycastPacketResult2D const& packet, int lane, RaycastResult2D const& scalar, LaneTally& tally)
+{
+	bool isMatch = packet.DidImpact(lane) == scalar.m_didImpact;
+
+	if (isMatch && scalar.m_didImpact)
+	{
+		isMatch = IsNear(packet.m_impactDist[lane], scalar.m_impactDist)
+			&& IsNear(packet.m_impactPosX[lane], scalar.m_impactPos.x) && IsNear(packet.m_impactPosY[lane], scalar.m_impactPos.y)
+			&& IsNear(packet.m_impactNormalX[lane], scalar.m_impactNormal.x) && IsNear(packet.m_impactNormalY[lane], scalar.m_impactNormal.y);
+	}
+
+	tally.m_numOfHits += scalar.m_didImpact ? 1 : 0;
+	tally.m_numOfMisses += scalar.m_didImpact ? 0 : 1;
+	tally.m_numOfInsideHits += scalar.m_didImpact && scalar.m_impactDist == 0.0f ? 1 : 0;
+	tally.m_numOfMismatches += isMatch ? 0 : 1;
+}
+
+static void CheckTally(LaneTally const& tally)
+{
+	CHECK(tally.m_numOfMismatches == 0);
+	CHECK(tally.m_numOfHits > 1000);
+	CHECK(tally.m_numOfMisses > 1000);
+	CHECK(tally.m_numOfInsideHits > 100);
+}
+
+static int const NUM_OF_PACKETS = 4000;
+
+TEST_CASE(PacketRaycast_AABB3LanesMatchScalar)
+{
+	std::mt19937 rng(18);
+	LaneTally tally;
+
+	for (int packetIndex = 0; packetIndex < NUM_OF_PACKETS; packetIndex++)
+	{
+		Vec3 center(RollFloat(rng, -50.0f, 50.0f), RollFloat(rng, -50.0f, 50.0f), RollFloat(rng, -50.0f, 50.0f));
+		Vec3 halfSize(RollFloat(rng, 0.5f, 4.0f), RollFloat(rng, 0.5f, 4.0f), RollFloat(rng, 0.5f, 4.0f));
+		AABB3 bounds(center - halfSize, center + halfSize);
+		float size = halfSize.GetLength();
+
+		// Four rays against one box, each lane a different kind
+		RayPacket3D rays;
+		Vec3 startPositions[RAYCAST_PACKET_WIDTH];
+		Vec3 fwdNormals[RAYCAST_PACKET_WIDTH];
+		float maxDists[RAYCAST_PACKET_WIDTH];
+
+		for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+		{
+			PacketRayKind kind = static_cast<PacketRayKind>((packetIndex + lane) % static_cast<int>(PacketRayKind::NUM_OF_KINDS));
+			RollRay(rng, kind, center, size * 0.5f, false, startPositions[lane], fwdNormals[lane], maxDists[lane]);
+			rays.SetRay(lane, startPositions[lane], fwdNormals[lane], maxDists[lane]);
+		}
+
+		RaycastPacketResult3D packet = RaycastPacketVsAABB3D(rays, bounds);
+
+		for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+		{
+			CompareLane(packet, lane, RaycastVsAABB3D(startPositions[lane], fwdNormals[lane], maxDists[lane], bounds), tally);
+		}
+
+		// One ray against four boxes around the same spot
+		AABB3 boxes[RAYCAST_PACKET_WIDTH];
+
+		for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+		{
+			Vec3 laneCenter = center + RollDirection(rng) * RollFloat(rng, 0.0f, size);
+			Vec3 laneHalfSize(RollFloat(rng, 0.5f, 4.0f), RollFloat(rng, 0.5f, 4.0f), RollFloat(rng, 0.5f, 4.0f));
+			boxes[lane] = AABB3(laneCenter - laneHalfSize, laneCenter + laneHalfSize);
+		}
+
+		RaycastPacketResult3D boxesPacket = RaycastVsAABB3s(startPositions[0], fwdNormals[0], maxDists[0], boxes);
+
+		for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+		{
+			CompareLane(boxesPacket, lane, RaycastVsAABB3D(startPositions[0], fwdNormals[0], maxDists[0], boxes[lane]), tally);
+		}
+	}
+
+	CheckTally(tally);
+}
+
+TEST_CASE(PacketRaycast_SphereLanesMatchScalar)
+{
+	std::mt19937 rng(19);
+	LaneTally tally;
+
+	for (int packetIndex = 0; packetIndex < NUM_OF_PACKETS; packetIndex++)
+	{
+		Vec3 center(RollFloat(rng, -50.0f, 50.0f), RollFloat(rng, -50.0f, 50.0f), RollFloat(rng, -50.0f, 50.0f));
+		float radius = RollFloat(rng, 0.5f, 5.0f);
+
+		RayPacket3D rays;
+		Vec3 startPositions[RAYCAST_PACKET_WIDTH];
+		Vec3 fwdNormals[RAYCAST_PACKET_WIDTH];
+		float maxDists[RAYCAST_PACKET_WIDTH];
+
+		for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+		{
+			PacketRayKind kind = static_cast<PacketRayKind>((packetIndex + lane) % static_cast<int>(PacketRayKind::NUM_OF_KINDS));
+			RollRay(rng, kind, center, radius, false, startPositions[lane], fwdNormals[lane], maxDists[lane]);
+			rays.SetRay(lane, startPositions[lane], fwdNormals[lane], maxDists[lane]);
+		}
+
+		RaycastPacketResult3D packet = RaycastPacketVsSphere3D(rays, center, radius);
+
+		for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+		{
+			CompareLane(packet, lane, RaycastVsSphere3D(startPositions[lane], fwdNormals[lane], maxDists[lane], center, radius), tally);
+		}
+
+		Vec3 sphereCenters[RAYCAST_PACKET_WIDTH];
+		float sphereRadii[RAYCAST_PACKET_WIDTH];
+
+		for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+		{
+			sphereCenters[lane] = center + RollDirection(rng) * RollFloat(rng, 0.0f, radius);
+			sphereRadii[lane] = RollFloat(rng, 0.5f, 5.0f);
+		}
+
+		RaycastPacketResult3D spheresPacket = RaycastVsSpheres3D(startPositions[0], fwdNormals[0], maxDists[0], sphereCenters, sphereRadii);
+
+		for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+		{
+			CompareLane(spheresPacket, lane, RaycastVsSphere3D(startPositions[0], fwdNormals[0], maxDists[0], sphereCenters[lane], sphereRadii[lane]), tally);
+		}
+	}
+
+	CheckTally(tally);
+}
+
+TEST_CASE(PacketRaycast_DiscLanesMatchScalar)
+{
+	std::mt19937 rng(20);
+	LaneTally tally;
+
+	for (int packetIndex = 0; packetIndex < NUM_OF_PACKETS; packetIndex++)
+	{
+		Vec2 center(RollFloat(rng, -50.0f, 50.0f), RollFloat(rng, -50.0f, 50.0f));
+		float radius = RollFloat(rng, 0.5f, 5.0f);
+
+		RayPacket2D rays;
+		Vec2 startPositions[RAYCAST_PACKET_WIDTH];
+		Vec2 fwdNormals[RAYCAST_PACKET_WIDTH];
+		float maxDists[RAYCAST_PACKET_WIDTH];
+
+		for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+		{
+			PacketRayKind kind = static_cast<PacketRayKind>((packetIndex + lane) % static_cast<int>(PacketRayKind::NUM_OF_KINDS));
+
+			Vec3 startPos;
+			Vec3 fwdNormal;
+			RollRay(rng, kind, Vec3(center.x, center.y, 0.0f), radius, true, startPos, fwdNormal, maxDists[lane]);
+
+			startPositions[lane] = Vec2(startPos.x, startPos.y);
+			fwdNormals[lane] = Vec2(fwdNormal.x, fwdNormal.y);
+			rays.SetRay(lane, startPositions[lane], fwdNormals[lane], maxDists[lane]);
+		}
+
+		RaycastPacketResult2D packet = RaycastPacketVsDisc2D(rays, center, radius);
+
+		for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+		{
+			CompareLane(packet, lane, RaycastVsDisc2D(startPositions[lane], fwdNormals[lane], maxDists[lane], center, radius), tally);
+		}
+
+		Vec2 discCenters[RAYCAST_PACKET_WIDTH];
+		float discRadii[RAYCAST_PACKET_WIDTH];
+
+		for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+		{
+			Vec3 offset = RollDirection(rng) * RollFloat(rng, 0.0f, radius);
+			discCenters[lane] = center + Vec2(offset.x, offset.y);
+			discRadii[lane] = RollFloat(rng, 0.5f, 5.0f);
+		}
+
+		RaycastPacketResult2D discsPacket = RaycastVsDiscs2D(startPositions[0], fwdNormals[0], maxDists[0], discCenters, discRadii);
+
+		for (int lane = 0; lane < RAYCAST_PACKET_WIDTH; lane++)
+		{
+			CompareLane(discsPacket, lane, RaycastVsDisc2D(startPositions[0], fwdNormals[0], maxDists[0], discCenters[lane], discRadii[lane]), tally);
+		}
+	}
+
+	CheckTally(tally);
+}
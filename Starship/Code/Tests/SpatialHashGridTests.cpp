@@ -0,0 +1,165 @@
+#include "Tests/TestFramework.hpp"
+
+#include "Engine/Math/SpatialHashGrid.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+struct TestDisc
+{
+	Vec2	m_center;
+	float	m_radius	= 0.0f;
+	bool	m_isAdded	= false;
+};
+
+static float RollFloat(std::mt19937& rng, float minValue, float maxValue)
+{
+	return std::uniform_real_distribution<float>(minValue, maxValue)(rng);
+}
+
+static int RollInt(std::mt19937& rng, int minValue, int maxValue)
+{
+	return std::uniform_int_distribution<int>(minValue, maxValue)(rng);
+}
+
+// Scatters discs over and around the bounds, so some clamp into the edge cells. A few are large enough to span many cells,
+// and some are never added, like dead entities the game skips.
+static std::vector<TestDisc> MakeRandomLayout(std::mt19937& rng, AABB2 const& bounds)
+{
+	std::vector<TestDisc> discs(RollInt(rng, 0, 300));
+
+	for (TestDisc& disc : discs)
+	{
+		disc.m_center.x = RollFloat(rng, bounds.m_mins.x - 20.0f, bounds.m_maxs.x + 20.0f);
+		disc.m_center.y = RollFloat(rng, bounds.m_mins.y - 20.0f, bounds.m_maxs.y + 20.0f);
+		disc.m_radius = RollInt(rng, 0, 20) == 0 ? RollFloat(rng, 10.0f, 30.0f) : RollFloat(rng, 0.0f, 6.0f);
+		disc.m_isAdded = RollInt(rng, 0, 9) != 0;
+	}
+
+	return discs;
+}
+
+static std::vector<int> FindOverlapsBruteForce(std::vector<TestDisc> const& discs, Vec2 const& center, float radius)
+{
+	std::vector<int> ids;
+
+	for (int id = 0; id < (int)discs.size(); id++)
+	{
+		if (discs[id].m_isAdded && DoDiscsOverlap(discs[id].m_center, discs[id].m_radius, center, radius))
+		{
+			ids.push_back(id);
+		}
+	}
+
+	return ids;
+}
+
+TEST_CASE(SpatialHashGrid_OverlapsMatchBruteForceOnRandomLayouts)
+{
+	std::mt19937 rng(1234);
+	AABB2 bounds(0.0f, 0.0f, 200.0f, 100.0f);
+	SpatialHashGrid grid;
+
+	for (int layoutIndex = 0; layoutIndex < 100; layoutIndex++)
+	{
+		grid.Initialize(bounds, RollFloat(rng, 2.0f, 40.0f));
+
+		std::vector<TestDisc> discs = MakeRandomLayout(rng, bounds);
+		int numOfAddedDiscs = 0;
+
+		for (int id = 0; id < (int)discs.size(); id++)
+		{
+			if (discs[id].m_isAdded)
+			{
+				grid.Add(id, discs[id].m_center, discs[id].m_radius);
+				numOfAddedDiscs++;
+			}
+		}
+
+		grid.Build();
+
+		CHECK(grid.GetNumOfEntries() == numOfAddedDiscs);
+
+		for (int queryIndex = 0; queryIndex < 200; queryIndex++)
+		{
+			Vec2 center(RollFloat(rng, -30.0f, 230.0f), RollFloat(rng, -30.0f, 130.0f));
+			float radius = RollFloat(rng, 0.0f, 8.0f);
+
+			std::vector<int> gridIds;
+			grid.ForEachOverlap(center, radius, [&](int id) { gridIds.push_back(id); });
+			std::sort(gridIds.begin(), gridIds.end());
+
+			// Equal after sorting also means the grid reported no id twice, since the brute force list is duplicate-free
+			CHECK(gridIds == FindOverlapsBruteForce(discs, center, radius));
+		}
+	}
+}
+
+TEST_CASE(SpatialHashGrid_LowestOverlappingIdMatchesFrontToBackScan)
+{
+	std::mt19937 rng(5678);
+	AABB2 bounds(0.0f, 0.0f, 200.0f, 100.0f);
+	SpatialHashGrid grid;
+
+	for (int layoutIndex = 0; layoutIndex < 100; layoutIndex++)
+	{
+		grid.Initialize(bounds, RollFloat(rng, 2.0f, 40.0f));
+
+		std::vector<TestDisc> discs = MakeRandomLayout(rng, bounds);
+
+		for (int id = 0; id < (int)discs.size(); id++)
+		{
+			if (discs[id].m_isAdded)
+			{
+				grid.Add(id, discs[id].m_center, discs[id].m_radius);
+			}
+		}
+
+		grid.Build();
+
+		// Entries killed after Build stay in the grid; the predicate filters them the way the game checks IsAlive
+		std::vector<bool> isAlive(discs.size());
+
+		for (int id = 0; id < (int)discs.size(); id++)
+		{
+			isAlive[id] = RollInt(rng, 0, 3) != 0;
+		}
+
+		for (int queryIndex = 0; queryIndex < 200; queryIndex++)
+		{
+			Vec2 center(RollFloat(rng, -30.0f, 230.0f), RollFloat(rng, -30.0f, 130.0f));
+			float radius = RollFloat(rng, 0.0f, 8.0f);
+
+			int expectedId = -1;
+
+			for (int id : FindOverlapsBruteForce(discs, center, radius))
+			{
+				if (isAlive[id])
+				{
+					expectedId = id;
+					break;
+				}
+			}
+
+			CHECK(grid.FindLowestOverlappingId(center, radius, [&](int id) { return isAlive[id]; }) == expectedId);
+		}
+	}
+}
+
+TEST_CASE(SpatialHashGrid_ClearEmptiesTheGrid)
+{
+	SpatialHashGrid grid(AABB2(0.0f, 0.0f, 200.0f, 100.0f), 10.0f);
+
+	grid.Add(0, Vec2(50.0f, 50.0f), 5.0f);
+	grid.Build();
+	grid.Clear();
+	grid.Build();
+
+	int numOfOverlaps = 0;
+	grid.ForEachOverlap(Vec2(50.0f, 50.0f), 5.0f, [&](int) { numOfOverlaps++; });
+
+	CHECK(grid.GetNumOfEntries() == 0);
+	CHECK(numOfOverlaps == 0);
+	CHECK(grid.FindLowestOverlappingId(Vec2(50.0f, 50.0f), 5.0f, [](int) { return true; }) == -1);
+}
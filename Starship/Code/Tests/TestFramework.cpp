@@ -0,0 +1,73 @@
+#include "Tests/TestFramework.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+struct TestCase
+{
+	char const*		m_name		= nullptr;
+	TestFunction	m_function	= nullptr;
+};
+
+// Function-local so registration from other translation units never runs before the list exists
+static std::vector<TestCase>& GetTestCases()
+{
+	static std::vector<TestCase> s_testCases;
+	return s_testCases;
+}
+
+static int s_numOfFailedChecks = 0;
+
+TestRegistrar::TestRegistrar(char const* name, TestFunction function)
+{
+	TestCase testCase;
+	testCase.m_name = name;
+	testCase.m_function = function;
+
+	GetTestCases().push_back(testCase);
+}
+
+void ReportTestFailure(char const* file, int line, char const* expression)
+{
+	s_numOfFailedChecks++;
+
+	// Only the first few failures of a test are printed; the rest usually repeat the same mistake
+	if (s_numOfFailedChecks <= 10)
+	{
+		printf("    %s(%d): CHECK failed: %s\n", file, line, expression);
+	}
+}
+
+// Runs every test whose name contains argv[1], or all of them when no filter is given
+int main(int argc, char* argv[])
+{
+	char const* filter = argc > 1 ? argv[1] : nullptr;
+
+	int numOfRunTests = 0;
+	int numOfFailedTests = 0;
+
+	for (TestCase const& testCase : GetTestCases())
+	{
+		if (filter && !strstr(testCase.m_name, filter))
+			continue;
+
+		s_numOfFailedChecks = 0;
+		testCase.m_function();
+		numOfRunTests++;
+
+		if (s_numOfFailedChecks > 0)
+		{
+			numOfFailedTests++;
+			printf("[FAIL] %s (%d failed checks)\n", testCase.m_name, s_numOfFailedChecks);
+		}
+		else
+		{
+			printf("[ OK ] %s\n", testCase.m_name);
+		}
+	}
+
+	printf("%d of %d tests passed\n", numOfRunTests - numOfFailedTests, numOfRunTests);
+
+	return numOfFailedTests;
+}
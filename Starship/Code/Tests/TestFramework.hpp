@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cmath>
+
+// Minimal self-registering test runner. TEST_CASE defines a function that main runs once; CHECK records a failure and keeps
+// going so one run reports every broken expectation. The process exit code is the number of failed test cases.
+typedef void (*TestFunction)();
+
+class TestRegistrar
+{
+public:
+	TestRegistrar(char const* name, TestFunction function);
+};
+
+void ReportTestFailure(char const* file, int line, char const* expression);
+
+#define TEST_CASE(name) \
+	static void name(); \
+	static TestRegistrar s_##name##Registrar(#name, &name); \
+	static void name()
+
+#define CHECK(expression) \
+	do { if (!(expression)) ReportTestFailure(__FILE__, __LINE__, #expression); } while (false)
+
+#define CHECK_NEAR(actual, expected, tolerance) \
+	do { if (!(fabsf((float)(actual) - (float)(expected)) <= (float)(tolerance))) ReportTestFailure(__FILE__, __LINE__, #actual " ~= " #expected); } while (false)
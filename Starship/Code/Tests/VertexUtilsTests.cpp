@@ -0,0 +1,181 @@
+#include "Tests/TestFramework.hpp"
+
+#include "Engine/Core/VertexUtils.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Core/Vertex_PCUTBN.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Math/Mat44.hpp"
+
+#include <random>
+#include <vector>
+
+static float RollFloat(std::mt19937& rng, float minValue, float maxValue)
+{
+	return std::uniform_real_distribution<float>(minValue, maxValue)(rng);
+}
+
+static std::vector<Vertex_PCU> MakeRandomVerts(std::mt19937& rng, int count)
+{
+	std::vector<Vertex_PCU> verts(count);
+
+	for (int index = 0; index < count; index++)
+	{
+		Vec3 position(RollFloat(rng, -10.0f, 10.0f), RollFloat(rng, -10.0f, 10.0f), RollFloat(rng, -1.0f, 1.0f));
+		Rgba8 color((unsigned char)index, (unsigned char)(index * 3), (unsigned char)(index * 7), 255);
+		verts[index] = Vertex_PCU(position, color, Vec2(RollFloat(rng, 0.0f, 1.0f), RollFloat(rng, 0.0f, 1.0f)));
+	}
+
+	return verts;
+}
+
+// Only x and y change; z, color and UVs are carried over untouched
+static bool AreOtherAttributesKept(Vertex_PCU const& vert, Vertex_PCU const& original)
+{
+	return vert.m_position.z == original.m_position.z && vert.m_color.r == original.m_color.r && vert.m_color.g == original.m_color.g
+		&& vert.m_color.b == original.m_color.b && vert.m_color.a == original.m_color.a
+		&& vert.m_uvTexCoords.x == original.m_uvTexCoords.x && vert.m_uvTexCoords.y == original.m_uvTexCoords.y;
+}
+
+TEST_CASE(VertexUtils_XYBasisTransformMatchesScalar)
+{
+	std::mt19937 rng(15);
+
+	// Counts around multiples of four cover the SIMD body and the scalar tail
+	for (int count = 0; count <= 13; count++)
+	{
+		std::vector<Vertex_PCU> original = MakeRandomVerts(rng, count);
+		std::vector<Vertex_PCU> verts = original;
+
+		Vec2 iBasis(RollFloat(rng, -2.0f, 2.0f), RollFloat(rng, -2.0f, 2.0f));
+		Vec2 jBasis(RollFloat(rng, -2.0f, 2.0f), RollFloat(rng, -2.0f, 2.0f));
+		Vec2 translation(RollFloat(rng, -100.0f, 100.0f), RollFloat(rng, -100.0f, 100.0f));
+
+		TransformVertexArrayXY3D(count, verts.data(), iBasis, jBasis, translation);
+
+		for (int index = 0; index < count; index++)
+		{
+			Vec3 const& in = original[index].m_position;
+			float expectedX = ((in.x * iBasis.x) + (in.y * jBasis.x)) + translation.x;
+			float expectedY = ((in.x * iBasis.y) + (in.y * jBasis.y)) + translation.y;
+
+			CHECK(verts[index].m_position.x == expectedX && verts[index].m_position.y == expectedY);
+			CHECK(AreOtherAttributesKept(verts[index], original[index]));
+		}
+	}
+}
+
+TEST_CASE(VertexUtils_XYRotationTransformMatchesReference)
+{
+	std::mt19937 rng(16);
+
+	for (int iteration = 0; iteration < 200; iteration++)
+	{
+		int count = iteration % 17;
+		std::vector<Vertex_PCU> localVerts = MakeRandomVerts(rng, count);
+		std::vector<Vertex_PCU> worldVerts(count);
+		std::vector<Vertex_PCU> inPlaceVerts = localVerts;
+
+		float scale = RollFloat(rng, 0.1f, 4.0f);
+		float degrees = RollFloat(rng, -720.0f, 720.0f);
+		Vec2 translation(RollFloat(rng, -100.0f, 100.0f), RollFloat(rng, -100.0f, 100.0f));
+
+		TransformVertexArrayXY3D(count, localVerts.data(), worldVerts.data(), scale, degrees, translation);
+		TransformVertexArrayXY3D(count, inPlaceVerts.data(), scale, degrees, translation);
+
+		double radians = (double)degrees * 3.14159265358979323846 / 180.0;
+
+		for (int index = 0; index < count; index++)
+		{
+			Vec3 const& in = localVerts[index].m_position;
+			double expectedX = scale * (in.x * cos(radians) - in.y * sin(radians)) + translation.x;
+			double expectedY = scale * (in.x * sin(radians) + in.y * cos(radians)) + translation.y;
+
+			// Fast sin/cos error scaled by the vertex's distance, plus float rounding of the translation
+			float tolerance = 1e-5f * scale * 15.0f + 1e-4f;
+
+			CHECK_NEAR(worldVerts[index].m_position.x, expectedX, tolerance);
+			CHECK_NEAR(worldVerts[index].m_position.y, expectedY, tolerance);
+			CHECK(AreOtherAttributesKept(worldVerts[index], localVerts[index]));
+
+			// In place and local-to-world run the same kernel
+			CHECK(inPlaceVerts[index].m_position.x == worldVerts[index].m_position.x && inPlaceVerts[index].m_position.y == worldVerts[index].m_position.y);
+		}
+	}
+}
+
+static void CheckVertexArray3DMatchesPerVertex(std::mt19937& rng, int count)
+{
+	Mat44 transform = Mat44::CreateZRotationDegrees(RollFloat(rng, -180.0f, 180.0f));
+	transform.AppendXRotation(RollFloat(rng, -180.0f, 180.0f));
+	transform.AppendScaleNonUniform3D(Vec3(2.0f, 0.5f, 3.0f));
+	transform.SetTranslation3D(Vec3(RollFloat(rng, -50.0f, 50.0f), RollFloat(rng, -50.0f, 50.0f), RollFloat(rng, -50.0f, 50.0f)));
+
+	std::vector<Vertex_PCUTBN> original(count);
+
+	for (Vertex_PCUTBN& vert : original)
+	{
+		vert.m_position = Vec3(RollFloat(rng, -10.0f, 10.0f), RollFloat(rng, -10.0f, 10.0f), RollFloat(rng, -10.0f, 10.0f));
+		vert.m_normal = Vec3(RollFloat(rng, -1.0f, 1.0f), RollFloat(rng, -1.0f, 1.0f), RollFloat(rng, -1.0f, 1.0f));
+		vert.m_tangent = Vec3(1.0f, 2.0f, 3.0f);
+	}
+
+	std::vector<Vertex_PCUTBN> verts = original;
+	TransformVertexArray3D(verts, transform, true);
+
+	std::vector<Vertex_PCU> pcuVerts(count);
+
+	for (int index = 0; index < count; index++)
+	{
+		pcuVerts[index].m_position = original[index].m_position;
+	}
+
+	TransformVertexArray3D(pcuVerts, transform);
+
+	bool doAllMatch = true;
+
+	for (int index = 0; index < count; index++)
+	{
+		Vec3 expectedPosition = transform.TransformPosition3D(original[index].m_position);
+		Vec3 expectedNormal = transform.TransformVectorQuantity3D(original[index].m_normal);
+
+		Vec3 const& position = verts[index].m_position;
+		Vec3 const& normal = verts[index].m_normal;
+		Vec3 const& pcuPosition = pcuVerts[index].m_position;
+
+		doAllMatch = doAllMatch && position.x == expectedPosition.x && position.y == expectedPosition.y && position.z == expectedPosition.z;
+		doAllMatch = doAllMatch && pcuPosition.x == expectedPosition.x && pcuPosition.y == expectedPosition.y && pcuPosition.z == expectedPosition.z;
+		doAllMatch = doAllMatch && fabsf(normal.x - expectedNormal.x) <= 1e-5f && fabsf(normal.y - expectedNormal.y) <= 1e-5f && fabsf(normal.z - expectedNormal.z) <= 1e-5f;
+		doAllMatch = doAllMatch && verts[index].m_tangent.x == 1.0f && verts[index].m_tangent.y == 2.0f && verts[index].m_tangent.z == 3.0f;
+	}
+
+	CHECK(doAllMatch);
+}
+
+TEST_CASE(VertexUtils_VertexArray3DMatchesPerVertexTransform)
+{
+	std::mt19937 rng(17);
+
+	// Single-threaded: small arrays and arrays spanning several chunks with a partial last one
+	for (int count : { 0, 1, 3, 4, 5, 4096, 4097, 3 * 4096 + 123 })
+	{
+		CheckVertexArray3DMatchesPerVertex(rng, count);
+	}
+
+	// The same chunks split across workers
+	JobSystemConfig config;
+	config.m_numOfWorkerThreads = 4;
+
+	JobSystem jobSystem(config);
+	jobSystem.StartUp();
+
+	JobSystem* previousJobSystem = g_theJobSystem;
+	g_theJobSystem = &jobSystem;
+
+	for (int count : { 4097, 10 * 4096 + 5 })
+	{
+		CheckVertexArray3DMatchesPerVertex(rng, count);
+	}
+
+	g_theJobSystem = previousJobSystem;
+	jobSystem.ShutDown();
+}